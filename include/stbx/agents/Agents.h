@@ -27,5 +27,6 @@
 #include <stbx/agents/concrete/StaticServerAgent.hpp>
 #include <stbx/agents/concrete/DynamicServerlessAgent.hpp>
 #include <stbx/agents/concrete/DynamicServerAgent.hpp>
+#include <stbx/agents/concrete/DynamicSharedCounterAgent.hpp>
 
 #endif //PIPELINE_AGENTS_AGENTS_H
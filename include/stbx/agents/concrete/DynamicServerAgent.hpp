@@ -80,8 +80,6 @@ namespace stbx {
 
             operations::dataunits::GridBox *mpGridBox;
 
-            std::vector<float *> mStacks;
-
             /**
              * ==============================================
              * Flags used for the master slave communication.
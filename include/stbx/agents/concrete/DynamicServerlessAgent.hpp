@@ -79,8 +79,6 @@ namespace stbx {
             /// Shots per each process
             std::vector<uint> mProcessShots;
 
-            std::vector<float *> mStacks;
-
             operations::dataunits::GridBox *mpGridBox;
 
             bool mHasShotDynamic = false;
@@ -0,0 +1,88 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PIPELINE_AGENTS_DYNAMIC_SHARED_COUNTER_HPP
+#define PIPELINE_AGENTS_DYNAMIC_SHARED_COUNTER_HPP
+
+#if defined(USING_MPI)
+
+#include <stbx/agents/interface/Agent.hpp>
+
+#include <mpi.h>
+
+namespace stbx {
+    namespace agents {
+
+        /**
+         * @brief Serverless dynamic shot distribution, where every process (rank 0
+         * included) pulls its next shot by atomically incrementing a shared shot
+         * counter exposed by rank 0 through an MPI one-sided window.
+         *
+         * @note No process waits on another one to get a shot, so a slow process only
+         * delays its own shots.
+         */
+        class DynamicSharedCounterAgent : public Agent {
+        public:
+            DynamicSharedCounterAgent() = default;
+
+            ~DynamicSharedCounterAgent() override;
+
+            operations::dataunits::GridBox *Initialize() override;
+
+            void BeforeMigration() override;
+
+            void AfterMigration() override;
+
+            void BeforeFinalize() override;
+
+            operations::dataunits::MigrationData *AfterFinalize(
+                    operations::dataunits::MigrationData *apMigrationData) override;
+
+            bool HasNextShot() override;
+
+            std::vector<uint> GetNextShot() override;
+
+        private:
+            operations::dataunits::GridBox *mpGridBox;
+
+            /// Current process rank is stored in self
+            int self, mProcessCount;
+
+            /// MPI communicator
+            MPI_Comm mCommunication;
+
+            /// Window exposing the shared shot counter of rank 0
+            MPI_Win mCounterWindow;
+
+            /// Shared shot counter, only allocated on rank 0
+            int *mpCounter = nullptr;
+
+            /// All shots vector, identical on all processes
+            std::vector<uint> mPossibleShots;
+
+            /// Index of the shot pulled by the current process
+            int mShotIndex = 0;
+        };
+    }//namespace agents
+}//namespace stbx
+
+#endif
+
+#endif //PIPELINE_AGENTS_DYNAMIC_SHARED_COUNTER_HPP
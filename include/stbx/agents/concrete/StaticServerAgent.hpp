@@ -63,8 +63,6 @@ namespace stbx {
 
             /// Shots vector
             std::vector<uint> mPossibleShots;
-
-            std::vector<float *> mStacks;
         };
     }//namespace agents
 }//namespace stbx
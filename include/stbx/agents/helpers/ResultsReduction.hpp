@@ -0,0 +1,67 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PIPELINE_AGENTS_HELPERS_RESULTS_REDUCTION_HPP
+#define PIPELINE_AGENTS_HELPERS_RESULTS_REDUCTION_HPP
+
+#if defined(USING_MPI)
+
+#include <operations/data-units/concrete/migration/MigrationData.hpp>
+
+#include <mpi.h>
+
+namespace stbx {
+    namespace agents {
+        namespace helpers {
+
+            /**
+             * @brief Sums the results of all processes into the results of the root process,
+             * in place.
+             *
+             * The results are reduced in chunks, keeping a few non-blocking reductions in
+             * flight so the transfer of one chunk overlaps the reduction of the others,
+             * and no process allocates a second copy of the image.
+             *
+             * @param[in] apMigrationData
+             * Migration data of the current process, holding the results to reduce.
+             *
+             * @param[in] aCommunicator
+             * Communicator of the processes taking part in the reduction.
+             *
+             * @param[in] aRoot
+             * Rank of the process receiving the reduced results.
+             *
+             * @param[in] aChunkSize
+             * Number of elements reduced by each reduction.
+             *
+             * @param[in] aChunksInFlight
+             * Maximum number of reductions in progress at once.
+             */
+            void ReduceResults(operations::dataunits::MigrationData *apMigrationData,
+                               MPI_Comm aCommunicator, int aRoot,
+                               size_t aChunkSize = 16 * 1024 * 1024,
+                               int aChunksInFlight = 4);
+
+        }//namespace helpers
+    }//namespace agents
+}//namespace stbx
+
+#endif
+
+#endif //PIPELINE_AGENTS_HELPERS_RESULTS_REDUCTION_HPP
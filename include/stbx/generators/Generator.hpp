@@ -26,6 +26,7 @@
 #include <operations/engine-configurations/concrete/RTMEngineConfigurations.hpp>
 #include <operations/engine-configurations/concrete/ModellingEngineConfigurations.hpp>
 #include <operations/engines/concrete/RTMEngine.hpp>
+#include <operations/engines/concrete/ConcurrentRTMEngine.hpp>
 #include <operations/engines/concrete/ModellingEngine.hpp>
 #include <operations/helpers/callbacks/primitive/CallbackCollection.hpp>
 
@@ -66,6 +66,9 @@
 #define K_DEPTH                             "depth"
 #define K_FRONT                             "front"
 #define K_BACK                              "back"
+#define K_ADAPTIVE                          "adaptive"
+#define K_APERTURE                          "aperture"
+#define K_APERTURE_ANGLE                    "aperture-angle"
 #define K_STENCIL_ORDER                     "stencil-order"
 #define K_BOUNDARY_LENGTH                   "boundary-length"
 #define K_SOURCE_FREQUENCY                  "source-frequency"
@@ -131,6 +134,7 @@
 #define K_AGENT                             "agent"
 #define K_WRITER                            "writer"
 #define K_ALGORITHM                         "algorithm"
+#define K_CONCURRENT_SHOTS                  "concurrent-shots"
 #define K_TIMER                             "timer"
 #define K_TIMER_PROPERTIES                  "properties"
 #define K_TIME_UNIT                         "precision"
@@ -140,6 +144,6 @@
  */
 
 #define K_SUPPORTED_VALUES_BOUNDARY_MANAGER "[ none | random | sponge | cpml ]"
-#define K_SUPPORTED_VALUES_FORWARD_COLLECTOR "[ two | three ]"
+#define K_SUPPORTED_VALUES_FORWARD_COLLECTOR "[ two | three | checkpoint ]"
 
 #endif //SEISMIC_TOOLBOX_GENERATORS_KEYS_H
@@ -34,6 +34,9 @@ namespace stbx {
             int front_win = DEF_VAL;
             int back_win = DEF_VAL;
             int depth_win = DEF_VAL;
+            int adaptive = 0;
+            int aperture = 0;
+            float aperture_angle = 0;
         };
 
         struct StencilOrder {
@@ -61,6 +64,8 @@ namespace stbx {
 
             int GetBlock(const std::string &direction);
 
+            int GetTemporalBlock();
+
             int GetIsotropicCircle();
 
 
@@ -18,6 +18,7 @@
  */
 
 #include <cstdlib>
+#include <mutex>
 #include <unordered_map>
 
 #include <bs/base/memory/managers/memory_allocator.h>
@@ -38,6 +39,11 @@ namespace bs {
  */
             static unordered_map<void *, void *> base_pointers;
 
+/**
+ * @brief Guards base_pointers, as memory may be allocated and freed from several threads.
+ */
+            static mutex base_pointers_mutex;
+
             void *mem_allocate(const unsigned long long size_of_type,
                                const unsigned long long number_of_elements, const string &name) {
                 return mem_allocate(size_of_type, number_of_elements, name, 0);
@@ -117,7 +123,10 @@ namespace bs {
                  * starts alignment at the inner domain and the value is ptr_base which is
                  * aligned and start alignment at the half_length_padding
                  */
-                base_pointers[ptr] = ptr_base;
+                {
+                    lock_guard<mutex> lock(base_pointers_mutex);
+                    base_pointers[ptr] = ptr_base;
+                }
 
                 // return the ptr: aligned pointer that start alignment at the inner domain
                 // which is the key of the global unordered map base_pointers
@@ -133,7 +142,16 @@ namespace bs {
                 // that ptr_base points to
                 // and make org_ptr point to the same address so now ptr_base and org_ptr
                 // points to the same address
-                void *org_ptr = base_pointers[ptr];
+                void *org_ptr;
+                {
+                    lock_guard<mutex> lock(base_pointers_mutex);
+                    auto entry = base_pointers.find(ptr);
+                    if (entry == base_pointers.end()) {
+                        return;
+                    }
+                    org_ptr = entry->second;
+                    base_pointers.erase(entry);
+                }
 
 #ifndef __INTEL_COMPILER
                 // if the intel compiler is not defined free the org_ptr
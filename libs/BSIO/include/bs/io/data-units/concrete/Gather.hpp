@@ -177,7 +177,47 @@ namespace bs {
                 }
 
                 /**
-                 * @brief Sort Gather function, using custom compare function.
+                 * @brief RemoveTraces function, removes all the flagged traces in a
+                 * single pass, keeping the order of the remaining ones.
+                 *
+                 * @param[in] aRemoved
+                 * Flag for each trace of the gather, set for the traces to remove.
+                 */
+                void
+                RemoveTraces(const std::vector<bool> &aRemoved);
+
+                /**
+                 * @brief Gets the values of a trace header for all the gather traces,
+                 * in the traces order.
+                 *
+                 * @param[in] aTraceHeaderKey.
+                 *
+                 * @return Numeric column of the trace header values.
+                 */
+                template<typename T>
+                inline std::vector<T>
+                GetTraceHeaderColumn(TraceHeaderKey aTraceHeaderKey) const {
+                    std::vector<T> column(this->mTraces.size());
+                    for (size_t i = 0; i < this->mTraces.size(); i++) {
+                        column[i] = this->mTraces[i]->GetTraceHeaderKeyValue<T>(aTraceHeaderKey);
+                    }
+                    return column;
+                }
+
+                /**
+                 * @brief Gets the scaled coordinate header for all the gather traces,
+                 * in the traces order.
+                 *
+                 * @param[in] aTraceHeaderKey.
+                 *
+                 * @return Column of the scaled coordinates.
+                 */
+                std::vector<float>
+                GetScaledCoordinateColumn(TraceHeaderKey aTraceHeaderKey) const;
+
+                /**
+                 * @brief Sort Gather function, sorting on the numeric columns
+                 * of the sorting keys.
                  */
                 void
                 SortGather(const std::vector<std::pair<TraceHeaderKey, Gather::SortDirection>> &aSortingKeys);
@@ -20,11 +20,11 @@
 #ifndef BS_IO_DATA_UNITS_TRACE_HPP
 #define BS_IO_DATA_UNITS_TRACE_HPP
 
-#include <unordered_map>
+#include <bitset>
 #include <memory>
-#include <sstream>
-
-#include <bs/base/common/assertions.h>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include <bs/io/data-units/data-types/TraceHeaderKey.hpp>
 
@@ -32,7 +32,8 @@ namespace bs {
     namespace io {
         namespace dataunits {
             /**
-             * @brief Trace Object contains TraceHeaderKey represented as a map.
+             * @brief Trace Object contains its trace headers as typed numeric values,
+             * one slot per TraceHeaderKey, and its trace data.
              */
             class Trace {
             public:
@@ -68,18 +69,17 @@ namespace bs {
                  *
                  * @param[in] aTraceHeaderKey.
                  *
-                 * @return Trace Header Value if available, else find() will
-                 * point to the end of map.
+                 * @return Trace Header Value if available, else zero.
                  */
                 template<typename T>
                 inline T
-                GetTraceHeaderKeyValue(TraceHeaderKey aTraceHeaderKey) {
-                    ASSERT_T_TEMPLATE(T);
-                    std::stringstream ss;
-                    ss << this->mTraceHeaderMap[aTraceHeaderKey];
-                    T trace_header_value;
-                    ss >> trace_header_value;
-                    return trace_header_value;
+                GetTraceHeaderKeyValue(TraceHeaderKey aTraceHeaderKey) const {
+                    static_assert(std::is_arithmetic<T>::value, "T type is not compatible");
+                    double value = this->mTraceHeaderValues[aTraceHeaderKey.GetKey()];
+                    if (std::is_integral<T>::value) {
+                        return static_cast<T>(static_cast<long long>(value));
+                    }
+                    return static_cast<T>(value);
                 }
 
                 /**
@@ -92,15 +92,35 @@ namespace bs {
                  * @return
                  * True if an entry exists for it.
                  */
-                bool
-                HasTraceHeader(TraceHeaderKey aTraceHeaderKey) {
-                    return this->mTraceHeaderMap.find(aTraceHeaderKey) != this->mTraceHeaderMap.end();
+                inline bool
+                HasTraceHeader(TraceHeaderKey aTraceHeaderKey) const {
+                    return this->mHasTraceHeader[aTraceHeaderKey.GetKey()];
                 }
 
-                const std::unordered_map<TraceHeaderKey, std::string> *
-                GetTraceHeaders() {
-                    return &this->mTraceHeaderMap;
-                }
+                /**
+                 * @brief Getter for the keys of all the set trace headers.
+                 */
+                std::vector<TraceHeaderKey>
+                GetTraceHeaderKeys() const;
+
+                /**
+                 * @brief Getter for the Trace Header Value in its string representation,
+                 * i.e. the one used to build the gather and index keys.
+                 *
+                 * @param[in] aTraceHeaderKey.
+                 */
+                std::string
+                GetTraceHeaderKeyString(TraceHeaderKey aTraceHeaderKey) const;
+
+                /**
+                 * @brief Copies all the set trace headers of the given trace,
+                 * overriding the already set ones.
+                 *
+                 * @param[in] aTrace
+                 * Trace to copy the headers from.
+                 */
+                void
+                CopyTraceHeaders(const Trace &aTrace);
 
                 /**
                  * @brief Setter for the Trace Header Value.
@@ -114,8 +134,11 @@ namespace bs {
                 template<typename T>
                 inline void
                 SetTraceHeaderKeyValue(TraceHeaderKey aTraceHeaderKey, T aValue) {
-                    ASSERT_T_TEMPLATE(T);
-                    this->mTraceHeaderMap[aTraceHeaderKey] = std::to_string(aValue);
+                    static_assert(std::is_arithmetic<T>::value, "T type is not compatible");
+                    auto key = aTraceHeaderKey.GetKey();
+                    this->mTraceHeaderValues[key] = static_cast<double>(aValue);
+                    this->mHasTraceHeader[key] = true;
+                    this->mIsFloatingTraceHeader[key] = std::is_floating_point<T>::value;
                 }
 
                 /**
@@ -142,9 +165,8 @@ namespace bs {
                  * @return Number of samples value.
                  */
                 inline unsigned short
-                GetNumberOfSamples() {
-                    TraceHeaderKey trace_header_key(TraceHeaderKey::NS);
-                    return this->GetTraceHeaderKeyValue<unsigned short>(trace_header_key);
+                GetNumberOfSamples() const {
+                    return this->GetTraceHeaderKeyValue<unsigned short>(TraceHeaderKey::NS);
                 }
 
                 /**
@@ -160,13 +182,16 @@ namespace bs {
                  * @return Source Location.
                  */
                 float
-                GetScaledCoordinateHeader(TraceHeaderKey aKey);
+                GetScaledCoordinateHeader(TraceHeaderKey aKey) const;
 
             private:
-                /// @brief TraceHeaderKey, containing trace headers and their corresponding value.
-                /// @key TraceHeaderKey
-                /// @value string
-                std::unordered_map<TraceHeaderKey, std::string> mTraceHeaderMap;
+                /// @brief Trace header values indexed by TraceHeaderKey::Key. Doubles hold
+                /// any of the SEG-Y header fields exactly.
+                double mTraceHeaderValues[TraceHeaderKey::KEYS_COUNT];
+                /// @brief Whether each trace header is set.
+                std::bitset<TraceHeaderKey::KEYS_COUNT> mHasTraceHeader;
+                /// @brief Whether each trace header was set from a floating point value.
+                std::bitset<TraceHeaderKey::KEYS_COUNT> mIsFloatingTraceHeader;
 
                 /// @brief TraceData, containing trace data.
                 std::unique_ptr<float[]> mpTraceData;
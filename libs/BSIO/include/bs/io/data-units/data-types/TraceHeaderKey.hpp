@@ -147,6 +147,9 @@ namespace bs {
                     DATA_BYTE_OFFSET,
                 };
 
+                /// Number of the available trace header keys.
+                static constexpr int KEYS_COUNT = DATA_BYTE_OFFSET + 1;
+
             public:
                 /**
                  * @brief Trace Header constructor.
@@ -21,7 +21,12 @@
 #define BS_IO_INDEXERS_FILE_INDEXER_HPP
 
 #include <string>
+#include <vector>
+#include <unordered_map>
+#include <utility>
 
+#include <bs/io/lookups/mappers/HeaderMapper.hpp>
+#include <bs/io/lookups/tables/TraceHeaderLookup.hpp>
 #include <bs/io/streams/helpers/InStreamHelper.hpp>
 #include <bs/io/streams/helpers/OutStreamHelper.hpp>
 #include <bs/io/indexers/IndexMap.hpp>
@@ -30,6 +35,16 @@ namespace bs {
     namespace io {
         namespace indexers {
 
+            /**
+             * @brief
+             * Indexes a SEG-Y file on the given trace header keys, and caches the index
+             * next to it in a versioned binary format validated against the indexed file
+             * size and modification time.
+             *
+             * @note
+             * Files with fixed length traces are scanned by multiple threads, each on its
+             * own chunk of traces, when the file is memory mapped.
+             */
             class FileIndexer {
             public:
                 /**
@@ -70,6 +85,15 @@ namespace bs {
                 indexers::IndexMap
                 Index(const std::vector<dataunits::TraceHeaderKey> &aTraceHeaderKeys);
 
+                /**
+                 * @brief Sets the number of threads used to scan the file.
+                 * Defaults to the hardware concurrency.
+                 */
+                inline void
+                SetThreadsCount(unsigned int aThreadsCount) {
+                    this->mThreadsCount = aThreadsCount > 0 ? aThreadsCount : 1;
+                }
+
                 /**
                  * @brief Index Map getter.
                  * @return IndexMap object.
@@ -87,10 +111,52 @@ namespace bs {
                 static std::string
                 GenerateOutFilePathName(std::string &aInFileName, std::string &aKey);
 
+                /**
+                 * @brief Builds the gather value string of the trace header keys
+                 * for the given trace header.
+                 */
+                static std::string
+                GetGatherValue(const lookups::TraceHeaderLookup &aTraceHeaderLookup,
+                               const std::vector<dataunits::TraceHeaderKey> &aTraceHeaderKeys,
+                               std::unordered_map<dataunits::TraceHeaderKey::Key,
+                                       std::pair<size_t, lookups::NATIVE_TYPE>> &aLocationTable);
+
+                /**
+                 * @brief Scans the trace headers one after the other, starting from the first trace.
+                 */
                 void
-                StoreMapToFile(const std::vector<dataunits::TraceHeaderKey> &aTraceHeaderKeys);
+                ScanTraceHeaders(const std::string &aKey,
+                                 const std::vector<dataunits::TraceHeaderKey> &aTraceHeaderKeys,
+                                 std::unordered_map<dataunits::TraceHeaderKey::Key,
+                                         std::pair<size_t, lookups::NATIVE_TYPE>> &aLocationTable);
+
+                /**
+                 * @brief Scans the trace headers by chunks of traces in parallel, assuming all
+                 * traces have the same length as the first one.
+                 *
+                 * @return False if the file is not eligible or a trace of a different length
+                 * is met, in which case nothing is added to the index map.
+                 */
+                bool
+                ScanTraceHeadersParallel(const std::string &aKey,
+                                         const std::vector<dataunits::TraceHeaderKey> &aTraceHeaderKeys,
+                                         std::unordered_map<dataunits::TraceHeaderKey::Key,
+                                                 std::pair<size_t, lookups::NATIVE_TYPE>> &aLocationTable);
 
+                /**
+                 * @brief Gets the size and modification time of the indexed file.
+                 */
                 void
+                GetInFileStatus(uint64_t &aSize, int64_t &aModificationTime);
+
+                void
+                StoreMapToFile(const std::vector<dataunits::TraceHeaderKey> &aTraceHeaderKeys);
+
+                /**
+                 * @return False if the index file is of an unknown format or version,
+                 * or does not correspond to the current state of the indexed file.
+                 */
+                bool
                 LoadMapFromFile(streams::helpers::InStreamHelper *aInStreamHelper,
                                 const std::vector<dataunits::TraceHeaderKey> &aTraceHeaderKeys);
 
@@ -104,6 +170,8 @@ namespace bs {
                 /// Index map, having trace header key as key and vector of byte positions
                 /// in file corresponding to this trace header key.
                 indexers::IndexMap mIndexMap;
+                /// Number of threads used to scan the file.
+                unsigned int mThreadsCount;
             };
 
         } //namespace indexers
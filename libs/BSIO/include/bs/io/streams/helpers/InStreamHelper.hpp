@@ -37,8 +37,21 @@ namespace bs {
                 /**
                  * @brief File helper to take any stream and helps manipulate or get any regarded
                  * meta data from it.
+                 *
+                 * @note The file is memory mapped when possible, so headers and samples are
+                 * decoded directly out of the mapping. The stream is only used as a fallback.
                  */
                 class InStreamHelper {
+                public:
+                    /**
+                     * @brief Expected access pattern of the mapped file, used as a hint
+                     * for the kernel read ahead.
+                     */
+                    enum AccessPattern {
+                        SEQUENTIAL,
+                        RANDOM
+                    };
+
                 public:
                     /**
                      * @brief Explicit constructor.
@@ -88,6 +101,35 @@ namespace bs {
                     unsigned char *
                     ReadBytesBlock(size_t aStartPosition, size_t aBlockSize);
 
+                    /**
+                     * @brief Reads a block of bytes from current stream into a given buffer.
+                     *
+                     * @param[in] aStartPosition
+                     * @param[in] aBlockSize
+                     * @param[out] apDestination
+                     */
+                    void
+                    ReadBytesBlock(size_t aStartPosition, size_t aBlockSize, void *apDestination);
+
+                    /**
+                     * @brief Gets a block of bytes directly from the file mapping, without any copy.
+                     *
+                     * @param[in] aStartPosition
+                     * @param[in] aBlockSize
+                     * @return const unsigned char *, nullptr if the file is not mapped.
+                     */
+                    const unsigned char *
+                    GetMappedBytesBlock(size_t aStartPosition, size_t aBlockSize);
+
+                    /**
+                     * @brief Gives the kernel a hint on how the file is going to be accessed.
+                     * Does nothing if the file is not mapped.
+                     *
+                     * @param[in] aAccessPattern
+                     */
+                    void
+                    Advise(AccessPattern aAccessPattern);
+
                     /**
                      * @brief Reads a text header, be it the original text header or the extended text header
                      * from a given SEG-Y file, by passing the start byte position of it.
@@ -161,6 +203,8 @@ namespace bs {
                     std::ifstream mInStream;
                     /// File size.
                     size_t mFileSize;
+                    /// File mapping, nullptr if the file couldn't be mapped.
+                    unsigned char *mpMappedFile;
                 };
 
             } //namespace helpers
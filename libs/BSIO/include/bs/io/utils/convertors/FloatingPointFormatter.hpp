@@ -44,6 +44,21 @@ namespace bs {
                     static int
                     GetFloatArrayRealSize(unsigned short int aSamplesNumber, unsigned short int aFormatCode);
 
+                    /**
+                     * @brief Converts the samples of a trace from the given SEG-Y format code to native
+                     * floating numbers, or the other way around. Supported format codes are 1 (IBM float),
+                     * 2 (4 byte integer), 3 (2 byte integer), 5 (IEEE float) and 8 (1 byte integer).
+                     *
+                     * @param[in] apSrc
+                     * @param[out] apDest
+                     * @param[in] aSrcSize
+                     * Size of the source in bytes.
+                     * @param[in] aSamplesNumber
+                     * @param[in] aFormat
+                     * @param[in] aFromFormat
+                     * True to convert from the format to native floats, false for the other way around.
+                     * @return Flag. 1 if success and 0 if conversion failed.
+                     */
                     static int
                     Format(const char *apSrc, char *apDest,
                            size_t aSrcSize, size_t aSamplesNumber, short aFormat,
@@ -74,44 +89,95 @@ namespace bs {
                     ToIBM(const char *apSrc, char *apDest, size_t aSrcSize, size_t aSamplesNumber);
 
                     /**
-                     * @brief Converts between 64 bit IBM floating numbers to native floating number.
+                     * @brief Converts big endian 4 byte two's complement integers to native floating numbers.
                      * @param[in] apSrc
                      * @param[out] apDest
                      * @param[in] aSize
+                     * @param[in] aSamplesNumber
                      * @return Flag. 1 if success and 0 if conversion failed.
                      */
                     static int
                     FromLong(const char *apSrc, char *apDest, size_t aSize, size_t aSamplesNumber);
 
                     /**
-                     * @brief Converts between 8 bit IBM floating numbers to native floating number.
+                     * @brief Converts native floating numbers to big endian 4 byte two's complement integers,
+                     * rounded to the nearest integer and saturated.
+                     * @param[in] apSrc
+                     * @param[out] apDest
+                     * @param[in] aSize
+                     * @param[in] aSamplesNumber
+                     * @return Flag. 1 if success and 0 if conversion failed.
+                     */
+                    static int
+                    ToLong(const char *apSrc, char *apDest, size_t aSize, size_t aSamplesNumber);
+
+                    /**
+                     * @brief Converts big endian 2 byte two's complement integers to native floating numbers.
                      * @param[in] apSrc
                      * @param[out] apDest
                      * @param[in] aSize
+                     * @param[in] aSamplesNumber
                      * @return Flag. 1 if success and 0 if conversion failed.
                      */
                     static int
                     FromShort(const char *apSrc, char *apDest, size_t aSize, size_t aSamplesNumber);
 
                     /**
-                     * @brief Converts between 8 bit IEEE and IEEE floating numbers.
+                     * @brief Converts native floating numbers to big endian 2 byte two's complement integers,
+                     * rounded to the nearest integer and saturated.
                      * @param[in] apSrc
                      * @param[out] apDest
                      * @param[in] aSize
+                     * @param[in] aSamplesNumber
+                     * @return Flag. 1 if success and 0 if conversion failed.
+                     */
+                    static int
+                    ToShort(const char *apSrc, char *apDest, size_t aSize, size_t aSamplesNumber);
+
+                    /**
+                     * @brief Converts big endian 32 bit IEEE floating numbers to native floating numbers.
+                     * @param[in] apSrc
+                     * @param[out] apDest
+                     * @param[in] aSize
+                     * @param[in] aSamplesNumber
                      * @return Flag. 1 if success and 0 if conversion failed.
                      */
                     static int
                     FromIEEE(const char *apSrc, char *apDest, size_t aSize, size_t aSamplesNumber);
 
                     /**
-                     * @brief Converts between 8 bit character and IEEE floating numbers.
+                     * @brief Converts native floating numbers to big endian 32 bit IEEE floating numbers.
                      * @param[in] apSrc
                      * @param[out] apDest
                      * @param[in] aSize
+                     * @param[in] aSamplesNumber
+                     * @return Flag. 1 if success and 0 if conversion failed.
+                     */
+                    static int
+                    ToIEEE(const char *apSrc, char *apDest, size_t aSize, size_t aSamplesNumber);
+
+                    /**
+                     * @brief Converts 1 byte two's complement integers to native floating numbers.
+                     * @param[in] apSrc
+                     * @param[out] apDest
+                     * @param[in] aSize
+                     * @param[in] aSamplesNumber
                      * @return Flag. 1 if success and 0 if conversion failed.
                      */
                     static int
                     FromChar(const char *apSrc, char *apDest, size_t aSize, size_t aSamplesNumber);
+
+                    /**
+                     * @brief Converts native floating numbers to 1 byte two's complement integers,
+                     * rounded to the nearest integer and saturated.
+                     * @param[in] apSrc
+                     * @param[out] apDest
+                     * @param[in] aSize
+                     * @param[in] aSamplesNumber
+                     * @return Flag. 1 if success and 0 if conversion failed.
+                     */
+                    static int
+                    ToChar(const char *apSrc, char *apDest, size_t aSize, size_t aSamplesNumber);
                 };
             } //namespace convertors
         } //namespace utils
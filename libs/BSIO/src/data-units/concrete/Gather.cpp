@@ -20,6 +20,7 @@
 #include <vector>
 #include <utility>
 #include <algorithm>
+#include <numeric>
 #include <unordered_map>
 
 #include <bs/io/data-units/concrete/Gather.hpp>
@@ -52,11 +53,59 @@ Gather::Gather(std::unordered_map<TraceHeaderKey, std::string> &aUniqueKeys)
     this->mUniqueKeys = std::move(aUniqueKeys);
 }
 
+std::vector<float>
+Gather::GetScaledCoordinateColumn(TraceHeaderKey aTraceHeaderKey) const {
+    std::vector<float> column(this->mTraces.size());
+    for (size_t i = 0; i < this->mTraces.size(); i++) {
+        column[i] = this->mTraces[i]->GetScaledCoordinateHeader(aTraceHeaderKey);
+    }
+    return column;
+}
+
+void
+Gather::RemoveTraces(const std::vector<bool> &aRemoved) {
+    size_t kept = 0;
+    for (size_t i = 0; i < this->mTraces.size(); i++) {
+        if (aRemoved[i]) {
+            delete this->mTraces[i];
+        } else {
+            this->mTraces[kept++] = this->mTraces[i];
+        }
+    }
+    this->mTraces.resize(kept);
+}
+
 void
 Gather::SortGather(const std::vector<std::pair<TraceHeaderKey, Gather::SortDirection>> &aSortingKeys) {
-    if (!aSortingKeys.empty()) {
-        sort(this->mTraces.begin(), this->mTraces.end(), trace_compare_t(aSortingKeys));
+    if (aSortingKeys.empty()) {
+        return;
+    }
+    /* Extract the sorting keys columns once, then sort the traces order on them. */
+    std::vector<std::vector<double>> columns;
+    columns.reserve(aSortingKeys.size());
+    for (auto &sorting_key : aSortingKeys) {
+        columns.push_back(this->GetTraceHeaderColumn<double>(sorting_key.first));
+    }
+    std::vector<size_t> order(this->mTraces.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t aFirst, size_t aSecond) {
+        for (size_t i = 0; i < columns.size(); i++) {
+            double first = columns[i][aFirst];
+            double second = columns[i][aSecond];
+            if (first != second) {
+                if (aSortingKeys[i].second == Gather::SortDirection::ASC) {
+                    return first < second;
+                }
+                return first > second;
+            }
+        }
+        return false;
+    });
+    std::vector<Trace *> traces(this->mTraces.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        traces[i] = this->mTraces[order[i]];
     }
+    this->mTraces.swap(traces);
 }
 
 trace_compare_t::trace_compare_t(
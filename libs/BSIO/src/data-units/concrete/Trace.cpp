@@ -17,29 +17,71 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <iterator>
+
 #include <bs/io/data-units/concrete/Trace.hpp>
 
 using namespace bs::io::dataunits;
 
 
-Trace::Trace(const unsigned short aNS) {
-    this->mTraceHeaderMap[TraceHeaderKey(TraceHeaderKey::NS)] = std::to_string(aNS);
+Trace::Trace(const unsigned short aNS)
+        : mTraceHeaderValues() {
+    this->SetTraceHeaderKeyValue(TraceHeaderKey::NS, aNS);
 }
 
 Trace::Trace(Trace &&aTrace) noexcept
-        : mpTraceData(std::move(aTrace.mpTraceData)) {}
+        : mHasTraceHeader(aTrace.mHasTraceHeader),
+          mIsFloatingTraceHeader(aTrace.mIsFloatingTraceHeader),
+          mpTraceData(std::move(aTrace.mpTraceData)) {
+    std::copy(std::begin(aTrace.mTraceHeaderValues), std::end(aTrace.mTraceHeaderValues),
+              std::begin(this->mTraceHeaderValues));
+}
 
-Trace::Trace(const Trace &aTrace) {}
+Trace::Trace(const Trace &aTrace)
+        : mTraceHeaderValues() {}
 
 Trace::~Trace() = default;
 
 Trace &
 Trace::operator=(Trace &&aTrace) noexcept {
-    this->mTraceHeaderMap = aTrace.mTraceHeaderMap;
+    this->CopyTraceHeaders(aTrace);
     this->mpTraceData = std::move(aTrace.mpTraceData);
     return *this;
 }
 
+std::vector<TraceHeaderKey>
+Trace::GetTraceHeaderKeys() const {
+    std::vector<TraceHeaderKey> keys;
+    for (int key = 0; key < TraceHeaderKey::KEYS_COUNT; key++) {
+        if (this->mHasTraceHeader[key]) {
+            keys.emplace_back(static_cast<TraceHeaderKey::Key>(key));
+        }
+    }
+    return keys;
+}
+
+std::string
+Trace::GetTraceHeaderKeyString(TraceHeaderKey aTraceHeaderKey) const {
+    auto key = aTraceHeaderKey.GetKey();
+    if (this->mIsFloatingTraceHeader[key]) {
+        return std::to_string(this->mTraceHeaderValues[key]);
+    }
+    return std::to_string(static_cast<long long>(this->mTraceHeaderValues[key]));
+}
+
+void
+Trace::CopyTraceHeaders(const Trace &aTrace) {
+    for (int key = 0; key < TraceHeaderKey::KEYS_COUNT; key++) {
+        if (aTrace.mHasTraceHeader[key]) {
+            this->mTraceHeaderValues[key] = aTrace.mTraceHeaderValues[key];
+        }
+    }
+    this->mHasTraceHeader |= aTrace.mHasTraceHeader;
+    this->mIsFloatingTraceHeader &= ~aTrace.mHasTraceHeader;
+    this->mIsFloatingTraceHeader |= aTrace.mIsFloatingTraceHeader;
+}
+
 void
 Trace::SetScaledCoordinateHeader(TraceHeaderKey aKey, float aLocation) {
     float scale_coordinate = 0;
@@ -49,18 +91,18 @@ Trace::SetScaledCoordinateHeader(TraceHeaderKey aKey, float aLocation) {
     if (scale_coordinate == 0) {
         scale_coordinate = 1;
     }
-    uint32_t val;
+    int32_t val;
     if (scale_coordinate > 0) {
-        val = (uint32_t) (aLocation / scale_coordinate);
+        val = (int32_t) (aLocation / scale_coordinate);
     } else {
         scale_coordinate *= -1;
-        val = (uint32_t) (aLocation * scale_coordinate);
+        val = (int32_t) (aLocation * scale_coordinate);
     }
     this->SetTraceHeaderKeyValue(aKey, val);
 }
 
 float
-Trace::GetScaledCoordinateHeader(TraceHeaderKey aKey) {
+Trace::GetScaledCoordinateHeader(TraceHeaderKey aKey) const {
     float scale_coordinate = 0;
     if (this->HasTraceHeader(TraceHeaderKey::SCALCO)) {
         scale_coordinate = this->GetTraceHeaderKeyValue<int16_t>(TraceHeaderKey::SCALCO);
@@ -70,10 +112,10 @@ Trace::GetScaledCoordinateHeader(TraceHeaderKey aKey) {
     }
     float val;
     if (scale_coordinate > 0) {
-        val = (float) this->GetTraceHeaderKeyValue<uint32_t>(aKey) * scale_coordinate;
+        val = (float) this->GetTraceHeaderKeyValue<int32_t>(aKey) * scale_coordinate;
     } else {
         scale_coordinate *= -1;
-        val = (float) this->GetTraceHeaderKeyValue<uint32_t>(aKey) / scale_coordinate;
+        val = (float) this->GetTraceHeaderKeyValue<int32_t>(aKey) / scale_coordinate;
     }
     return val;
 }
@@ -18,6 +18,10 @@
  */
 
 #include <iostream>
+#include <cstring>
+#include <thread>
+
+#include <sys/stat.h>
 
 #include <bs/base/exceptions/Exceptions.hpp>
 
@@ -36,7 +40,8 @@ using namespace bs::io::utils::convertors;
 FileIndexer::FileIndexer(std::string &aFilePath,
                          std::string &aKey)
         : mInFilePath(aFilePath),
-          mOutFilePath(GenerateOutFilePathName(aFilePath, aKey)) {
+          mOutFilePath(GenerateOutFilePathName(aFilePath, aKey)),
+          mThreadsCount(std::max(1u, std::thread::hardware_concurrency())) {
     this->mInStreamHelper = nullptr;
 }
 
@@ -64,12 +69,16 @@ FileIndexer::GenerateOutFilePathName(std::string &aInFileName,
            + IO_K_EXT_SGY_INDEX;
 }
 
+/// Index file format identifier and version.
+#define IO_INDEX_MAGIC              "BSIOIDX"
+#define IO_INDEX_VERSION            1
+/// Minimum number of traces scanned by a thread.
+#define IO_INDEX_MIN_CHUNK          1024
+
 IndexMap
 FileIndexer::Index(const std::vector<TraceHeaderKey> &aTraceHeaderKeys) {
 
     std::string key = TraceHeaderKey::GatherKeysToString(aTraceHeaderKeys);
-    std::string expected_file_path = GenerateOutFilePathName(this->mInFilePath,
-                                                             key);
     auto in = new InStreamHelper(this->mOutFilePath);
     bool already_indexed = true;
     try {
@@ -77,148 +86,301 @@ FileIndexer::Index(const std::vector<TraceHeaderKey> &aTraceHeaderKeys) {
     } catch (FileNotFoundException &e) {
         already_indexed = false;
     }
-
+    if (already_indexed) {
+        /** load index map, an outdated or foreign index is rebuilt */
+        already_indexed = LoadMapFromFile(in, aTraceHeaderKeys);
+        in->Close();
+        if (!already_indexed) {
+            this->mIndexMap.Reset();
+        }
+    }
 
     if (!already_indexed) {
-        /* Read binary header in the given file.*/
-        auto bhl = this->mInStreamHelper->ReadBinaryHeader(IO_POS_S_BINARY_HEADER);
-        unsigned long long file_size = this->mInStreamHelper->GetFileSize();
-        size_t start_pos = IO_POS_S_TRACE_HEADER;
-        while (true) {
-            if (start_pos + IO_SIZE_TRACE_HEADER >= file_size) {
-                break;
-            }
-            /* Read trace header in the given file. */
-            auto thl = this->mInStreamHelper->ReadTraceHeader(start_pos);
-
-            std::unordered_map<dataunits::TraceHeaderKey::Key,
-                    std::pair<size_t, NATIVE_TYPE>> location_table;
-            for (const auto &thk :aTraceHeaderKeys) {
-                TraceHeaderKey trh = thk;
-                dataunits::TraceHeaderKey::Key k = trh.GetKey();
-                std::pair<size_t, NATIVE_TYPE> offset_type = SegyHeaderMapper::mLocationTable[k];
-                location_table[k] = offset_type;
-            }
-            Trace trace(0);
-            HeaderMapper::MapHeaderToTrace(
-                    (const char *) &thl, trace, location_table, true);
-            auto &map = *trace.GetTraceHeaders();
-            std::vector<std::string> values;
-            values.reserve(aTraceHeaderKeys.size());
-            for (const auto &it : aTraceHeaderKeys) {
-                values.push_back(map.find(it)->second);
-            }
-            std::string value = TraceHeaderKey::GatherValuesToString(values);
-            this->mIndexMap.Add(key, value, start_pos);
-
-            /* Update stream position pointer. */
-            start_pos += IO_SIZE_TRACE_HEADER + InStreamHelper::GetTraceDataSize(thl, bhl);
+        std::unordered_map<dataunits::TraceHeaderKey::Key,
+                std::pair<size_t, NATIVE_TYPE>> location_table;
+        for (const auto &thk :aTraceHeaderKeys) {
+            TraceHeaderKey trh = thk;
+            dataunits::TraceHeaderKey::Key k = trh.GetKey();
+            std::pair<size_t, NATIVE_TYPE> offset_type = SegyHeaderMapper::mLocationTable[k];
+            location_table[k] = offset_type;
+        }
+        if (!this->ScanTraceHeadersParallel(key, aTraceHeaderKeys, location_table)) {
+            this->ScanTraceHeaders(key, aTraceHeaderKeys, location_table);
         }
         /** store index map */
         StoreMapToFile(aTraceHeaderKeys);
-    } else {
-        /** load index map */
-        LoadMapFromFile(in, aTraceHeaderKeys);
-        in->Close();
     }
     delete in;
     return this->mIndexMap;
 }
 
+std::string
+FileIndexer::GetGatherValue(const TraceHeaderLookup &aTraceHeaderLookup,
+                            const std::vector<TraceHeaderKey> &aTraceHeaderKeys,
+                            std::unordered_map<dataunits::TraceHeaderKey::Key,
+                                    std::pair<size_t, NATIVE_TYPE>> &aLocationTable) {
+    Trace trace(0);
+    HeaderMapper::MapHeaderToTrace(
+            (const char *) &aTraceHeaderLookup, trace, aLocationTable, true);
+    std::vector<std::string> values;
+    values.reserve(aTraceHeaderKeys.size());
+    for (const auto &it : aTraceHeaderKeys) {
+        values.push_back(trace.GetTraceHeaderKeyString(it));
+    }
+    return TraceHeaderKey::GatherValuesToString(values);
+}
+
+void
+FileIndexer::ScanTraceHeaders(const std::string &aKey,
+                              const std::vector<TraceHeaderKey> &aTraceHeaderKeys,
+                              std::unordered_map<dataunits::TraceHeaderKey::Key,
+                                      std::pair<size_t, NATIVE_TYPE>> &aLocationTable) {
+    /* Headers are scanned once from start to end. */
+    this->mInStreamHelper->Advise(InStreamHelper::SEQUENTIAL);
+    /* Read binary header in the given file.*/
+    auto bhl = this->mInStreamHelper->ReadBinaryHeader(IO_POS_S_BINARY_HEADER);
+    unsigned long long file_size = this->mInStreamHelper->GetFileSize();
+    size_t start_pos = IO_POS_S_TRACE_HEADER;
+    while (true) {
+        if (start_pos + IO_SIZE_TRACE_HEADER >= file_size) {
+            break;
+        }
+        /* Read trace header in the given file. */
+        auto thl = this->mInStreamHelper->ReadTraceHeader(start_pos);
+        this->mIndexMap.Add(aKey, GetGatherValue(thl, aTraceHeaderKeys, aLocationTable), start_pos);
+
+        /* Update stream position pointer. */
+        start_pos += IO_SIZE_TRACE_HEADER + InStreamHelper::GetTraceDataSize(thl, bhl);
+    }
+}
+
+bool
+FileIndexer::ScanTraceHeadersParallel(const std::string &aKey,
+                                      const std::vector<TraceHeaderKey> &aTraceHeaderKeys,
+                                      std::unordered_map<dataunits::TraceHeaderKey::Key,
+                                              std::pair<size_t, NATIVE_TYPE>> &aLocationTable) {
+    unsigned long long file_size = this->mInStreamHelper->GetFileSize();
+    /* Concurrent reads are only safe out of the file mapping. */
+    if (this->mThreadsCount < 2 ||
+        file_size <= IO_POS_S_TRACE_HEADER + IO_SIZE_TRACE_HEADER ||
+        this->mInStreamHelper->GetMappedBytesBlock(IO_POS_S_TRACE_HEADER, IO_SIZE_TRACE_HEADER) == nullptr) {
+        return false;
+    }
+    auto bhl = this->mInStreamHelper->ReadBinaryHeader(IO_POS_S_BINARY_HEADER);
+    auto first_thl = this->mInStreamHelper->ReadTraceHeader(IO_POS_S_TRACE_HEADER);
+    size_t data_size = InStreamHelper::GetTraceDataSize(first_thl, bhl);
+    size_t trace_size = IO_SIZE_TRACE_HEADER + data_size;
+    /* Same trace count the sequential scan would reach. */
+    size_t traces_count = (file_size - IO_POS_S_TRACE_HEADER - IO_SIZE_TRACE_HEADER - 1) / trace_size + 1;
+    size_t chunks_count = std::min((size_t) this->mThreadsCount, traces_count / IO_INDEX_MIN_CHUNK);
+    if (chunks_count < 2) {
+        return false;
+    }
+
+    std::vector<std::vector<std::pair<std::string, size_t>>> chunks(chunks_count);
+    std::vector<char> fixed_length(chunks_count, true);
+    std::vector<std::thread> workers;
+    workers.reserve(chunks_count);
+    for (size_t ic = 0; ic < chunks_count; ic++) {
+        workers.emplace_back([&, ic]() {
+            /* Each worker gets its own copy, as the lookup mutates the table. */
+            auto location_table = aLocationTable;
+            size_t begin = ic * traces_count / chunks_count;
+            size_t end = (ic + 1) * traces_count / chunks_count;
+            chunks[ic].reserve(end - begin);
+            for (size_t it = begin; it < end; it++) {
+                size_t start_pos = IO_POS_S_TRACE_HEADER + it * trace_size;
+                auto thl = this->mInStreamHelper->ReadTraceHeader(start_pos);
+                if (InStreamHelper::GetTraceDataSize(thl, bhl) != data_size) {
+                    fixed_length[ic] = false;
+                    return;
+                }
+                chunks[ic].emplace_back(GetGatherValue(thl, aTraceHeaderKeys, location_table), start_pos);
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    for (auto is_fixed : fixed_length) {
+        if (!is_fixed) {
+            return false;
+        }
+    }
+    /* Merge in chunks order to keep the byte positions sorted. */
+    for (auto &chunk : chunks) {
+        for (auto &entry : chunk) {
+            this->mIndexMap.Add(aKey, entry.first, entry.second);
+        }
+    }
+    return true;
+}
+
+void
+FileIndexer::GetInFileStatus(uint64_t &aSize, int64_t &aModificationTime) {
+    struct stat file_status{};
+    if (stat(this->mInFilePath.c_str(), &file_status) != 0) {
+        throw FILE_NOT_FOUND_EXCEPTION();
+    }
+    aSize = file_status.st_size;
+    aModificationTime = (int64_t) file_status.st_mtim.tv_sec * 1000000000 + file_status.st_mtim.tv_nsec;
+}
+
+/*
+ * Index file layout, all integers being 64 bits unless stated otherwise:
+ *
+ * magic (8 bytes) | version (32 bits) | reserved (32 bits) |
+ * indexed file size | indexed file modification time (ns) |
+ * key size | key | values count (N) | byte positions count (P) |
+ * values offsets (N + 1) | byte positions offsets (N + 1) |
+ * values | byte positions (P)
+ *
+ * Values are stored in their sorted order, and the byte positions of the i-th
+ * value are [positions offsets[i], positions offsets[i + 1]).
+ */
+
 void
 FileIndexer::StoreMapToFile(const std::vector<TraceHeaderKey> &aTraceHeaderKeys) {
 
     std::string key = TraceHeaderKey::GatherKeysToString(aTraceHeaderKeys);
-    auto out_helper = new OutStreamHelper(this->mOutFilePath);
-    out_helper->Open();
-    /** store length of IndexMap Key */
-    size_t key_size = key.size();
-    out_helper->WriteBytesBlock((const char *) &key_size, sizeof(size_t));
-    /** store index map key */
-    out_helper->WriteBytesBlock(key.c_str(), key_size);
 
     /** Get map of unique values and vector of byte positions */
-    std::map<std::string, std::vector<size_t>> unique_values_map = this->mIndexMap.Get(key);
-    /** store map size */
-    size_t map_size = unique_values_map.size();
-    out_helper->WriteBytesBlock((const char *) &map_size, sizeof(size_t));
+    std::map<std::string, std::vector<size_t>> &unique_values_map = this->mIndexMap.Get(key);
+    uint64_t values_count = unique_values_map.size();
+    std::vector<uint64_t> values_offsets(values_count + 1, 0);
+    std::vector<uint64_t> positions_offsets(values_count + 1, 0);
+    std::string values;
+    uint64_t i = 0;
+    for (const auto &it : unique_values_map) {
+        values += it.first;
+        values_offsets[i + 1] = values.size();
+        positions_offsets[i + 1] = positions_offsets[i] + it.second.size();
+        i++;
+    }
+    uint64_t positions_count = positions_offsets[values_count];
 
+    uint64_t in_file_size;
+    int64_t in_file_time;
+    this->GetInFileStatus(in_file_size, in_file_time);
+
+    /** Serialize the whole index to be written at once */
+    std::vector<char> buffer;
+    auto append = [&buffer](const void *apData, size_t aSize) {
+        buffer.insert(buffer.end(), (const char *) apData, (const char *) apData + aSize);
+    };
+    char magic[8] = IO_INDEX_MAGIC;
+    uint32_t version = IO_INDEX_VERSION;
+    uint32_t reserved = 0;
+    uint64_t key_size = key.size();
+    append(magic, sizeof(magic));
+    append(&version, sizeof(version));
+    append(&reserved, sizeof(reserved));
+    append(&in_file_size, sizeof(in_file_size));
+    append(&in_file_time, sizeof(in_file_time));
+    append(&key_size, sizeof(key_size));
+    append(key.data(), key_size);
+    append(&values_count, sizeof(values_count));
+    append(&positions_count, sizeof(positions_count));
+    append(values_offsets.data(), values_offsets.size() * sizeof(uint64_t));
+    append(positions_offsets.data(), positions_offsets.size() * sizeof(uint64_t));
+    append(values.data(), values.size());
     for (const auto &it : unique_values_map) {
-        /** store length of each unique key string */
-        size_t unique_key_size = it.first.size();
-        out_helper->WriteBytesBlock((const char *) &unique_key_size, sizeof(size_t));
-        /** store unique key */
-        out_helper->WriteBytesBlock(it.first.c_str(), unique_key_size);
-        /** store sizeof vector of byte positions */
-        size_t bytes_vector_size = it.second.size();
-        out_helper->WriteBytesBlock((const char *) &bytes_vector_size, sizeof(size_t));
-        /** loop on the vector and store each byte position */
         for (const auto &byte : it.second) {
-            out_helper->WriteBytesBlock((const char *) &byte, sizeof(size_t));
+            uint64_t position = byte;
+            append(&position, sizeof(position));
         }
     }
+
+    auto out_helper = new OutStreamHelper(this->mOutFilePath);
+    out_helper->Open();
+    out_helper->WriteBytesBlock(buffer.data(), buffer.size());
     out_helper->Close();
     delete out_helper;
 }
 
-void
+bool
 FileIndexer::LoadMapFromFile(streams::helpers::InStreamHelper *aInStreamHelper,
                              const std::vector<dataunits::TraceHeaderKey> &aTraceHeaderKeys) {
+    size_t file_size = aInStreamHelper->GetFileSize();
+
+    /** Use the whole index out of the file mapping, or read it at once */
+    std::vector<char> buffer;
+    auto data = (const char *) aInStreamHelper->GetMappedBytesBlock(0, file_size);
+    if (data == nullptr) {
+        buffer.resize(file_size);
+        aInStreamHelper->ReadBytesBlock(0, file_size, buffer.data());
+        data = buffer.data();
+    }
     size_t position = 0;
+    auto read = [&](void *apDestination, size_t aSize) {
+        if (position + aSize > file_size) {
+            return false;
+        }
+        memcpy(apDestination, data + position, aSize);
+        position += aSize;
+        return true;
+    };
 
-    /** load index map key length */
-    size_t key_size;
-    auto buffer = aInStreamHelper->ReadBytesBlock(position, sizeof(size_t));
-    std::memcpy(&key_size, buffer, sizeof(size_t));
-    position += sizeof(size_t);
-    delete[] buffer;
+    /** validate format, version and indexed file state */
+    char magic[8] = {0};
+    uint32_t version, reserved;
+    uint64_t in_file_size, key_size;
+    int64_t in_file_time;
+    if (!read(magic, sizeof(magic)) || memcmp(magic, IO_INDEX_MAGIC, sizeof(magic)) != 0 ||
+        !read(&version, sizeof(version)) || version != IO_INDEX_VERSION ||
+        !read(&reserved, sizeof(reserved)) ||
+        !read(&in_file_size, sizeof(in_file_size)) ||
+        !read(&in_file_time, sizeof(in_file_time)) ||
+        !read(&key_size, sizeof(key_size)) || key_size > file_size) {
+        return false;
+    }
+    uint64_t current_size;
+    int64_t current_time;
+    this->GetInFileStatus(current_size, current_time);
+    if (current_size != in_file_size || current_time != in_file_time) {
+        return false;
+    }
 
     /** load index map key */
-    auto idx_map_key = aInStreamHelper->ReadBytesBlock(position, key_size);
-    std::string key(&idx_map_key[0], idx_map_key + key_size);
-    position += key_size;
-    delete[] idx_map_key;
-
-    /** load map of unique values and byte positions' vector size */
-    size_t map_size;
-    buffer = aInStreamHelper->ReadBytesBlock(position, sizeof(size_t));
-    std::memcpy(&map_size, buffer, sizeof(size_t));
-    position += sizeof(size_t);
-    delete[] buffer;
-
-    for (int i = 0; i < map_size; i++) {
-        /** Load length of each unique key string */
-        size_t value_size;
-        buffer = aInStreamHelper->ReadBytesBlock(position, sizeof(size_t));
-        std::memcpy(&value_size, buffer, sizeof(size_t));
-        position += sizeof(size_t);
-        delete[] buffer;
-
-        /** Load unique key */
-        auto temp = aInStreamHelper->ReadBytesBlock(position, value_size);
-        std::string value(&temp[0], temp + value_size);
-        position += value_size;
-        delete[] temp;
-
-        /** Load sizeof vector of byte positions */
-        size_t bytes_vector_size;
-        buffer = aInStreamHelper->ReadBytesBlock(position, sizeof(size_t));
-        std::memcpy(&bytes_vector_size, buffer, sizeof(size_t));
-        position += sizeof(size_t);
-        delete[] buffer;
-
-        /** loop on the vector and load each byte position */
-        std::vector<size_t> byte_positions;
-        byte_positions.reserve(bytes_vector_size);
-        for (int j = 0; j < bytes_vector_size; j++) {
-            size_t byte_position;
-            buffer = aInStreamHelper->ReadBytesBlock(position, sizeof(size_t));
-            std::memcpy(&byte_position, buffer, sizeof(size_t));
-            byte_positions.push_back(byte_position);
-            position += sizeof(size_t);
-            delete[] buffer;
+    std::string key(key_size, '\0');
+    uint64_t values_count, positions_count;
+    if (!read(&key[0], key_size) || key != TraceHeaderKey::GatherKeysToString(aTraceHeaderKeys) ||
+        !read(&values_count, sizeof(values_count)) ||
+        !read(&positions_count, sizeof(positions_count)) ||
+        values_count > file_size || positions_count > file_size) {
+        return false;
+    }
+    std::vector<uint64_t> values_offsets(values_count + 1);
+    std::vector<uint64_t> positions_offsets(values_count + 1);
+    if (!read(values_offsets.data(), values_offsets.size() * sizeof(uint64_t)) ||
+        !read(positions_offsets.data(), positions_offsets.size() * sizeof(uint64_t))) {
+        return false;
+    }
+    size_t values_position = position;
+    size_t positions_position = values_position + values_offsets[values_count];
+    if (positions_offsets[values_count] != positions_count ||
+        positions_position + positions_count * sizeof(uint64_t) != file_size) {
+        return false;
+    }
+
+    auto &values_map = this->mIndexMap.Get(key);
+    for (uint64_t i = 0; i < values_count; i++) {
+        if (values_offsets[i] > values_offsets[i + 1] ||
+            positions_offsets[i] > positions_offsets[i + 1] ||
+            positions_offsets[i + 1] > positions_count) {
+            return false;
+        }
+        std::string value(data + values_position + values_offsets[i],
+                          values_offsets[i + 1] - values_offsets[i]);
+        auto &byte_positions = values_map[value];
+        byte_positions.resize(positions_offsets[i + 1] - positions_offsets[i]);
+        for (size_t ip = 0; ip < byte_positions.size(); ip++) {
+            uint64_t byte_position;
+            memcpy(&byte_position,
+                   data + positions_position + (positions_offsets[i] + ip) * sizeof(uint64_t),
+                   sizeof(uint64_t));
+            byte_positions[ip] = byte_position;
         }
-        /** Add unique value and the vector of byte positions to the Index map */
-        this->mIndexMap.Add(key, value, byte_positions);
     }
+    return true;
 }
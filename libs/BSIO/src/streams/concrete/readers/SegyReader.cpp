@@ -17,6 +17,11 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
 #include <bs/base/common/ExitCodes.hpp>
 #include <bs/base/exceptions/Exceptions.hpp>
 
@@ -127,6 +132,10 @@ SegyReader::Initialize(std::vector<TraceHeaderKey> &aGatherKeys,
     /* Index passed files. */
     this->Index();
 
+    /* Gathers are read by their indexed byte positions. */
+    for (auto &it : this->mInStreamHelpers) {
+        it->Advise(InStreamHelper::RANDOM);
+    }
     return BS_BASE_RC_SUCCESS;
 }
 
@@ -156,6 +165,7 @@ SegyReader::ReadAll() {
     for (const auto &it : this->mInStreamHelpers) {
         unsigned long long file_size = it->GetFileSize();
         size_t start_pos = IO_POS_S_TRACE_HEADER;
+        it->Advise(InStreamHelper::SEQUENTIAL);
         while (true) {
             if (start_pos + IO_SIZE_TRACE_HEADER >= file_size) {
                 break;
@@ -166,11 +176,10 @@ SegyReader::ReadAll() {
             /* Read trace data in the given file. */
             auto trace = it->ReadFormattedTraceData(start_pos + IO_SIZE_TRACE_HEADER, thl, this->mBinaryHeaderLookup);
 
-            auto &map = *trace->GetTraceHeaders();
             std::vector<std::string> values;
             values.reserve(this->mGatherKeys.size());
             for (const auto &i : this->mGatherKeys) {
-                values.push_back(map.find(i)->second);
+                values.push_back(trace->GetTraceHeaderKeyString(i));
             }
             std::string value = TraceHeaderKey::GatherValuesToString(values);
 
@@ -181,6 +190,7 @@ SegyReader::ReadAll() {
                          FloatingPointFormatter::GetFloatArrayRealSize(NumbersConvertor::ToLittleEndian(thl.NS),
                                                                        format);
         }
+        it->Advise(InStreamHelper::RANDOM);
     }
     auto hdt = NumbersConvertor::ToLittleEndian(this->mBinaryHeaderLookup.HDT);
     for (auto const &traces : gather_map) {
@@ -314,10 +324,40 @@ SegyReader::Index() {
     for (auto &it : this->mPaths) {
         this->mFileIndexers.push_back(FileIndexer(it, key));
     }
-    for (auto &it : this->mFileIndexers) {
-        it.Initialize();
-        this->mIndexMaps.push_back(it.Index(this->mGatherKeys));
-        it.Finalize();
+    /* Files are indexed concurrently, sharing the hardware threads between them. */
+    size_t files_count = this->mFileIndexers.size();
+    unsigned int threads_count = std::max(1u, std::thread::hardware_concurrency());
+    size_t workers_count = std::min((size_t) threads_count, files_count);
+    std::vector<IndexMap> index_maps(files_count);
+    std::vector<std::exception_ptr> errors(files_count);
+    std::atomic<size_t> next_file(0);
+    std::vector<std::thread> workers;
+    workers.reserve(workers_count);
+    for (size_t iw = 0; iw < workers_count; iw++) {
+        workers.emplace_back([&]() {
+            for (size_t i = next_file++; i < files_count; i = next_file++) {
+                try {
+                    auto &indexer = this->mFileIndexers[i];
+                    indexer.SetThreadsCount(threads_count / workers_count);
+                    indexer.Initialize();
+                    index_maps[i] = indexer.Index(this->mGatherKeys);
+                    indexer.Finalize();
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    for (auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    for (auto &index_map : index_maps) {
+        this->mIndexMaps.push_back(std::move(index_map));
     }
     return BS_BASE_RC_SUCCESS;
 }
@@ -18,6 +18,11 @@
  */
 
 #include <iostream>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include <bs/base/common/ExitCodes.hpp>
 
@@ -38,9 +43,11 @@ using namespace bs::io::utils::convertors;
 
 
 InStreamHelper::InStreamHelper(std::string &aFilePath)
-        : mFilePath(aFilePath), mFileSize(-1) {}
+        : mFilePath(aFilePath), mFileSize(-1), mpMappedFile(nullptr) {}
 
-InStreamHelper::~InStreamHelper() = default;
+InStreamHelper::~InStreamHelper() {
+    this->Close();
+}
 
 size_t
 InStreamHelper::Open() {
@@ -48,26 +55,79 @@ InStreamHelper::Open() {
     if (this->mInStream.fail()) {
         throw bs::base::exceptions::FILE_NOT_FOUND_EXCEPTION();
     }
+    /* Map the whole file, falling back to the stream if it can't be mapped. */
+    int fd = open(this->mFilePath.c_str(), O_RDONLY);
+    struct stat file_stat{};
+    if (fd != -1 && fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+        void *mapping = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            this->mpMappedFile = (unsigned char *) mapping;
+            this->mFileSize = file_stat.st_size;
+        }
+    }
+    if (fd != -1) {
+        close(fd);
+    }
     return this->GetFileSize();
 }
 
 int
 InStreamHelper::Close() {
-    this->mInStream.close();
+    if (this->mpMappedFile != nullptr) {
+        munmap(this->mpMappedFile, this->mFileSize);
+        this->mpMappedFile = nullptr;
+    }
+    if (this->mInStream.is_open()) {
+        this->mInStream.close();
+    }
     return BS_BASE_RC_SUCCESS;
 }
 
 unsigned char *
 InStreamHelper::ReadBytesBlock(size_t aStartPosition, size_t aBlockSize) {
+    auto buffer = new unsigned char[aBlockSize];
+    this->ReadBytesBlock(aStartPosition, aBlockSize, buffer);
+    return buffer;
+}
+
+void
+InStreamHelper::ReadBytesBlock(size_t aStartPosition, size_t aBlockSize, void *apDestination) {
     if (aStartPosition + aBlockSize > this->GetFileSize()) {
         throw INDEX_OUT_OF_BOUNDS_EXCEPTION();
     }
-    auto buffer = new unsigned char[aBlockSize];
-    memset(buffer, '\0', sizeof(unsigned char) * aBlockSize);
-    this->mInStream.seekg(aStartPosition, std::fstream::beg);
-    this->mInStream.read((char *) buffer, aBlockSize);
+    if (this->mpMappedFile != nullptr) {
+        std::memcpy(apDestination, this->mpMappedFile + aStartPosition, aBlockSize);
+    } else {
+        memset(apDestination, '\0', sizeof(unsigned char) * aBlockSize);
+        this->mInStream.seekg(aStartPosition, std::fstream::beg);
+        this->mInStream.read((char *) apDestination, aBlockSize);
+    }
+}
 
-    return buffer;
+const unsigned char *
+InStreamHelper::GetMappedBytesBlock(size_t aStartPosition, size_t aBlockSize) {
+    if (aStartPosition + aBlockSize > this->GetFileSize()) {
+        throw INDEX_OUT_OF_BOUNDS_EXCEPTION();
+    }
+    if (this->mpMappedFile == nullptr) {
+        return nullptr;
+    }
+    return this->mpMappedFile + aStartPosition;
+}
+
+void
+InStreamHelper::Advise(AccessPattern aAccessPattern) {
+    if (this->mpMappedFile == nullptr) {
+        return;
+    }
+    int advice = MADV_NORMAL;
+    if (aAccessPattern == SEQUENTIAL) {
+        advice = MADV_SEQUENTIAL;
+    } else if (aAccessPattern == RANDOM) {
+        advice = MADV_RANDOM;
+    }
+    /* Only a hint, failing to apply it is harmless. */
+    madvise(this->mpMappedFile, this->mFileSize, advice);
 }
 
 unsigned char *
@@ -83,10 +143,8 @@ InStreamHelper::ReadBinaryHeader(size_t aStartPosition) {
     if (aStartPosition + IO_SIZE_BINARY_HEADER > this->GetFileSize()) {
         throw INDEX_OUT_OF_BOUNDS_EXCEPTION();
     }
-    auto bhl_buffer = this->ReadBytesBlock(aStartPosition, IO_SIZE_BINARY_HEADER);
     BinaryHeaderLookup bhl{};
-    std::memcpy(&bhl, bhl_buffer, sizeof(BinaryHeaderLookup));
-    delete bhl_buffer;
+    this->ReadBytesBlock(aStartPosition, sizeof(BinaryHeaderLookup), &bhl);
     return bhl;
 }
 
@@ -95,10 +153,8 @@ InStreamHelper::ReadTraceHeader(size_t aStartPosition) {
     if (aStartPosition + IO_SIZE_TRACE_HEADER > this->GetFileSize()) {
         throw INDEX_OUT_OF_BOUNDS_EXCEPTION();
     }
-    auto thl_buffer = this->ReadBytesBlock(aStartPosition, IO_SIZE_TRACE_HEADER);
     TraceHeaderLookup thl{};
-    std::memcpy(&thl, thl_buffer, sizeof(TraceHeaderLookup));
-    delete thl_buffer;
+    this->ReadBytesBlock(aStartPosition, sizeof(TraceHeaderLookup), &thl);
     return thl;
 }
 
@@ -112,9 +168,14 @@ InStreamHelper::ReadFormattedTraceData(size_t aStartPosition,
         throw INDEX_OUT_OF_BOUNDS_EXCEPTION();
     }
 
-    auto trace_data = new char[trace_size];
-    this->mInStream.seekg(aStartPosition, std::fstream::beg);
-    this->mInStream.read(trace_data, trace_size);
+    /* Decode directly out of the mapping when available. */
+    std::vector<char> trace_buffer;
+    auto trace_data = (const char *) this->GetMappedBytesBlock(aStartPosition, trace_size);
+    if (trace_data == nullptr) {
+        trace_buffer.resize(trace_size);
+        this->ReadBytesBlock(aStartPosition, trace_size, trace_buffer.data());
+        trace_data = trace_buffer.data();
+    }
     size_t sample_number = InStreamHelper::GetSamplesNumber(aTraceHeaderLookup, aBinaryHeaderLookup);
     auto trace_data_formatted = new char[sample_number * sizeof(float)];
     FloatingPointFormatter::Format(trace_data, trace_data_formatted,
@@ -125,7 +186,6 @@ InStreamHelper::ReadFormattedTraceData(size_t aStartPosition,
 
     auto trace = new Trace(NumbersConvertor::ToLittleEndian(aTraceHeaderLookup.NS));
     trace->SetTraceData((float *) trace_data_formatted);
-    delete[] trace_data;
     /* Weight trace data values according to the target formats. */
     TraceHelper::Weight(trace, aTraceHeaderLookup, aBinaryHeaderLookup);
     /* Set trace headers */
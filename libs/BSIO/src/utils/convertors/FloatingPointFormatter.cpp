@@ -16,6 +16,8 @@
  * You should have received a copy of the GNU Lesser General Public
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <cmath>
+#include <cstdint>
 
 #include <bs/base/exceptions/Exceptions.hpp>
 
@@ -26,6 +28,210 @@ using namespace bs::base::exceptions;
 using namespace bs::io::utils::convertors;
 using namespace bs::io::utils::checkers;
 
+/*
+ * All the conversions below are written as branch free loops over the samples
+ * so that the compiler vectorizes them for the targeted instruction set, the
+ * big endian byte order of the SEG-Y samples being swapped in the same pass.
+ */
+
+static inline uint32_t
+swap_32(uint32_t aValue) {
+    return (aValue << 24) | ((aValue >> 24) & 0xff) | ((aValue & 0xff00) << 8) |
+           ((aValue & 0xff0000) >> 8);
+}
+
+static inline uint16_t
+swap_16(uint16_t aValue) {
+    return (uint16_t) ((aValue << 8) | (aValue >> 8));
+}
+
+template<bool SWAP_>
+static inline uint32_t
+load_32(const char *apSrc, size_t aIndex) {
+    uint32_t value;
+    memcpy(&value, apSrc + aIndex * sizeof(uint32_t), sizeof(uint32_t));
+    if constexpr (SWAP_) {
+        value = swap_32(value);
+    }
+    return value;
+}
+
+template<bool SWAP_>
+static inline void
+store_32(char *apDest, size_t aIndex, uint32_t aValue) {
+    if constexpr (SWAP_) {
+        aValue = swap_32(aValue);
+    }
+    memcpy(apDest + aIndex * sizeof(uint32_t), &aValue, sizeof(uint32_t));
+}
+
+static inline uint32_t
+float_bits(float aValue) {
+    uint32_t bits;
+    memcpy(&bits, &aValue, sizeof(float));
+    return bits;
+}
+
+/**
+ * @brief Rounds to the nearest integer, halves away from zero, saturating to the
+ * given range. NaN is mapped to zero.
+ */
+static inline float
+round_saturate(float aValue, float aMin, float aMax) {
+    float rounded = std::round(aValue);
+    rounded = (rounded < aMin) ? aMin : rounded;
+    rounded = (rounded > aMax) ? aMax : rounded;
+    return (aValue != aValue) ? 0.0f : rounded;
+}
+
+/**
+ * @brief Native float to IBM float conversion of a single value, handles the
+ * denormalized inputs the vectorized path leaves out.
+ */
+static uint32_t
+to_ibm(uint32_t aValue) {
+    if (aValue == 0) {
+        return aValue;
+    }
+    unsigned fr = aValue;   /* pick up value */
+    int sgn = fr >> 31;     /* save sign */
+    fr <<= 1;               /* shift sign out */
+    int exp = fr >> 24;     /* save exponent */
+    fr <<= 8;               /* shift exponent out */
+
+    if (exp == 255) { /* infinity (or NAN) - map to largest */
+        fr = 0xffffff00;
+        exp = 0x7f;
+        goto done;
+    } else if (exp > 0) /* add assumed digit */
+        fr = (fr >> 1) | 0x80000000;
+    else if (fr == 0) /* short-circuit for zero */
+        goto done;
+
+    /* adjust exponent from base 2 offset 127 radix point after first digit
+    to base 16 offset 64 radix point before first digit */
+    exp += 130;
+    fr >>= -exp & 3;
+    exp = (exp + 3) >> 2;
+
+    /* (re)normalize */
+    while (fr < 0x10000000) { /* only executed for denormalized input */
+        --exp;
+        fr <<= 4;
+    }
+
+    done:
+    /* put the pieces back together and return it */
+    return (fr >> 8) | (exp << 24) | (sgn << 31);
+}
+
+template<bool SWAP_>
+static void
+from_ibm(const char *apSrc, char *apDest, size_t aSamplesNumber) {
+#pragma omp simd
+    for (size_t i = 0; i < aSamplesNumber; ++i) {
+        uint32_t fconv = load_32<SWAP_>(apSrc, i);
+        uint32_t sign = 0x80000000 & fconv;
+        uint32_t fmant = 0x00ffffff & fconv;
+        /*
+         * The 24 bits mantissa converts exactly to a float, whose exponent gives the
+         * normalization shift and whose fraction is the normalized mantissa.
+         */
+        uint32_t normalized = float_bits((float) (int32_t) fmant);
+        int32_t t = (int32_t) ((0x7f000000 & fconv) >> 22) + (int32_t) (normalized >> 23) - 280;
+        uint32_t result = sign | ((uint32_t) t << 23) | (0x007fffff & normalized);
+        result = (t > 254) ? (sign | 0x7f7fffff) : result;
+        result = (t <= 0 || fmant == 0) ? 0 : result;
+        store_32<false>(apDest, i, result);
+    }
+}
+
+template<bool SWAP_>
+static void
+to_ibm(const char *apSrc, char *apDest, size_t aSamplesNumber) {
+    int denormalized = 0;
+#pragma omp simd reduction(+:denormalized)
+    for (size_t i = 0; i < aSamplesNumber; ++i) {
+        uint32_t fconv = load_32<false>(apSrc, i);
+        uint32_t sign = 0x80000000 & fconv;
+        uint32_t exp = (fconv >> 23) & 0xff;
+        uint32_t fraction = 0x007fffff & fconv;
+        /* Normalized fraction with the assumed digit, already a normalized hexadecimal fraction. */
+        uint32_t fr = 0x80000000 | (fraction << 8);
+        uint32_t e = exp + 130;
+        fr >>= (0 - e) & 3;
+        uint32_t result = (fr >> 8) | (((e + 3) >> 2) << 24) | sign;
+        result = (exp == 255) ? (sign | 0x7fffffff) : result;
+        result = (exp == 0) ? sign : result;
+        denormalized += (exp == 0 && fraction != 0);
+        store_32<SWAP_>(apDest, i, result);
+    }
+    /* Denormalized inputs are rare, they are fixed with the scalar path. */
+    if (denormalized > 0) {
+        for (size_t i = 0; i < aSamplesNumber; ++i) {
+            uint32_t fconv = load_32<false>(apSrc, i);
+            if (((fconv >> 23) & 0xff) == 0 && (0x007fffff & fconv) != 0) {
+                store_32<SWAP_>(apDest, i, to_ibm(fconv));
+            }
+        }
+    }
+}
+
+template<bool SWAP_>
+static void
+from_long(const char *apSrc, float *apDest, size_t aSamplesNumber) {
+#pragma omp simd
+    for (size_t i = 0; i < aSamplesNumber; ++i) {
+        apDest[i] = (float) (int32_t) load_32<SWAP_>(apSrc, i);
+    }
+}
+
+template<bool SWAP_>
+static void
+to_long(const float *apSrc, char *apDest, size_t aSamplesNumber) {
+#pragma omp simd
+    for (size_t i = 0; i < aSamplesNumber; ++i) {
+        /* The largest float below 2^31 bounds the conversion. */
+        auto value = (int32_t) round_saturate(apSrc[i], -2147483648.0f, 2147483520.0f);
+        store_32<SWAP_>(apDest, i, (uint32_t) value);
+    }
+}
+
+template<bool SWAP_>
+static void
+from_short(const char *apSrc, float *apDest, size_t aSamplesNumber) {
+#pragma omp simd
+    for (size_t i = 0; i < aSamplesNumber; ++i) {
+        uint16_t value;
+        memcpy(&value, apSrc + i * sizeof(uint16_t), sizeof(uint16_t));
+        if constexpr (SWAP_) {
+            value = swap_16(value);
+        }
+        apDest[i] = (float) (int16_t) value;
+    }
+}
+
+template<bool SWAP_>
+static void
+to_short(const float *apSrc, char *apDest, size_t aSamplesNumber) {
+#pragma omp simd
+    for (size_t i = 0; i < aSamplesNumber; ++i) {
+        auto value = (uint16_t) (int16_t) round_saturate(apSrc[i], INT16_MIN, INT16_MAX);
+        if constexpr (SWAP_) {
+            value = swap_16(value);
+        }
+        memcpy(apDest + i * sizeof(uint16_t), &value, sizeof(uint16_t));
+    }
+}
+
+template<bool SWAP_>
+static void
+swap_ieee(const char *apSrc, char *apDest, size_t aSamplesNumber) {
+#pragma omp simd
+    for (size_t i = 0; i < aSamplesNumber; ++i) {
+        store_32<false>(apDest, i, load_32<SWAP_>(apSrc, i));
+    }
+}
 
 int
 FloatingPointFormatter::GetFloatArrayRealSize(unsigned short aSamplesNumber, unsigned short aFormatCode) {
@@ -75,9 +281,25 @@ FloatingPointFormatter::Format(const char *apSrc, char *apDest,
     } else {
         switch (aFormat) {
             case 1:
-                /// Convert IBM float to native floats.
+                /// Convert native floats to IBM float.
                 rc = FloatingPointFormatter::ToIBM(apSrc, apDest, aSrcSize, aSamplesNumber);
                 break;
+            case 2:
+                /// Convert native floats to 4 byte two's complement integer.
+                rc = FloatingPointFormatter::ToLong(apSrc, apDest, aSrcSize, aSamplesNumber);
+                break;
+            case 3:
+                /// Convert native floats to 2 byte two's complement integer.
+                rc = FloatingPointFormatter::ToShort(apSrc, apDest, aSrcSize, aSamplesNumber);
+                break;
+            case 5:
+                /// Convert native floats to IEEE float.
+                rc = FloatingPointFormatter::ToIEEE(apSrc, apDest, aSrcSize, aSamplesNumber);
+                break;
+            case 8:
+                /// Convert native floats to 1 byte two's complement integer.
+                rc = FloatingPointFormatter::ToChar(apSrc, apDest, aSrcSize, aSamplesNumber);
+                break;
             default:
                 throw bs::base::exceptions::UNSUPPORTED_FEATURE_EXCEPTION();
         }
@@ -88,34 +310,10 @@ FloatingPointFormatter::Format(const char *apSrc, char *apDest,
 int
 FloatingPointFormatter::FromIBM(const char *apSrc, char *apDest,
                                 size_t aSrcSize, size_t aSamplesNumber) {
-    bool is_little_endian = Checker::IsLittleEndianMachine();
-    size_t size_entry = sizeof(float);
-    size_t size = aSrcSize / size_entry;
-    unsigned int fconv, fmant, t;
-    unsigned int offset = 0;
-    for (int i = 0; i < size; ++i) {
-        offset = i * size_entry;
-        memcpy(&fconv, apSrc + offset, sizeof(unsigned int));
-        if (is_little_endian) {
-            fconv = (fconv << 24) | ((fconv >> 24) & 0xff) | ((fconv & 0xff00) << 8) |
-                    ((fconv & 0xff0000) >> 8);
-        }
-        if (fconv) {
-            fmant = 0x00ffffff & fconv;
-            t = (int) ((0x7f000000 & fconv) >> 22) - 130;
-            while (!(fmant & 0x00800000)) {
-                --t;
-                fmant <<= 1;
-            }
-            if (t > 254) {
-                fconv = (0x80000000 & fconv) | 0x7f7fffff;
-            } else if (t <= 0) {
-                fconv = 0;
-            } else {
-                fconv = (0x80000000 & fconv) | (t << 23) | (0x007fffff & fmant);
-            }
-        }
-        memcpy(apDest + offset, &fconv, sizeof(float));
+    if (Checker::IsLittleEndianMachine()) {
+        from_ibm<true>(apSrc, apDest, aSamplesNumber);
+    } else {
+        from_ibm<false>(apSrc, apDest, aSamplesNumber);
     }
     return 1;
 }
@@ -123,56 +321,10 @@ FloatingPointFormatter::FromIBM(const char *apSrc, char *apDest,
 int
 FloatingPointFormatter::ToIBM(const char *apSrc, char *apDest,
                               size_t aSrcSize, size_t aSamplesNumber) {
-    bool is_little_endian = Checker::IsLittleEndianMachine();
-    size_t size_entry = sizeof(float);
-    size_t size = aSrcSize / size_entry;
-    unsigned int fconv, fmant, t;
-    unsigned int offset = 0;
-    unsigned fr; /* fraction */
-    int exp;     /* exponent */
-    int sgn;     /* sign */
-    for (int i = 0; i < size; ++i) {
-        offset = i * size_entry;
-        memcpy(&fconv, apSrc + offset, sizeof(unsigned int));
-        if (fconv) {
-            fr = fconv;             /* pick up value */
-            sgn = fr >> 31;         /* save sign */
-            fr <<= 1;               /* shift sign out */
-            exp = fr >> 24;         /* save exponent */
-            fr <<= 8;               /* shift exponent out */
-
-            if (exp == 255) { /* infinity (or NAN) - map to largest */
-                fr = 0xffffff00;
-                exp = 0x7f;
-                goto done;
-            } else if (exp > 0) /* add assumed digit */
-                fr = (fr >> 1) | 0x80000000;
-            else if (fr == 0) /* short-circuit for zero */
-                goto done;
-
-            /* adjust exponent from base 2 offset 127 radix point after first digit
-            to base 16 offset 64 radix point before first digit */
-            exp += 130;
-            fr >>= -exp & 3;
-            exp = (exp + 3) >> 2;
-
-            /* (re)normalize */
-            while (fr < 0x10000000) { /* never executed for normalized input */
-                --exp;
-                fr <<= 4;
-            }
-
-            done:
-            /* put the pieces back together and return it */
-            fr = (fr >> 8) | (exp << 24) | (sgn << 31);
-            fconv = fr;
-        }
-        // Swap endian after transformation.
-        if (is_little_endian) {
-            fconv = (fconv << 24) | ((fconv >> 24) & 0xff) | ((fconv & 0xff00) << 8) |
-                    ((fconv & 0xff0000) >> 8);
-        }
-        memcpy(apDest + offset, &fconv, sizeof(float));
+    if (Checker::IsLittleEndianMachine()) {
+        to_ibm<true>(apSrc, apDest, aSamplesNumber);
+    } else {
+        to_ibm<false>(apSrc, apDest, aSamplesNumber);
     }
     return 1;
 }
@@ -180,39 +332,85 @@ FloatingPointFormatter::ToIBM(const char *apSrc, char *apDest,
 int
 FloatingPointFormatter::FromLong(const char *apSrc, char *apDest,
                                  size_t aSize, size_t aSamplesNumber) {
-    /// @todo To be removed
-    /// {
-    throw NOT_IMPLEMENTED_EXCEPTION();
-    /// }
+    if (Checker::IsLittleEndianMachine()) {
+        from_long<true>(apSrc, (float *) apDest, aSamplesNumber);
+    } else {
+        from_long<false>(apSrc, (float *) apDest, aSamplesNumber);
+    }
+    return 1;
+}
+
+int
+FloatingPointFormatter::ToLong(const char *apSrc, char *apDest,
+                               size_t aSize, size_t aSamplesNumber) {
+    if (Checker::IsLittleEndianMachine()) {
+        to_long<true>((const float *) apSrc, apDest, aSamplesNumber);
+    } else {
+        to_long<false>((const float *) apSrc, apDest, aSamplesNumber);
+    }
     return 1;
 }
 
 int
 FloatingPointFormatter::FromShort(const char *apSrc, char *apDest,
                                   size_t aSize, size_t aSamplesNumber) {
-    /// @todo To be removed
-    /// {
-    throw NOT_IMPLEMENTED_EXCEPTION();
-    /// }
+    if (Checker::IsLittleEndianMachine()) {
+        from_short<true>(apSrc, (float *) apDest, aSamplesNumber);
+    } else {
+        from_short<false>(apSrc, (float *) apDest, aSamplesNumber);
+    }
+    return 1;
+}
+
+int
+FloatingPointFormatter::ToShort(const char *apSrc, char *apDest,
+                                size_t aSize, size_t aSamplesNumber) {
+    if (Checker::IsLittleEndianMachine()) {
+        to_short<true>((const float *) apSrc, apDest, aSamplesNumber);
+    } else {
+        to_short<false>((const float *) apSrc, apDest, aSamplesNumber);
+    }
     return 1;
 }
 
 int
 FloatingPointFormatter::FromIEEE(const char *apSrc, char *apDest,
                                  size_t aSize, size_t aSamplesNumber) {
-    /// @todo To be removed
-    /// {
-    throw NOT_IMPLEMENTED_EXCEPTION();
-    /// }
+    if (Checker::IsLittleEndianMachine()) {
+        swap_ieee<true>(apSrc, apDest, aSamplesNumber);
+    } else {
+        swap_ieee<false>(apSrc, apDest, aSamplesNumber);
+    }
     return 1;
 }
 
+int
+FloatingPointFormatter::ToIEEE(const char *apSrc, char *apDest,
+                               size_t aSize, size_t aSamplesNumber) {
+    /* Swapping the byte order is its own inverse. */
+    return FloatingPointFormatter::FromIEEE(apSrc, apDest, aSize, aSamplesNumber);
+}
+
 int
 FloatingPointFormatter::FromChar(const char *apSrc, char *apDest,
                                  size_t aSize, size_t aSamplesNumber) {
-    /// @todo To be removed
-    /// {
-    throw NOT_IMPLEMENTED_EXCEPTION();
-    /// }
+    auto src = (const int8_t *) apSrc;
+    auto dest = (float *) apDest;
+#pragma omp simd
+    for (size_t i = 0; i < aSamplesNumber; ++i) {
+        dest[i] = (float) src[i];
+    }
+    return 1;
+}
+
+int
+FloatingPointFormatter::ToChar(const char *apSrc, char *apDest,
+                               size_t aSize, size_t aSamplesNumber) {
+    auto src = (const float *) apSrc;
+    auto dest = (int8_t *) apDest;
+#pragma omp simd
+    for (size_t i = 0; i < aSamplesNumber; ++i) {
+        dest[i] = (int8_t) round_saturate(src[i], INT8_MIN, INT8_MAX);
+    }
     return 1;
 }
@@ -61,6 +61,17 @@ TEST_GATHER() {
         REQUIRE(g.GetNumberTraces() == 10);
     }
 
+    SECTION("Remove Traces") {
+        Gather g(TraceHeaderKey::NS, "0", traces);
+        vector<bool> removed(g.GetNumberTraces(), false);
+        removed[0] = removed[3] = removed[4] = removed[9] = true;
+
+        g.RemoveTraces(removed);
+        REQUIRE(g.GetNumberTraces() == 6);
+        vector<int> fldr = g.GetTraceHeaderColumn<int>(TraceHeaderKey::FLDR);
+        REQUIRE(fldr == vector<int>({2, 3, 6, 7, 8, 9}));
+    }
+
     SECTION("Sorting") {
         unordered_map<TraceHeaderKey, string> unique_keys;
         unique_keys[TraceHeaderKey::NS] = "0";
@@ -78,6 +89,17 @@ TEST_GATHER() {
             fldr = temp;
         }
     }
+
+    SECTION("Header Columns") {
+        unordered_map<TraceHeaderKey, string> unique_keys;
+        unique_keys[TraceHeaderKey::NS] = "0";
+        Gather g(unique_keys, traces);
+        vector<int> fldr = g.GetTraceHeaderColumn<int>(TraceHeaderKey::FLDR);
+        REQUIRE(fldr.size() == g.GetNumberTraces());
+        for (int i = 0; i < fldr.size(); i++) {
+            REQUIRE(fldr[i] == g.GetTrace(i)->GetTraceHeaderKeyValue<int>(TraceHeaderKey::FLDR));
+        }
+    }
 }
 
 
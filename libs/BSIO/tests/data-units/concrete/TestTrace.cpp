@@ -58,14 +58,23 @@ TEST_TRACE() {
         REQUIRE(!t.HasTraceHeader(TraceHeaderKey::FLDR));
         REQUIRE(t.GetNumberOfSamples() == ns);
         /* Only NS header is set. */
-        REQUIRE(t.GetTraceHeaders()->size() == 1);
+        REQUIRE(t.GetTraceHeaderKeys().size() == 1);
 
         int fldr = 1;
         t.SetTraceHeaderKeyValue(TraceHeaderKey::FLDR, fldr);
         /* FLDR is now set. */
         REQUIRE(t.HasTraceHeader(TraceHeaderKey::FLDR));
         /* FLDR and NS header are now set. */
-        REQUIRE(t.GetTraceHeaders()->size() == 2);
+        REQUIRE(t.GetTraceHeaderKeys().size() == 2);
+    }
+
+    SECTION("Header_String") {
+        Trace t(3);
+        t.SetTraceHeaderKeyValue(TraceHeaderKey::FLDR, (short) 7);
+        t.SetTraceHeaderKeyValue(TraceHeaderKey::F1, 0.5f);
+        REQUIRE(t.GetTraceHeaderKeyString(TraceHeaderKey::FLDR) == std::to_string(7));
+        REQUIRE(t.GetTraceHeaderKeyString(TraceHeaderKey::F1) == std::to_string(0.5f));
+        REQUIRE(t.GetTraceHeaderKeyValue<int>(TraceHeaderKey::F1) == 0);
     }
 
     SECTION("Set_Scaled_Coordinate") {
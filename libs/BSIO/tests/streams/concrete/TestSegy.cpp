@@ -25,6 +25,7 @@
 
 #include <bs/io/streams/concrete/readers/SegyReader.hpp>
 #include <bs/io/streams/concrete/writers/SegyWriter.hpp>
+#include <bs/io/indexers/FileIndexer.hpp>
 #include <bs/io/data-units/concrete/Gather.hpp>
 #include <bs/io/configurations/MapKeys.h>
 #include <bs/io/test-utils/DataGenerator.hpp>
@@ -32,6 +33,7 @@
 using namespace std;
 using namespace bs::io::streams;
 using namespace bs::io::dataunits;
+using namespace bs::io::indexers;
 using namespace bs::io::testutils;
 using namespace bs::base::configurations;
 using json = nlohmann::json;
@@ -112,6 +114,69 @@ TEST_SEGY_FORMAT() {
     reader.Finalize();
 }
 
+void
+TEST_SEGY_INDEXING() {
+    string dir(IO_TESTS_RESULTS_PATH);
+    mkdir(dir.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+
+    json node;
+    node[IO_K_PROPERTIES][IO_K_WRITE_LITTLE_ENDIAN] = false;
+    node[IO_K_PROPERTIES][IO_K_FLOAT_FORMAT] = 1;
+    JSONConfigurationMap writer_map = JSONConfigurationMap(node);
+
+    /* Enough traces for the file to be scanned by chunks, each FLDR twice. */
+    vector<Gather *> gathers;
+    gathers.push_back(DataGenerator::GenerateGather(1, 5000, 1));
+    gathers.push_back(DataGenerator::GenerateGather(1, 5000, 1));
+
+    SegyWriter writer(&writer_map);
+    writer.AcquireConfiguration();
+    string file_path(IO_TESTS_RESULTS_PATH "/SEGYIndexFile");
+    writer.Initialize(file_path);
+    REQUIRE(writer.Write(gathers) == 0);
+    writer.Finalize();
+
+    vector<TraceHeaderKey> keys = {TraceHeaderKey::FLDR};
+    string key = TraceHeaderKey::GatherKeysToString(keys);
+    string segy_path = file_path + ".segy";
+
+    auto index = [&](unsigned int aThreadsCount) {
+        FileIndexer indexer(segy_path, key);
+        indexer.SetThreadsCount(aThreadsCount);
+        indexer.Initialize();
+        auto index_map = indexer.Index(keys).Get(key);
+        indexer.Finalize();
+        return index_map;
+    };
+
+    FileIndexer path_indexer(segy_path, key);
+    string index_path = path_indexer.GetIndexedFilePath();
+    remove(index_path.c_str());
+    auto parallel_map = index(4);
+    REQUIRE(parallel_map.size() == 5000);
+    REQUIRE(parallel_map["2500_"].size() == 2);
+    REQUIRE(parallel_map["2500_"][0] < parallel_map["2500_"][1]);
+
+    remove(index_path.c_str());
+    auto serial_map = index(1);
+    REQUIRE(serial_map == parallel_map);
+
+    /* Loaded back from the stored index. */
+    auto loaded_map = index(1);
+    REQUIRE(loaded_map == serial_map);
+
+    /* A stale index is rebuilt. */
+    FILE *stale_file = fopen(index_path.c_str(), "wb");
+    fputs("stale", stale_file);
+    fclose(stale_file);
+    auto rebuilt_map = index(1);
+    REQUIRE(rebuilt_map == serial_map);
+
+    for (auto g : gathers) {
+        delete g;
+    }
+}
+
 
 /**
  * REQUIRED TESTS:
@@ -130,4 +195,8 @@ TEST_SEGY_FORMAT() {
 
 TEST_CASE("Segy Format Test") {
     TEST_SEGY_FORMAT();
-}
\ No newline at end of file
+}
+
+TEST_CASE("Segy Indexing Test") {
+    TEST_SEGY_INDEXING();
+}
@@ -17,14 +17,106 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
 #include <prerequisites/libraries/catch/catch.hpp>
 
 #include <bs/io/utils/convertors/FloatingPointFormatter.hpp>
+#include <bs/io/utils/checkers/Checker.hpp>
 
 
 #define IBM_EPS 4.7683738e-7 /* Worst case error */
 
+using namespace std;
 using namespace bs::io::utils::convertors;
+using namespace bs::io::utils::checkers;
+
+
+static uint32_t
+reference_swap(uint32_t aValue) {
+    return (aValue << 24) | ((aValue >> 24) & 0xff) | ((aValue & 0xff00) << 8) |
+           ((aValue & 0xff0000) >> 8);
+}
+
+/**
+ * @brief Sample at a time IBM to native float conversion, the vectorized one should match bit by bit.
+ * IBM values with a zero fraction and a non zero exponent or sign are expected to give zero.
+ */
+static uint32_t
+reference_from_ibm(uint32_t aValue) {
+    uint32_t fconv = Checker::IsLittleEndianMachine() ? reference_swap(aValue) : aValue;
+    if (fconv) {
+        uint32_t fmant = 0x00ffffff & fconv;
+        if (fmant == 0) {
+            return 0;
+        }
+        int t = (int) ((0x7f000000 & fconv) >> 22) - 130;
+        while (!(fmant & 0x00800000)) {
+            --t;
+            fmant <<= 1;
+        }
+        if (t > 254) {
+            fconv = (0x80000000 & fconv) | 0x7f7fffff;
+        } else if (t <= 0) {
+            fconv = 0;
+        } else {
+            fconv = (0x80000000 & fconv) | (t << 23) | (0x007fffff & fmant);
+        }
+    }
+    return fconv;
+}
+
+/**
+ * @brief Sample at a time native float to IBM conversion, the vectorized one should match bit by bit.
+ */
+static uint32_t
+reference_to_ibm(uint32_t aValue) {
+    uint32_t fconv = aValue;
+    if (fconv) {
+        unsigned fr = fconv;
+        int sgn = fr >> 31;
+        fr <<= 1;
+        int exp = fr >> 24;
+        fr <<= 8;
+        if (exp == 255) {
+            fr = 0xffffff00;
+            exp = 0x7f;
+        } else {
+            if (exp > 0) {
+                fr = (fr >> 1) | 0x80000000;
+            }
+            if (exp > 0 || fr != 0) {
+                exp += 130;
+                fr >>= -exp & 3;
+                exp = (exp + 3) >> 2;
+                while (fr < 0x10000000) {
+                    --exp;
+                    fr <<= 4;
+                }
+            }
+        }
+        fconv = (fr >> 8) | (exp << 24) | (sgn << 31);
+    }
+    return Checker::IsLittleEndianMachine() ? reference_swap(fconv) : fconv;
+}
+
+/**
+ * @brief Random bit patterns, with the zeros, denormals, infinities and NaNs in front.
+ */
+static vector<uint32_t>
+generate_patterns(size_t aCount) {
+    vector<uint32_t> patterns = {0x00000000, 0x80000000, 0x00000001, 0x807fffff, 0x00400000,
+                                 0x7f800000, 0xff800000, 0x7fc00000, 0x7f7fffff, 0x3f800000,
+                                 0x41000000, 0x7f000000, 0x00100000, 0xc1ffffff};
+    mt19937 generator(2021);
+    while (patterns.size() < aCount) {
+        patterns.push_back(generator());
+    }
+    return patterns;
+}
 
 
 void
@@ -54,6 +146,113 @@ TEST_FLOAT_FORMAT() {
 }
 
 
+void
+TEST_FLOAT_FORMAT_BIT_EXACT() {
+    /* Odd count so the vectorized loops go through their remainders. */
+    vector<uint32_t> patterns = generate_patterns(100003);
+    size_t count = patterns.size();
+    vector<uint32_t> dst(count);
+
+    SECTION("From IBM - Bit Exact") {
+        FloatingPointFormatter::Format((char *) patterns.data(), (char *) dst.data(),
+                                       count * sizeof(float), count, 1, true);
+        size_t misses = 0;
+        for (size_t i = 0; i < count; i++) {
+            misses += dst[i] != reference_from_ibm(patterns[i]);
+        }
+        REQUIRE(misses == 0);
+    }
+
+    SECTION("To IBM - Bit Exact") {
+        FloatingPointFormatter::Format((char *) patterns.data(), (char *) dst.data(),
+                                       count * sizeof(float), count, 1, false);
+        size_t misses = 0;
+        for (size_t i = 0; i < count; i++) {
+            misses += dst[i] != reference_to_ibm(patterns[i]);
+        }
+        REQUIRE(misses == 0);
+    }
+
+    SECTION("IEEE - Byte Order") {
+        vector<uint32_t> back(count);
+        FloatingPointFormatter::Format((char *) patterns.data(), (char *) dst.data(),
+                                       count * sizeof(float), count, 5, false);
+        FloatingPointFormatter::Format((char *) dst.data(), (char *) back.data(),
+                                       count * sizeof(float), count, 5, true);
+        size_t misses = 0;
+        for (size_t i = 0; i < count; i++) {
+            uint32_t expected = Checker::IsLittleEndianMachine() ? reference_swap(patterns[i]) : patterns[i];
+            misses += dst[i] != expected;
+            misses += back[i] != patterns[i];
+        }
+        REQUIRE(misses == 0);
+    }
+}
+
+void
+TEST_INTEGER_FORMAT() {
+    float src[7] = {0.0f, 1.4f, -1.5f, 2.5f, -100.0f, 1e10f, -1e10f};
+    float dst[7];
+
+    SECTION("4 Byte Integer") {
+        /* The largest float below 2^31 is the upper saturation value. */
+        int32_t expected[7] = {0, 1, -2, 3, -100, 2147483520, INT32_MIN};
+        uint32_t formatted[7];
+        FloatingPointFormatter::Format((char *) src, (char *) formatted, 7 * sizeof(float), 7, 2, false);
+        for (int i = 0; i < 7; i++) {
+            uint32_t value = Checker::IsLittleEndianMachine() ? reference_swap(formatted[i]) : formatted[i];
+            REQUIRE((int32_t) value == expected[i]);
+        }
+        FloatingPointFormatter::Format((char *) formatted, (char *) dst, 7 * sizeof(int32_t), 7, 2, true);
+        for (int i = 0; i < 7; i++) {
+            REQUIRE(dst[i] == (float) expected[i]);
+        }
+    }
+
+    SECTION("2 Byte Integer") {
+        int16_t expected[7] = {0, 1, -2, 3, -100, INT16_MAX, INT16_MIN};
+        uint16_t formatted[7];
+        FloatingPointFormatter::Format((char *) src, (char *) formatted, 7 * sizeof(float), 7, 3, false);
+        for (int i = 0; i < 7; i++) {
+            uint16_t value = formatted[i];
+            if (Checker::IsLittleEndianMachine()) {
+                value = (uint16_t) ((value << 8) | (value >> 8));
+            }
+            REQUIRE((int16_t) value == expected[i]);
+        }
+        FloatingPointFormatter::Format((char *) formatted, (char *) dst, 7 * sizeof(int16_t), 7, 3, true);
+        for (int i = 0; i < 7; i++) {
+            REQUIRE(dst[i] == (float) expected[i]);
+        }
+    }
+
+    SECTION("Rounding Close To Halves") {
+        /* Adding a half before truncating rounds these values the wrong way. */
+        float near_halves[4] = {0.49999997f, -0.49999997f, 8388609.0f, -8388609.0f};
+        int32_t expected[4] = {0, 0, 8388609, -8388609};
+        uint32_t formatted[4];
+        FloatingPointFormatter::Format((char *) near_halves, (char *) formatted, 4 * sizeof(float), 4, 2, false);
+        for (int i = 0; i < 4; i++) {
+            uint32_t value = Checker::IsLittleEndianMachine() ? reference_swap(formatted[i]) : formatted[i];
+            REQUIRE((int32_t) value == expected[i]);
+        }
+    }
+
+    SECTION("1 Byte Integer") {
+        int8_t expected[7] = {0, 1, -2, 3, -100, INT8_MAX, INT8_MIN};
+        int8_t formatted[7];
+        FloatingPointFormatter::Format((char *) src, (char *) formatted, 7 * sizeof(float), 7, 8, false);
+        for (int i = 0; i < 7; i++) {
+            REQUIRE(formatted[i] == expected[i]);
+        }
+        FloatingPointFormatter::Format((char *) formatted, (char *) dst, 7 * sizeof(int8_t), 7, 8, true);
+        for (int i = 0; i < 7; i++) {
+            REQUIRE(dst[i] == (float) expected[i]);
+        }
+    }
+}
+
+
 /**
  * REQUIRED TESTS:
  *
@@ -69,3 +268,11 @@ TEST_FLOAT_FORMAT() {
 TEST_CASE("Floating Point Formatter") {
     TEST_FLOAT_FORMAT();
 }
+
+TEST_CASE("Floating Point Formatter - Bit Exact IBM and IEEE") {
+    TEST_FLOAT_FORMAT_BIT_EXACT();
+}
+
+TEST_CASE("Floating Point Formatter - Integer Formats") {
+    TEST_INTEGER_FORMAT();
+}
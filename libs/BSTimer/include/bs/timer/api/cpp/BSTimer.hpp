@@ -25,11 +25,13 @@
 
 /// CONFIGURATIONS
 #include <bs/timer/configurations/TimerManager.hpp>
+#include <bs/timer/configurations/ChannelHandle.hpp>
 
 /// TIMERS
 #include <bs/timer/core/timers/concrete/ElasticTimer.hpp>
 #include <bs/timer/core/timers/concrete/ScopeTimer.hpp>
 #include <bs/timer/core/timers/concrete/LazyTimer.hpp>
+#include <bs/timer/core/timers/concrete/HandleTimer.hpp>
 
 /// SNAPSHOTS
 #include <bs/timer/core/snapshots/helpers/GenericSnapshot.hpp>
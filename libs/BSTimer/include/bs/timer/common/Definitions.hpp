@@ -26,6 +26,8 @@ namespace bs {
             namespace definitions {
 
 #define BS_TIMER_EXT                     ".bs.timer"             /* Extension used for flushed files.*/
+#define BS_TIMER_THREAD_SLOTS            128                     /* Per thread accumulators kept by each handle channel. */
+#define BS_TIMER_HISTOGRAM_BINS          40                      /* Power of two nanoseconds bins of the runtimes histogram. */
 
 #define BS_TIMER_TU_MILLI                1e-3                    /* The conversion unit used for converting seconds to milliseconds. */
 #define BS_TIMER_TU_MICRO                1e-6                    /* The conversion unit used for converting seconds to microseconds. */
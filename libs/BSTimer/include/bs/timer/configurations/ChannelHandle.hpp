@@ -0,0 +1,75 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of BS Timer.
+ *
+ * BS Timer is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * BS Timer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BS_TIMER_CONFIGURATIONS_CHANNEL_HANDLE_HPP
+#define BS_TIMER_CONFIGURATIONS_CHANNEL_HANDLE_HPP
+
+#include <string>
+
+#include <bs/timer/configurations/TimerChannel.hpp>
+
+namespace bs {
+    namespace timer {
+        namespace configurations {
+            /**
+             * @brief Handle to a pre-registered TimerChannel, for timing hot paths.
+             * <br>
+             * The channel is looked up (or registered) once when the handle is created,
+             * recording through the handle afterwards only updates the calling thread
+             * accumulator, without allocations, locks or map lookups.
+             * <br>
+             * The recorded runtimes are reported along the other timers of the channel,
+             * with their count, total, average, extremes, variance and histogram.
+             */
+            class ChannelHandle {
+            public:
+                /**
+                 * @brief Constructor that takes the name of the channel to record into.
+                 * @param aChannelName
+                 */
+                explicit ChannelHandle(const std::string &aChannelName);
+
+                /**
+                 * @brief Default destructor.
+                 */
+                ~ChannelHandle() = default;
+
+                /**
+                 * @brief Accumulates a runtime into the channel.
+                 * @param aRuntime
+                 * Runtime in seconds.
+                 */
+                inline void
+                Record(double aRuntime) const { this->mpChannel->Record(aRuntime); }
+
+                /**
+                 * @return Pointer to the channel recorded into.
+                 */
+                inline TimerChannel::Pointer
+                GetChannel() const { return this->mpChannel; }
+
+            private:
+                /// The channel recorded into.
+                TimerChannel::Pointer mpChannel;
+            };
+        } //namespace configurations
+    } //namespace timer
+}//namespace bs
+
+#endif // BS_TIMER_CONFIGURATIONS_CHANNEL_HANDLE_HPP
@@ -24,6 +24,7 @@
 
 #include <bs/timer/core/timers/interface/Timer.hpp>
 #include <bs/timer/data-units/ChannelStats.hpp>
+#include <bs/timer/data-units/RuntimeAccumulator.hpp>
 #include <bs/timer/core/snapshots/interface/Snapshot.hpp>
 
 namespace bs {
@@ -104,6 +105,25 @@ namespace bs {
             void
             AddSnapshot(core::snapshots::Snapshot *apSnapshot);
 
+            /**
+             * @brief Allocates the per thread accumulators used by the channel handles,
+             * if not already allocated.
+             */
+            void
+            EnableThreadAccumulators();
+
+            /**
+             * @brief Accumulates a runtime into the calling thread accumulator.
+             * Doesn't allocate nor go through the channels map.
+             *
+             * @param aRuntime
+             * Runtime in seconds.
+             *
+             * @note EnableThreadAccumulators() must have been called beforehand.
+             */
+            void
+            Record(double aRuntime);
+
             /**
              * @brief Returns a ChannelStats object holding all data regarding this channel.
              * @return ChannelStats
@@ -118,6 +138,8 @@ namespace bs {
             std::vector<Timer *> mTimers;
             /// Data objects accompanied with this channel.
             dataunits::ChannelStats mChannelStats;
+            /// Per thread accumulators of the runtimes recorded through handles.
+            std::vector<dataunits::RuntimeAccumulator> mThreadAccumulators;
         };
     }//namespace timer
 }//namespace bs
@@ -20,6 +20,8 @@
 #ifndef BS_TIMER_CONFIGURATIONS_MANGER_HPP
 #define BS_TIMER_CONFIGURATIONS_MANGER_HPP
 
+#include <mutex>
+
 #include <bs/base//common/Singleton.tpp>
 #include <bs/base/configurations/interface/ConfigurationMap.hpp>
 #include <bs/base/configurations/interface/Configurable.hpp>
@@ -116,6 +118,17 @@ namespace bs {
 
                 void RegisterChannel(const TimerChannel::Pointer &apChannel);
 
+                /**
+                 * @brief Registers a new channel with the given name and kernel data,
+                 * unless a channel with the same name is already registered.
+                 * @return Pointer to the channel registered with the given name.
+                 */
+                TimerChannel::Pointer
+                RegisterChannel(const std::string &aChannelName,
+                                int aGridSize = -1,
+                                int aDataSize = -1,
+                                int aFLOPS = -1);
+
                 /**
                  * @brief Getter for time precision.
                  *
@@ -138,6 +151,8 @@ namespace bs {
             private:
                 /// Map of all TimerChannel objects.
                 TimerChannel::Map mChannelMap;
+                /// Guards the channels map, as timers may be created by several threads.
+                std::mutex mChannelMapMutex;
                 /// Configuration map.
                 bs::base::configurations::ConfigurationMap *mpConfigurationMap;
                 /// Time precision.
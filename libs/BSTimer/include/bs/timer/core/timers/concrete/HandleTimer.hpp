@@ -0,0 +1,69 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of BS Timer.
+ *
+ * BS Timer is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * BS Timer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BS_TIMER_CORE_HANDLE_TIMER_HPP
+#define BS_TIMER_CORE_HANDLE_TIMER_HPP
+
+#include <chrono>
+
+#include <bs/timer/configurations/ChannelHandle.hpp>
+
+namespace bs {
+    namespace timer {
+        /**
+         * @brief Scope timer for hot paths. Takes a pre-registered channel handle,
+         * reads the clock once when constructed and once when destructed, and
+         * records the elapsed time into the calling thread accumulator of the channel.
+         *
+         * @note Unlike ScopeTimer, it keeps no snapshots, so the report of its
+         * channel has statistics but no per call runtimes.
+         */
+        class HandleTimer {
+        public:
+            /**
+             * @brief Constructor that takes the handle of the channel to record into.
+             * @param aHandle
+             */
+            explicit
+            HandleTimer(const configurations::ChannelHandle &aHandle)
+                    : mHandle(aHandle),
+                      mStart(std::chrono::steady_clock::now()) {}
+
+            /**
+             * @brief Destructor, recording the elapsed time.
+             */
+            ~HandleTimer() {
+                std::chrono::duration<double> runtime = std::chrono::steady_clock::now() - this->mStart;
+                this->mHandle.Record(runtime.count());
+            }
+
+            HandleTimer(const HandleTimer &) = delete;
+
+            HandleTimer &operator=(const HandleTimer &) = delete;
+
+        private:
+            /// The handle of the channel recorded into.
+            const configurations::ChannelHandle &mHandle;
+            /// Start time.
+            std::chrono::steady_clock::time_point mStart;
+        };
+    }//namespace timer
+}//namespace bs
+
+#endif // BS_TIMER_CORE_HANDLE_TIMER_HPP
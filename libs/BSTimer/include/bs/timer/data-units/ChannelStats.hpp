@@ -25,6 +25,7 @@
 #include <bs/timer/utils/stats/StatisticsHelper.hpp>
 #include <bs/timer/common/Definitions.hpp>
 #include <bs/timer/core/snapshots/interface/Snapshot.hpp>
+#include <bs/timer/data-units/RuntimeAccumulator.hpp>
 
 namespace bs {
     namespace timer {
@@ -59,6 +60,14 @@ namespace bs {
                 void
                 AddSnapshot(core::snapshots::Snapshot *apSnapshot);
 
+                /**
+                 * @brief Sets the runtimes accumulated by the channel handles, which are
+                 * accounted for alongside the snapshots runtimes in all statistics.
+                 * @param aAccumulator
+                 */
+                void
+                SetAccumulatedRuntimes(const RuntimeAccumulator &aAccumulator);
+
                 /**
                  * @brief Calls all resolve functions of current snapshots
                  */
@@ -141,6 +150,12 @@ namespace bs {
                 std::vector<double>
                 GetBandwidths();
 
+                /**
+                 * @return Histogram of all runtimes, see RuntimeAccumulator::GetHistogram().
+                 */
+                std::vector<uint64_t>
+                GetHistogram();
+
                 /**
                  * @return Number of calls for a function.
                  */
@@ -225,6 +240,13 @@ namespace bs {
                 int
                 GetNumberOfOperations() const;
 
+            private:
+                /**
+                 * @brief Combines the snapshots runtimes with the handles accumulated ones.
+                 */
+                RuntimeAccumulator
+                GetAccumulator() const;
+
             private:
                 /// A map that holds all statistics of a channel object.
                 std::map<std::string, double> mStatisticsMap;
@@ -234,6 +256,8 @@ namespace bs {
                 std::vector<double> mBandwidths;
                 /// Number of times the function is called.
                 unsigned int mNumberOfCalls;
+                /// Runtimes accumulated by the channel handles.
+                RuntimeAccumulator mAccumulatedRuntimes;
                 /// Vector of snapshots accompanied with this timer.
                 std::vector<core::snapshots::Snapshot *> mSnapshots;
                 /// Grid size
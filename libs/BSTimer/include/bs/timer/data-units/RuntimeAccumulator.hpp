@@ -0,0 +1,155 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of BS Timer.
+ *
+ * BS Timer is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * BS Timer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BS_TIMER_DATA_UNITS_RUNTIME_ACCUMULATOR_HPP
+#define BS_TIMER_DATA_UNITS_RUNTIME_ACCUMULATOR_HPP
+
+#include <cstdint>
+
+#include <bs/timer/common/Definitions.hpp>
+
+namespace bs {
+    namespace timer {
+        namespace dataunits {
+            /**
+             * @brief Fixed size accumulator of runtimes, keeping their count, total,
+             * running mean and variance, extremes and a power of two histogram.
+             * Adding a runtime never allocates, so it can be used on hot paths.
+             *
+             * @note Aligned to a cache line so that per thread accumulators kept
+             * next to each other don't share lines.
+             */
+            class alignas(64) RuntimeAccumulator {
+            public:
+                /**
+                 * @brief Constructor.
+                 */
+                RuntimeAccumulator();
+
+                /**
+                 * @brief Adds a runtime to the accumulator.
+                 * @param aRuntime
+                 * Runtime in seconds.
+                 */
+                inline void
+                Add(double aRuntime) {
+                    this->mCount++;
+                    this->mTotal += aRuntime;
+                    double delta = aRuntime - this->mMean;
+                    this->mMean += delta / this->mCount;
+                    this->mM2 += delta * (aRuntime - this->mMean);
+                    if (this->mCount == 1 || aRuntime < this->mMin) {
+                        this->mMin = aRuntime;
+                    }
+                    if (this->mCount == 1 || aRuntime > this->mMax) {
+                        this->mMax = aRuntime;
+                    }
+                    this->mHistogram[RuntimeAccumulator::GetBin(aRuntime)]++;
+                }
+
+                /**
+                 * @brief Merges the runtimes accumulated by another accumulator into this one.
+                 * @param aAccumulator
+                 */
+                void
+                Merge(const RuntimeAccumulator &aAccumulator);
+
+                /**
+                 * @brief Clears all accumulated runtimes.
+                 */
+                void
+                Reset();
+
+                /**
+                 * @return Number of accumulated runtimes.
+                 */
+                inline uint64_t
+                GetCount() const { return this->mCount; }
+
+                /**
+                 * @return Total of accumulated runtimes.
+                 */
+                inline double
+                GetTotal() const { return this->mTotal; }
+
+                /**
+                 * @return Minimum runtime, zero if nothing was accumulated.
+                 */
+                inline double
+                GetMin() const { return this->mMin; }
+
+                /**
+                 * @return Maximum runtime, zero if nothing was accumulated.
+                 */
+                inline double
+                GetMax() const { return this->mMax; }
+
+                /**
+                 * @return Average runtime, zero if nothing was accumulated.
+                 */
+                inline double
+                GetAverage() const { return this->mMean; }
+
+                /**
+                 * @return Variance of the runtimes, zero if nothing was accumulated.
+                 */
+                double
+                GetVariance() const;
+
+                /**
+                 * @return Histogram of the runtimes, where bin i counts the runtimes
+                 * lasting [2^i, 2^(i+1)) nanoseconds, the first and last bins being open ended.
+                 */
+                inline const uint64_t *
+                GetHistogram() const { return this->mHistogram; }
+
+                /**
+                 * @return Histogram bin of the given runtime.
+                 */
+                static inline unsigned int
+                GetBin(double aRuntime) {
+                    auto nanoseconds = (uint64_t) (aRuntime * 1e9);
+                    if (aRuntime <= 0 || nanoseconds == 0) {
+                        return 0;
+                    }
+                    unsigned int bin = 63 - __builtin_clzll(nanoseconds);
+                    return bin < BS_TIMER_HISTOGRAM_BINS ? bin : BS_TIMER_HISTOGRAM_BINS - 1;
+                }
+
+            private:
+                /// Number of accumulated runtimes.
+                uint64_t mCount;
+                /// Total of accumulated runtimes.
+                double mTotal;
+                /// Running mean of accumulated runtimes.
+                double mMean;
+                /// Running sum of squared differences from the mean.
+                double mM2;
+                /// Minimum runtime.
+                double mMin;
+                /// Maximum runtime.
+                double mMax;
+                /// Power of two nanoseconds histogram.
+                uint64_t mHistogram[BS_TIMER_HISTOGRAM_BINS];
+            };
+        }//namespace dataunits
+    }//namespace timer
+}//namespace bs
+
+#endif // BS_TIMER_DATA_UNITS_RUNTIME_ACCUMULATOR_HPP
@@ -17,11 +17,27 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <atomic>
+#include <mutex>
+
 #include <bs/timer/configurations/TimerChannel.hpp>
 
 using namespace bs::timer;
 using namespace bs::timer::dataunits;
 
+/*
+ * Each thread recording through handles gets its own accumulator slot,
+ * threads beyond the slots count share the last one under a lock.
+ */
+static std::atomic<unsigned int> next_thread_slot(0);
+static thread_local unsigned int thread_slot = next_thread_slot++;
+static std::mutex shared_slot_mutex;
+/*
+ * Guards the allocation of the accumulators, as handles of the same channel
+ * may be created from several threads while others are reporting its stats.
+ */
+static std::mutex accumulators_mutex;
+
 
 TimerChannel::~TimerChannel() {
     for (auto timer : this->mTimers) {
@@ -41,8 +57,34 @@ TimerChannel::AddSnapshot(core::snapshots::Snapshot *apSnapshot) {
     this->mChannelStats.AddSnapshot(apSnapshot);
 }
 
+void
+TimerChannel::EnableThreadAccumulators() {
+    std::lock_guard<std::mutex> lock(accumulators_mutex);
+    if (this->mThreadAccumulators.empty()) {
+        this->mThreadAccumulators.resize(BS_TIMER_THREAD_SLOTS);
+    }
+}
+
+void
+TimerChannel::Record(double aRuntime) {
+    if (thread_slot < BS_TIMER_THREAD_SLOTS - 1) {
+        this->mThreadAccumulators[thread_slot].Add(aRuntime);
+    } else {
+        std::lock_guard<std::mutex> lock(shared_slot_mutex);
+        this->mThreadAccumulators[BS_TIMER_THREAD_SLOTS - 1].Add(aRuntime);
+    }
+}
+
 ChannelStats &
 TimerChannel::GetChannelStats() {
+    std::lock_guard<std::mutex> lock(accumulators_mutex);
+    if (!this->mThreadAccumulators.empty()) {
+        RuntimeAccumulator accumulator;
+        for (auto const &thread_accumulator : this->mThreadAccumulators) {
+            accumulator.Merge(thread_accumulator);
+        }
+        this->mChannelStats.SetAccumulatedRuntimes(accumulator);
+    }
     return this->mChannelStats;
 }
 
@@ -56,6 +56,7 @@ TimerManager::Terminate(bool aCleanup) {
 
 TimerChannel::Pointer
 TimerManager::Get(const char *apChannelName) {
+    std::lock_guard<std::mutex> lock(this->mChannelMapMutex);
     return this->mChannelMap[apChannelName];
 }
 
@@ -97,12 +98,27 @@ TimerManager::Report(std::ostream &aOutputStream, const std::string &aChannelNam
 
 void
 TimerManager::RegisterChannel(const TimerChannel::Pointer &apChannel) {
+    std::lock_guard<std::mutex> lock(this->mChannelMapMutex);
     if (this->mChannelMap.count(apChannel->GetName()) == 0) {
         /* New channel being registered. */
         this->mChannelMap[apChannel->GetName()] = apChannel;
     }
 }
 
+TimerChannel::Pointer
+TimerManager::RegisterChannel(const std::string &aChannelName,
+                              int aGridSize,
+                              int aDataSize,
+                              int aFLOPS) {
+    std::lock_guard<std::mutex> lock(this->mChannelMapMutex);
+    auto &channel = this->mChannelMap[aChannelName];
+    if (channel == nullptr) {
+        /* New channel being registered. */
+        channel = std::make_shared<TimerChannel>(aChannelName, aGridSize, aDataSize, aFLOPS);
+    }
+    return channel;
+}
+
 TimerChannel::Map
 TimerManager::GetMap() {
     return this->mChannelMap;
@@ -17,6 +17,8 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <mutex>
+
 #include <bs/base/common/ExitCodes.hpp>
 
 #include <bs/timer/core/timers/concrete/ElasticTimer.hpp>
@@ -28,9 +30,15 @@ using namespace bs::timer;
 using namespace bs::timer::configurations;
 using namespace bs::timer::core::snapshots;
 
+/*
+ * Guards the channels registration and their snapshots lists, as timers
+ * may be used by helper threads (e.g. background I/O) alongside the main one.
+ */
+static std::mutex channels_mutex;
 
 ElasticTimer::ElasticTimer(const TimerChannel::Pointer &apChannel, SnapshotTarget aSnapshotTarget) {
-    TimerManager::GetInstance()->RegisterChannel(make_shared<TimerChannel>(*new TimerChannel(apChannel->GetName())));
+    std::lock_guard<std::mutex> lock(channels_mutex);
+    TimerManager::GetInstance()->RegisterChannel(apChannel->GetName());
     this->mpSnapshot = new GenericSnapshot(aSnapshotTarget);
     this->mpChannel = apChannel;
     apChannel.get()->AddTimer(this);
@@ -38,10 +46,10 @@ ElasticTimer::ElasticTimer(const TimerChannel::Pointer &apChannel, SnapshotTarge
 }
 
 ElasticTimer::ElasticTimer(const char *apChannelName, SnapshotTarget aSnapshotTarget) {
-    TimerManager::GetInstance()->RegisterChannel(make_shared<TimerChannel>(*new TimerChannel(apChannelName)));
+    std::lock_guard<std::mutex> lock(channels_mutex);
+    this->mpChannel = TimerManager::GetInstance()->RegisterChannel(apChannelName);
     this->mpSnapshot = new GenericSnapshot(aSnapshotTarget);
-    this->mpChannel = configurations::TimerManager::GetInstance()->Get(apChannelName);
-    configurations::TimerManager::GetInstance()->Get(apChannelName).get()->AddTimer(this);
+    this->mpChannel->AddTimer(this);
     this->mIsActive = false;
 }
 
@@ -57,15 +65,15 @@ ElasticTimer::ElasticTimer(const char *apChannelName,
     } else {
         data_size = aArrays * aGridSize * 8;
     }
-    TimerManager::GetInstance()->RegisterChannel(
-            make_shared<TimerChannel>(*new TimerChannel(apChannelName, aGridSize, data_size, aOperations)));
+    std::lock_guard<std::mutex> lock(channels_mutex);
+    this->mpChannel = TimerManager::GetInstance()->RegisterChannel(apChannelName, aGridSize, data_size, aOperations);
     this->mpSnapshot = new GenericSnapshot(aSnapshotTarget);
-    this->mpChannel = configurations::TimerManager::GetInstance()->Get(apChannelName);
-    configurations::TimerManager::GetInstance()->Get(apChannelName).get()->AddTimer(this);
+    this->mpChannel->AddTimer(this);
     this->mIsActive = false;
 }
 
 ElasticTimer::~ElasticTimer() {
+    std::lock_guard<std::mutex> lock(channels_mutex);
     this->mIsActive = false;
     this->mpChannel->RemoveTimer(this);
     this->mpSnapshot = nullptr;
@@ -96,6 +104,7 @@ ElasticTimer::Stop() {
 
 void
 ElasticTimer::FlushSnapshot() {
+    std::lock_guard<std::mutex> lock(channels_mutex);
     this->mpChannel->AddSnapshot(this->mpSnapshot);
 }
 
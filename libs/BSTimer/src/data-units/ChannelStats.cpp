@@ -17,6 +17,7 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cmath>
 #include <iostream>
 
 #include <bs/timer/data-units/ChannelStats.hpp>
@@ -51,6 +52,11 @@ ChannelStats::AddSnapshot(core::snapshots::Snapshot *apSnapshot) {
     this->mSnapshots.push_back(apSnapshot);
 }
 
+void
+ChannelStats::SetAccumulatedRuntimes(const RuntimeAccumulator &aAccumulator) {
+    this->mAccumulatedRuntimes = aAccumulator;
+}
+
 void
 ChannelStats::Resolve() {
     if (!mResolved) {
@@ -103,32 +109,32 @@ ChannelStats::GetMap() {
 
 double
 ChannelStats::GetTotal() {
-    return utils::stats::StatisticsHelper::GetTotal(this->mRuntimes);
+    return this->GetAccumulator().GetTotal();
 }
 
 double
 ChannelStats::GetMaxRuntime() {
-    return utils::stats::StatisticsHelper::GetMax(this->mRuntimes);
+    return this->GetAccumulator().GetMax();
 }
 
 double
 ChannelStats::GetMinRuntime() {
-    return utils::stats::StatisticsHelper::GetMin(this->mRuntimes);
+    return this->GetAccumulator().GetMin();
 }
 
 double
 ChannelStats::GetAverageRuntime() {
-    return utils::stats::StatisticsHelper::GetAverage(this->mRuntimes);
+    return this->GetAccumulator().GetAverage();
 }
 
 double
 ChannelStats::GetVariance() {
-    return utils::stats::StatisticsHelper::GetVariance(this->mRuntimes);
+    return this->GetAccumulator().GetVariance();
 }
 
 double
 ChannelStats::GetDeviation() {
-    return utils::stats::StatisticsHelper::GetDeviation(this->mRuntimes);
+    return sqrt(this->GetVariance());
 }
 
 vector<double>
@@ -136,9 +142,15 @@ ChannelStats::GetRuntimes() {
     return this->mRuntimes;
 }
 
+vector<uint64_t>
+ChannelStats::GetHistogram() {
+    auto histogram = this->GetAccumulator().GetHistogram();
+    return vector<uint64_t>(histogram, histogram + BS_TIMER_HISTOGRAM_BINS);
+}
+
 unsigned int
 ChannelStats::GetNumberOfCalls() const {
-    return this->mNumberOfCalls;
+    return this->mNumberOfCalls + this->mAccumulatedRuntimes.GetCount();
 }
 
 int
@@ -205,3 +217,13 @@ vector<double>
 ChannelStats::GetBandwidths() {
     return this->mBandwidths;
 }
+
+RuntimeAccumulator
+ChannelStats::GetAccumulator() const {
+    RuntimeAccumulator accumulator;
+    for (auto runtime : this->mRuntimes) {
+        accumulator.Add(runtime);
+    }
+    accumulator.Merge(this->mAccumulatedRuntimes);
+    return accumulator;
+}
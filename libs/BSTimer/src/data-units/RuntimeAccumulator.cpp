@@ -0,0 +1,77 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of BS Timer.
+ *
+ * BS Timer is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * BS Timer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+
+#include <bs/timer/data-units/RuntimeAccumulator.hpp>
+
+using namespace bs::timer::dataunits;
+
+
+RuntimeAccumulator::RuntimeAccumulator() {
+    this->Reset();
+}
+
+void
+RuntimeAccumulator::Merge(const RuntimeAccumulator &aAccumulator) {
+    if (aAccumulator.mCount == 0) {
+        return;
+    }
+    if (this->mCount == 0) {
+        *this = aAccumulator;
+        return;
+    }
+    /* Chan et al. pairwise combination of the running mean and variance. */
+    uint64_t count = this->mCount + aAccumulator.mCount;
+    double delta = aAccumulator.mMean - this->mMean;
+    this->mM2 += aAccumulator.mM2 +
+                 delta * delta * ((double) this->mCount * aAccumulator.mCount / count);
+    this->mMean += delta * aAccumulator.mCount / count;
+    this->mCount = count;
+    this->mTotal += aAccumulator.mTotal;
+    if (aAccumulator.mMin < this->mMin) {
+        this->mMin = aAccumulator.mMin;
+    }
+    if (aAccumulator.mMax > this->mMax) {
+        this->mMax = aAccumulator.mMax;
+    }
+    for (int bin = 0; bin < BS_TIMER_HISTOGRAM_BINS; bin++) {
+        this->mHistogram[bin] += aAccumulator.mHistogram[bin];
+    }
+}
+
+void
+RuntimeAccumulator::Reset() {
+    this->mCount = 0;
+    this->mTotal = 0;
+    this->mMean = 0;
+    this->mM2 = 0;
+    this->mMin = 0;
+    this->mMax = 0;
+    memset(this->mHistogram, 0, sizeof(this->mHistogram));
+}
+
+double
+RuntimeAccumulator::GetVariance() const {
+    double variance = 0;
+    if (this->mCount > 0) {
+        variance = this->mM2 / this->mCount;
+    }
+    return variance;
+}
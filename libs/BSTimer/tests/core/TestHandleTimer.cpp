@@ -0,0 +1,129 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of BS Timer.
+ *
+ * BS Timer is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * BS Timer is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <prerequisites/libraries/catch/catch.hpp>
+
+#include <bs/timer/configurations/ChannelHandle.hpp>
+#include <bs/timer/configurations/TimerManager.hpp>
+#include <bs/timer/core/timers/concrete/ElasticTimer.hpp>
+#include <bs/timer/core/timers/concrete/HandleTimer.hpp>
+#include <bs/timer/reporter/TimerReporter.hpp>
+#include <bs/timer/test-utils/FunctionsGenerator.hpp>
+
+using namespace std;
+using namespace bs::timer;
+using namespace bs::timer::configurations;
+using namespace bs::timer::dataunits;
+using namespace bs::timer::reporter;
+using namespace bs::timer::testutils;
+
+
+TEST_CASE("HandleTimer - Class", "[Core]") {
+    /* Pre-cleanup. */
+
+    TimerManager::Kill();
+
+    SECTION("Accumulator") {
+        RuntimeAccumulator accumulator;
+        REQUIRE(accumulator.GetCount() == 0);
+        REQUIRE(accumulator.GetMin() == 0);
+        REQUIRE(accumulator.GetMax() == 0);
+
+        vector<double> runtimes = {3e-9, 1e-6, 2.5e-3, 4e-6, 1e-6};
+        RuntimeAccumulator first;
+        RuntimeAccumulator second;
+        for (size_t i = 0; i < runtimes.size(); i++) {
+            accumulator.Add(runtimes[i]);
+            (i < 2 ? first : second).Add(runtimes[i]);
+        }
+        first.Merge(second);
+
+        double average = 0;
+        for (auto runtime : runtimes) {
+            average += runtime / runtimes.size();
+        }
+        double variance = 0;
+        for (auto runtime : runtimes) {
+            variance += (runtime - average) * (runtime - average) / runtimes.size();
+        }
+
+        for (auto const &merged : {accumulator, first}) {
+            REQUIRE(merged.GetCount() == 5);
+            REQUIRE(merged.GetMin() == 3e-9);
+            REQUIRE(merged.GetMax() == 2.5e-3);
+            REQUIRE(merged.GetAverage() == Approx(average));
+            REQUIRE(merged.GetVariance() == Approx(variance));
+            REQUIRE(merged.GetHistogram()[1] == 1);
+            REQUIRE(merged.GetHistogram()[RuntimeAccumulator::GetBin(1e-6)] == 2);
+            REQUIRE(merged.GetHistogram()[RuntimeAccumulator::GetBin(2.5e-3)] == 1);
+        }
+        REQUIRE(RuntimeAccumulator::GetBin(0) == 0);
+        REQUIRE(RuntimeAccumulator::GetBin(1e6) == BS_TIMER_HISTOGRAM_BINS - 1);
+    }
+
+    SECTION("Handle") {
+        ChannelHandle handle("Hot Kernel");
+        {
+            HandleTimer timer(handle);
+            target_technology_test_function();
+        }
+        handle.Record(1.0);
+
+        /* An elastic timer of the same channel is accounted for as well. */
+        ElasticTimer elastic_timer("Hot Kernel");
+        elastic_timer.Start();
+        elastic_timer.Stop();
+
+        TimerReporter r;
+        r.Resolve();
+        auto stats = r.GetMap("Hot Kernel");
+        REQUIRE(r.GetStats()["Hot Kernel"].GetNumberOfCalls() == 3);
+        REQUIRE(stats[BS_TIMER_K_MAX_RUNTIME] == 1.0);
+        REQUIRE(stats[BS_TIMER_K_MIN_RUNTIME] < 1.0);
+        REQUIRE(stats[BS_TIMER_K_TOTAL] > 1.0);
+    }
+
+    SECTION("Threads") {
+        ChannelHandle handle("Shared Kernel");
+        const int threads_count = BS_TIMER_THREAD_SLOTS + 4;
+        const int records = 100;
+        vector<thread> threads;
+        for (int i = 0; i < threads_count; i++) {
+            threads.emplace_back([&handle]() {
+                for (int record = 0; record < records; record++) {
+                    handle.Record(1e-3);
+                }
+            });
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+        auto &stats = handle.GetChannel()->GetChannelStats();
+        REQUIRE(stats.GetNumberOfCalls() == threads_count * records);
+        REQUIRE(stats.GetTotal() == Approx(threads_count * records * 1e-3));
+        REQUIRE(stats.GetHistogram()[RuntimeAccumulator::GetBin(1e-3)] == threads_count * records);
+    }
+
+    /* Cleanup. */
+
+    TimerManager::GetInstance()->Terminate(true);
+}
@@ -38,6 +38,7 @@ namespace operations {
                 this->mBlockX = 512;
                 this->mBlockY = 15;
                 this->mBlockZ = 44;
+                this->mBlockT = 1;
                 this->mThreadCount = 16;
 
                 this->mSourceFrequency = 200;
@@ -333,6 +334,30 @@ namespace operations {
                 this->mBackWindow = aBackWindow;
             };
 
+            inline bool IsAdaptiveWindow() const {
+                return this->mIsAdaptiveWindow;
+            }
+
+            inline void SetIsAdaptiveWindow(bool aIsAdaptiveWindow) {
+                this->mIsAdaptiveWindow = aIsAdaptiveWindow;
+            }
+
+            inline int GetWindowAperture() const {
+                return this->mWindowAperture;
+            }
+
+            inline void SetWindowAperture(int aWindowAperture) {
+                this->mWindowAperture = aWindowAperture;
+            }
+
+            inline float GetWindowApertureAngle() const {
+                return this->mWindowApertureAngle;
+            }
+
+            inline void SetWindowApertureAngle(float aWindowApertureAngle) {
+                this->mWindowApertureAngle = aWindowApertureAngle;
+            }
+
             inline int GetAlgorithm() const {
                 return this->mAlgorithm;
             }
@@ -365,6 +390,14 @@ namespace operations {
                 this->mBlockZ = block_z;
             }
 
+            uint GetBlockT() const {
+                return this->mBlockT;
+            }
+
+            void SetBlockT(uint block_t) {
+                this->mBlockT = block_t;
+            }
+
             uint GetThreadCount() const {
                 return this->mThreadCount;
             }
@@ -430,6 +463,17 @@ namespace operations {
             /// Backward window size.
             int mBackWindow = 0;
 
+            /// Place the window over the source and receivers span of each shot,
+            /// instead of around the source only.
+            bool mIsAdaptiveWindow = false;
+
+            /// Margin added around the source and receivers span in adaptive mode.
+            int mWindowAperture = 0;
+
+            /// Largest angle from the vertical, in degrees, under which the adaptive
+            /// window must see the source and receivers span, 0 to keep the full depth.
+            float mWindowApertureAngle = 0;
+
             /// Algorithm
             /// (i.e. -> RTM | PSDM | PSTM | FWI)
             ALGORITHM mAlgorithm;
@@ -443,6 +487,9 @@ namespace operations {
             /// Cache blocking in Z
             uint mBlockZ;
 
+            /// Temporal blocking, number of time steps advanced per tile
+            uint mBlockT;
+
             /// Number of threads
             uint mThreadCount;
         };
@@ -59,7 +59,10 @@ enum GRID_SAMPLING {
     UNIFORM, VARIABLE
 };
 enum INTERPOLATION {
-    NONE, SPLINE, TRILINEAR
+    NONE, SPLINE, TRILINEAR, LINEAR, SINC
+};
+enum INJECTION {
+    POINT_INJECTION, SINC_INJECTION
 };
 enum ALGORITHM {
     RTM, FWI, PSDM, PSTM
@@ -35,6 +35,7 @@
 #include <operations/components/independents/concrete/boundary-managers/StaggeredCPMLBoundaryManager.hpp>
 
 /// FORWARD COLLECTORS
+#include <operations/components/independents/concrete/forward-collectors/CheckpointPropagation.hpp>
 #include <operations/components/independents/concrete/forward-collectors/ReversePropagation.hpp>
 #include <operations/components/independents/concrete/forward-collectors/TwoPropagation.hpp>
 
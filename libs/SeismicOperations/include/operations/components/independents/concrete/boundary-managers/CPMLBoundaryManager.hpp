@@ -54,6 +54,14 @@ namespace operations {
 
             void AcquireConfiguration() override;
 
+            bool IsFusedInKernel() override;
+
+            void UpdateTile(float *apCurrent, int aStartX, int aEndX,
+                            int aStartZ, int aEndZ) override;
+
+            void ApplyTile(float *apNext, int aStartX, int aEndX,
+                           int aStartZ, int aEndZ) override;
+
         private:
             template<int DIRECTION_>
             void FillCPMLCoefficients();
@@ -67,6 +75,30 @@ namespace operations {
             template<int HALF_LENGTH_>
             void ApplyAllCPML();
 
+            /**
+             * @brief Updates the first auxiliary and the pressure part of the second
+             * auxiliary of the part of the tile inside the given boundary strip.
+             */
+            template<int DIRECTION_, bool OPPOSITE_, int HALF_LENGTH_>
+            void CalculateTileAuxiliary(float *apCurrent, int aStartX, int aEndX,
+                                        int aStartZ, int aEndZ);
+
+            /**
+             * @brief Completes the second auxiliary and adds the CPML value to the part
+             * of the tile inside the given boundary strip.
+             */
+            template<int DIRECTION_, bool OPPOSITE_, int HALF_LENGTH_>
+            void CalculateTileCPMLValue(float *apNext, int aStartX, int aEndX,
+                                        int aStartZ, int aEndZ);
+
+            template<int HALF_LENGTH_>
+            void UpdateAllTileCPML(float *apCurrent, int aStartX, int aEndX,
+                                   int aStartZ, int aEndZ);
+
+            template<int HALF_LENGTH_>
+            void ApplyAllTileCPML(float *apNext, int aStartX, int aEndX,
+                                  int aStartZ, int aEndZ);
+
             void InitializeVariables();
 
             void ResetVariables();
@@ -114,6 +146,8 @@ namespace operations {
             float mShiftRatio;
             float mReflectCoefficient;
             bool mUseTopLayer;
+            /// Whether the CPML is applied inside the computation kernel sweep.
+            bool mFusedSweep;
         };
     }//namespace components
 }//namespace operations
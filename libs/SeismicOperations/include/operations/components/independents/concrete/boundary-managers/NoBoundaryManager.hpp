@@ -49,6 +49,10 @@ namespace operations {
 
             void AdjustModelForBackward() override;
 
+            bool IsAppliedEachStep() override;
+
+            bool IsAppliedOnVelocity() override;
+
             void AcquireConfiguration() override;
 
         private:
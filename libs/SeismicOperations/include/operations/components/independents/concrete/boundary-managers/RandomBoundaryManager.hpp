@@ -20,6 +20,7 @@
 #ifndef OPERATIONS_LIB_COMPONENTS_BOUNDARY_MANAGERS_RANDOM_BOUNDARY_MANAGER_HPP
 #define OPERATIONS_LIB_COMPONENTS_BOUNDARY_MANAGERS_RANDOM_BOUNDARY_MANAGER_HPP
 
+#include <cstdint>
 #include <vector>
 
 #include <operations/components/independents/concrete/boundary-managers/extensions/Extension.hpp>
@@ -48,17 +49,30 @@ namespace operations {
 
             void ReExtendModel() override;
 
+            void SetShotId(uint aShotId) override;
+
             void SetComputationParameters(common::ComputationParameters *apParameters) override;
 
             void SetGridBox(dataunits::GridBox *apGridBox) override;
 
             void AdjustModelForBackward() override;
 
+            bool IsAppliedEachStep() override;
+
+            bool IsAppliedOnVelocity() override;
+
+            bool IsReExtendingFullModel() override;
+
             void AcquireConfiguration() override;
 
         private:
             void InitializeExtensions();
 
+            /**
+             * @brief Seeds the random extension for the given shot.
+             */
+            void SeedExtension(uint aShotId);
+
         private:
             common::ComputationParameters *mpParameters = nullptr;
 
@@ -67,6 +81,12 @@ namespace operations {
             std::vector<addons::Extension *> mvExtensions;
 
             int mGrainSideLength;
+
+            /// Base seed of the random boundaries, each shot derives its own seed from it.
+            uint64_t mRandomSeed;
+
+            /// Id of the shot the model is re-extended for.
+            uint mShotId;
         };
 
     }//namespace components
@@ -39,6 +39,8 @@ namespace operations {
 
             void ApplyBoundary(uint kernel_id) override;
 
+            bool IsAppliedOnVelocity() override;
+
             void ExtendModel() override;
 
             void ReExtendModel() override;
@@ -20,6 +20,7 @@
 #ifndef OPERATIONS_LIB_COMPONENTS_EXTENSIONS_RANDOM_EXTENSION_HPP
 #define OPERATIONS_LIB_COMPONENTS_EXTENSIONS_RANDOM_EXTENSION_HPP
 
+#include <cstdint>
 #include <stdlib.h>
 #include <random>
 #include <operations/components/independents/concrete/boundary-managers/extensions/Extension.hpp>
@@ -43,7 +44,14 @@ namespace operations {
 
             public:
                 RandomExtension(int aGrainSideLength) :
-                        mGrainSideLength(aGrainSideLength) {}
+                        mGrainSideLength(aGrainSideLength), mShotSeed(0) {}
+
+                /**
+                 * @brief
+                 * Sets the seed the random boundary of the next extension is
+                 * generated from, the same seed always gives the same boundary.
+                 */
+                void SetShotSeed(uint64_t aShotSeed) { this->mShotSeed = aShotSeed; }
 
             private:
                 void VelocityExtensionHelper(float *apPropertyArray,
@@ -66,6 +74,9 @@ namespace operations {
 
                 /// Grain side length.
                 int mGrainSideLength;
+
+                /// Seed of the current shot.
+                uint64_t mShotSeed;
             };
 
         }//namespace addons
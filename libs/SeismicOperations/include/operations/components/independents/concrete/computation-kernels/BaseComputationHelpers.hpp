@@ -43,6 +43,13 @@
     FORWARD_DECLARE_COMPUTE_TEMP_2(CLASS, FUNCTION, KERNEL_MODE::INVERSE) \
     FORWARD_DECLARE_COMPUTE_TEMP_2(CLASS, FUNCTION, KERNEL_MODE::ADJOINT)
 
+#define FORWARD_DECLARE_TEMPORAL_BLOCK_TEMPLATE(CLASS, FUNCTION) \
+    template void CLASS::FUNCTION<O_2>(uint); \
+    template void CLASS::FUNCTION<O_4>(uint); \
+    template void CLASS::FUNCTION<O_8>(uint); \
+    template void CLASS::FUNCTION<O_12>(uint); \
+    template void CLASS::FUNCTION<O_16>(uint);
+
 /**
  * Boundary managers forward declaration utilities.
  */
@@ -82,6 +89,21 @@
     FORWARD_DECLARE_SINGLE_BOUND_TEMP_2(FUNCTION, Z_AXIS) \
     FORWARD_DECLARE_SINGLE_BOUND_TEMP_2(FUNCTION, Y_AXIS)
 
+#define FORWARD_DECLARE_TILE_BOUND_TEMP_3(FUNCTION, AXIS, OPPOSITE) \
+    template void FUNCTION<AXIS, OPPOSITE, O_2>(float *, int, int, int, int); \
+    template void FUNCTION<AXIS, OPPOSITE, O_4>(float *, int, int, int, int); \
+    template void FUNCTION<AXIS, OPPOSITE, O_8>(float *, int, int, int, int); \
+    template void FUNCTION<AXIS, OPPOSITE, O_12>(float *, int, int, int, int); \
+    template void FUNCTION<AXIS, OPPOSITE, O_16>(float *, int, int, int, int);
+
+#define FORWARD_DECLARE_TILE_BOUND_TEMP_2(FUNCTION, AXIS) \
+    FORWARD_DECLARE_TILE_BOUND_TEMP_3(FUNCTION, AXIS, false) \
+    FORWARD_DECLARE_TILE_BOUND_TEMP_3(FUNCTION, AXIS, true)
+
+#define FORWARD_DECLARE_TILE_BOUND_TEMPLATE(FUNCTION) \
+    FORWARD_DECLARE_TILE_BOUND_TEMP_2(FUNCTION, X_AXIS) \
+    FORWARD_DECLARE_TILE_BOUND_TEMP_2(FUNCTION, Z_AXIS)
+
 /**
  * Unrolled derivation operators utilities.
  */
@@ -20,6 +20,8 @@
 #ifndef OPERATIONS_LIB_COMPONENTS_COMPUTATION_KERNELS_SECOND_ORDER_COMPUTATION_KERNEL_HPP
 #define OPERATIONS_LIB_COMPONENTS_COMPUTATION_KERNELS_SECOND_ORDER_COMPUTATION_KERNEL_HPP
 
+#include <bs/timer/configurations/ChannelHandle.hpp>
+
 #include <operations/components/independents/primitive/ComputationKernel.hpp>
 #include <operations/components/dependency/concrete/HasNoDependents.hpp>
 
@@ -44,6 +46,13 @@ namespace operations {
 
             void Step() override;
 
+            void AdvanceSteps(uint aTimeSteps) override;
+
+            bool FuseCorrelation(dataunits::GridBox *apForwardGridBox,
+                                 float *apCorrelation,
+                                 float *apSourceIllumination,
+                                 float *apReceiverIllumination) override;
+
             MemoryHandler *GetMemoryHandler() override;
 
             void AcquireConfiguration() override;
@@ -60,6 +69,15 @@ namespace operations {
             template<KERNEL_MODE KERNEL_MODE_, bool IS_2D_, HALF_LENGTH HALF_LENGTH_>
             void Compute();
 
+            /**
+             * @brief Advances the given number of time steps at once using a wavefront
+             * over bands of block-z rows, each band being advanced through all the time
+             * steps while it is still in cache. Works in place on the previous and current
+             * pressure, so it requires no boundary work between the time steps.
+             */
+            template<HALF_LENGTH HALF_LENGTH_>
+            void ComputeTemporalBlock(uint aTimeSteps);
+
             void InitializeVariables();
 
         private:
@@ -75,6 +93,20 @@ namespace operations {
             dataunits::FrameBuffer<int> *mpVerticalIdx = nullptr;
 
             float mCoeffXYZ;
+
+            /// Whether the last computed step already applied the boundary
+            /// inside the kernel sweep, so the step should not apply it again.
+            bool mBoundaryInSweep = false;
+
+            /// Forward grid box and accumulators of the fused correlation,
+            /// no correlation is done while the forward grid box is null.
+            dataunits::GridBox *mpForwardGridBox = nullptr;
+            float *mpCorrelation = nullptr;
+            float *mpSourceIllumination = nullptr;
+            float *mpReceiverIllumination = nullptr;
+
+            /// Handle of the boundary timer used at each time step.
+            bs::timer::configurations::ChannelHandle mApplyBoundaryTimer{"BoundaryManager::ApplyBoundary"};
         };
     }//namespace components
 }//namespace operations
@@ -20,6 +20,8 @@
 #ifndef OPERATIONS_LIB_COMPONENTS_COMPUTATION_KERNELS_STAGGERED_ORDER_COMPUTATION_KERNEL_HPP
 #define OPERATIONS_LIB_COMPONENTS_COMPUTATION_KERNELS_STAGGERED_ORDER_COMPUTATION_KERNEL_HPP
 
+#include <bs/timer/configurations/ChannelHandle.hpp>
+
 #include <operations/components/independents/primitive/ComputationKernel.hpp>
 #include <operations/components/dependency/concrete/HasNoDependents.hpp>
 
@@ -64,6 +66,14 @@ namespace operations {
             template<KERNEL_MODE KERNEL_MODE_, bool IS_2D_, HALF_LENGTH HALF_LENGTH_>
             void ComputeVelocity();
 
+            /**
+             * @brief Computes the particle velocities and the pressure in a single
+             * sweep, only valid when no boundary is applied on the particle velocities.
+             * Backends without a fused sweep run both kernels one after the other.
+             */
+            template<KERNEL_MODE KERNEL_MODE_, bool IS_2D_, HALF_LENGTH HALF_LENGTH_>
+            void ComputeFused();
+
             void InitializeVariables();
 
         private:
@@ -75,6 +85,15 @@ namespace operations {
             dataunits::FrameBuffer<float> *mpCoeff = nullptr;
 
             dataunits::FrameBuffer<int> *mpVerticalIdx = nullptr;
+
+            /// Whether to fuse the velocity and pressure sweeps when the boundary allows it.
+            bool mFusedSweep = true;
+
+            /// Handles of the boundary timers used at each time step.
+            bs::timer::configurations::ChannelHandle mApplyVelocityBoundaryTimer{
+                    "BoundaryManager::ApplyBoundary(Velocity)"};
+            bs::timer::configurations::ChannelHandle mApplyPressureBoundaryTimer{
+                    "BoundaryManager::ApplyBoundary(Pressure)"};
         };
     }//namespace components
 }//namespace operations
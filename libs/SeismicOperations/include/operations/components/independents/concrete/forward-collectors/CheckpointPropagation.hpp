@@ -0,0 +1,155 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPERATIONS_LIB_COMPONENTS_FORWARD_COLLECTORS_CHECKPOINT_PROPAGATION_HPP
+#define OPERATIONS_LIB_COMPONENTS_FORWARD_COLLECTORS_CHECKPOINT_PROPAGATION_HPP
+
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <bs/base/memory/MemoryManager.hpp>
+
+#include <operations/components/dependents/concrete/memory-handlers/WaveFieldsMemoryHandler.hpp>
+#include <operations/components/independents/primitive/ForwardCollector.hpp>
+#include <operations/components/independents/primitive/BoundaryManager.hpp>
+#include <operations/components/independents/primitive/ComputationKernel.hpp>
+#include <operations/components/independents/primitive/SourceInjector.hpp>
+#include <operations/components/dependency/concrete/HasDependents.hpp>
+
+namespace operations {
+    namespace components {
+
+        /**
+         * @brief
+         * Forward collector keeping only a budgeted set of checkpoints of the
+         * forward wave fields, placed according to the binomial (Revolve)
+         * schedule. The states in between are recomputed on demand from the
+         * nearest checkpoint during the backward propagation.
+         *
+         * @note
+         * The recomputation uses a clone of the computation kernel without a
+         * boundary manager, so only the 'none' and 'random' boundaries are accepted.
+         */
+        class CheckpointPropagation : public ForwardCollector,
+                                      public dependency::HasDependents {
+        public:
+            explicit CheckpointPropagation(bs::base::configurations::ConfigurationMap *apConfigurationMap);
+
+            ~CheckpointPropagation() override;
+
+            void SetComputationParameters(common::ComputationParameters *apParameters) override;
+
+            void SetGridBox(dataunits::GridBox *apGridBox) override;
+
+            void SetDependentComponents(
+                    operations::helpers::ComponentsMap<DependentComponent> *apDependentComponentsMap) override;
+
+            void FetchForward() override;
+
+            void SaveForward() override;
+
+            uint GetSkippableSteps() override;
+
+            void SkipForward(uint aTimeSteps) override;
+
+            void ResetGrid(bool aIsForwardRun) override;
+
+            dataunits::GridBox *GetForwardGrid() override;
+
+            void AcquireConfiguration() override;
+
+            /**
+             * @return
+             * Number of checkpoints the memory budget allows for.
+             */
+            uint GetCheckpointsCount() const;
+
+            /**
+             * @return
+             * Number of time steps recomputed during the last backward propagation.
+             */
+            uint GetRecomputedSteps() const;
+
+        private:
+            /**
+             * @brief Allocates the checkpoints storage according to the memory budget.
+             */
+            void InitializeCheckpoints();
+
+            /**
+             * @brief Copies the state of the given grid box into a free checkpoint.
+             */
+            void PushCheckpoint(dataunits::GridBox *apGridBox, uint aTimeStep);
+
+            /**
+             * @brief Copies the checkpoint on top of the stack into the internal grid box.
+             */
+            void RestoreCheckpoint();
+
+            /**
+             * @brief Returns the time step at which the next checkpoint should be taken
+             * while advancing from the given time step to the target time step,
+             * according to the binomial schedule and the free checkpoints.
+             */
+            uint GetNextCheckpoint(uint aTimeStep, uint aTargetTimeStep, uint aFreeCheckpoints);
+
+        private:
+            common::ComputationParameters *mpParameters = nullptr;
+
+            ComputationKernel *mpComputationKernel = nullptr;
+
+            SourceInjector *mpSourceInjector = nullptr;
+
+            WaveFieldsMemoryHandler *mpWaveFieldsMemoryHandler = nullptr;
+
+            dataunits::GridBox *mpMainGridBox = nullptr;
+
+            dataunits::GridBox *mpInternalGridBox = nullptr;
+
+            /// Forward copies of the window parameters, used by the recomputation
+            /// since the model may be adjusted for the backward propagation.
+            std::vector<dataunits::FrameBuffer<float> *> mForwardParameters;
+
+            /// Wave fields making up one checkpoint.
+            std::vector<dataunits::GridBox::Key> mStateKeys;
+
+            float *mpCheckpointsHostMemory = nullptr;
+
+            /// Memory budget of the checkpoints in mega bytes.
+            float mMemoryBudget;
+
+            uint mCheckpointsCount;
+
+            /// Stack of the taken checkpoints as (time step, slot), ordered by time step.
+            std::vector<std::pair<uint, uint>> mCheckpoints;
+
+            std::vector<uint> mFreeSlots;
+
+            uint mTimeStep;
+
+            uint mNextCheckpoint;
+
+            uint mRecomputedSteps;
+        };
+    }//namespace components
+}//namespace operations
+
+#endif //OPERATIONS_LIB_COMPONENTS_FORWARD_COLLECTORS_CHECKPOINT_PROPAGATION_HPP
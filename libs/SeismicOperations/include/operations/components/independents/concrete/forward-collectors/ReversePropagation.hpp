@@ -52,6 +52,8 @@ namespace operations {
 
             void SaveForward() override;
 
+            uint GetSkippableSteps() override;
+
             void ResetGrid(bool is_forward_run) override;
 
             dataunits::GridBox *GetForwardGrid() override;
@@ -85,6 +87,9 @@ namespace operations {
 
             bool mInjectionEnabled;
 
+            /// Keeps the saved boundaries compressed, see BoundarySaver::Initialize.
+            bool mBoundaryCompression;
+
             std::vector<components::helpers::BoundarySaver *> mBoundarySavers;
 
             uint mTimeStep;
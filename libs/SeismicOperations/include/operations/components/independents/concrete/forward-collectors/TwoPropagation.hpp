@@ -25,10 +25,12 @@
 #include <fstream>
 #include <sstream>
 #include <unistd.h>
+#include <vector>
 
 #include <bs/base/memory/MemoryManager.hpp>
 
 #include <operations/components/independents/concrete/forward-collectors/file-handler/file_handler.h>
+#include <operations/components/independents/concrete/forward-collectors/file-handler/AsyncFileHandler.hpp>
 #include <operations/components/dependents/concrete/memory-handlers/WaveFieldsMemoryHandler.hpp>
 #include <operations/components/independents/primitive/ForwardCollector.hpp>
 #include <operations/components/dependency/concrete/HasDependents.hpp>
@@ -61,6 +63,43 @@ namespace operations {
 
             void AcquireConfiguration() override;
 
+        private:
+            /**
+             * @brief Allocates the host memory of the given number of snapshots,
+             * returns nullptr if it does not fit in memory or in the memory budget.
+             */
+            float *AllocateHostMemory(unsigned long long aSnapshots);
+
+            /**
+             * @brief Returns the host staging slot holding the given block of
+             * mMaxNT snapshots.
+             */
+            float *GetHostBlock(uint aBlock);
+
+            /**
+             * @brief Copies the given frame again from the device to the host.
+             * The last frame of a device copy is only final after the source
+             * injection of its step.
+             */
+            void CommitFrame(uint aFrame);
+
+            /**
+             * @brief Hands the given block over to the I/O thread to be spilled
+             * to its file.
+             */
+            void SpillBlock(uint aBlock);
+
+            /**
+             * @brief Makes sure the given block is resident in its host staging
+             * slot, then starts prefetching the block preceding it.
+             */
+            void FetchBlock(uint aBlock);
+
+            /**
+             * @brief Queues the load of the given block into its host staging slot.
+             */
+            void LoadBlock(uint aBlock);
+
         private:
             common::ComputationParameters *mpParameters = nullptr;
 
@@ -74,6 +113,18 @@ namespace operations {
 
             float *mpForwardPressureHostMemory = nullptr;
 
+            /// Background I/O stage spilling/prefetching the host staging slots.
+            helpers::AsyncFileHandler *mpFileHandler = nullptr;
+
+            /// Number of host staging slots, 1 if all snapshots fit in memory.
+            uint mHostSlots;
+
+            /// Block held (or being loaded into) each host staging slot, -1 if none.
+            std::vector<long long> mResidentBlocks;
+
+            /// Pressure allocated for the internal grid box, restored before freeing it.
+            float *mpInternalCurr = nullptr;
+
             float *mpTempPrev = nullptr;
 
             float *mpTempCurr = nullptr;
@@ -92,8 +143,14 @@ namespace operations {
 
             std::string mWritePath;
 
+            /// Memory budget of the host snapshots in mega bytes, unlimited if not positive.
+            float mMemoryBudget;
+
             bool mIsCompression;
 
+            /// Codec of the compressed snapshots, as understood by the compressor.
+            unsigned int mCodecType;
+
             /* ZFP Properties. */
 
             int mZFP_Parallel;
@@ -20,6 +20,9 @@
 #ifndef OPERATIONS_LIB_COMPONENTS_FORWARD_COLLECTORS_BOUNDARY_SAVER_H
 #define OPERATIONS_LIB_COMPONENTS_FORWARD_COLLECTORS_BOUNDARY_SAVER_H
 
+#include <cstdint>
+#include <vector>
+
 #include <operations/common/ComputationParameters.hpp>
 #include <operations/data-units/concrete/holders/GridBox.hpp>
 #include <operations/components/independents/interface/Component.hpp>
@@ -56,11 +59,17 @@ namespace operations {
                  *
                  * @param[in] apParameters
                  * The computation parameters.
+                 *
+                 * @param[in] aIsCompressed
+                 * Whether to keep the saved boundaries as 16-bit values scaled
+                 * per time step, halving their memory. The error of a restored
+                 * value is bounded by the peak boundary value of its time step / 65534.
                  */
                 void Initialize(dataunits::GridBox::Key aActiveKey,
                                 dataunits::GridBox *apInternalGridBox,
                                 dataunits::GridBox *apMainGridBox,
-                                common::ComputationParameters *apParameters);
+                                common::ComputationParameters *apParameters,
+                                bool aIsCompressed = false);
 
                 /**
                  * @brief
@@ -86,13 +95,34 @@ namespace operations {
                  */
                 ~BoundarySaver();
 
+            private:
+                /**
+                 * @brief
+                 * Quantizes a single time step of boundaries into the compressed store.
+                 */
+                void CompressStep(uint aStep, const float *apBoundaries);
+
+                /**
+                 * @brief
+                 * Restores a single time step of boundaries from the compressed store.
+                 */
+                void DecompressStep(uint aStep, float *apBoundaries);
+
             private:
                 /// The key to save on the boundaries.
                 dataunits::GridBox::Key mKey;
                 /// The saved boundaries.
                 dataunits::FrameBuffer<float> mBackupBoundaries;
                 /// The boundary size saved in a single time step.
-                uint mBoundarySize;
+                size_t mBoundarySize;
+                /// Whether the saved boundaries are kept compressed.
+                bool mIsCompressed;
+                /// A single time step of boundaries, staged for the compression.
+                dataunits::FrameBuffer<float> mStagingBoundaries;
+                /// The compressed boundaries of all time steps.
+                std::vector<int16_t> mCompressedBoundaries;
+                /// The quantization step of each compressed time step.
+                std::vector<float> mScales;
                 /// Internal Gridbox used for the restoration process.
                 dataunits::GridBox *mpInternalGridBox;
                 /// Main Gridbox used for the restoration process.
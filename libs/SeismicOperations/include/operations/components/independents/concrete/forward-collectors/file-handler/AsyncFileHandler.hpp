@@ -0,0 +1,134 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPERATIONS_LIB_COMPONENTS_FORWARD_COLLECTORS_ASYNC_FILE_HANDLER_HPP
+#define OPERATIONS_LIB_COMPONENTS_FORWARD_COLLECTORS_ASYNC_FILE_HANDLER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace operations {
+    namespace components {
+        namespace helpers {
+            /**
+             * @brief
+             * Background I/O stage used by the forward collectors to overlap
+             * the spill/fetch of snapshot blocks with the propagation.
+             * <br>
+             * The handler owns a single worker thread that executes the submitted
+             * tasks in order. Each task is bound to a staging slot (i.e. one of the
+             * host buffers of a ring) so the caller can block only on the slot it
+             * is about to reuse. An exception thrown by a task is kept and rethrown
+             * to the caller waiting on its slot.
+             */
+            class AsyncFileHandler {
+            public:
+                /**
+                 * @brief
+                 * Constructor.
+                 *
+                 * @param[in] aSlotCount
+                 * Number of staging slots tracked by the handler.
+                 */
+                explicit AsyncFileHandler(unsigned int aSlotCount);
+
+                /**
+                 * @brief
+                 * Destructor, drains all pending tasks then joins the worker.
+                 */
+                ~AsyncFileHandler();
+
+                /**
+                 * @brief
+                 * Queues a task to be executed by the worker thread.
+                 *
+                 * @param[in] aSlot
+                 * The staging slot the task reads from or writes into.
+                 *
+                 * @param[in] aTask
+                 * The I/O operation to execute.
+                 */
+                void Submit(unsigned int aSlot, std::function<void()> aTask);
+
+                /**
+                 * @brief
+                 * Blocks until all tasks submitted on the given slot are done, then
+                 * rethrows the first exception thrown by one of them, if any.
+                 *
+                 * @param[in] aSlot
+                 * The staging slot to wait on.
+                 */
+                void Wait(unsigned int aSlot);
+
+                /**
+                 * @brief
+                 * Blocks until all submitted tasks are done, then rethrows the
+                 * first exception thrown by one of them, if any.
+                 */
+                void WaitAll();
+
+                /**
+                 * @return
+                 * Whether the given slot has any task that is not done yet.
+                 */
+                bool IsPending(unsigned int aSlot);
+
+            private:
+                /**
+                 * @brief
+                 * Worker thread routine.
+                 */
+                void Run();
+
+                /**
+                 * @brief
+                 * Rethrows and clears the exception kept for the given slot, if any.
+                 * Must be called while holding the lock.
+                 */
+                void RethrowError(unsigned int aSlot);
+
+            private:
+                /// Tasks waiting to be executed, each bound to its slot.
+                std::deque<std::pair<unsigned int, std::function<void()>>> mTasks;
+                /// Number of not yet finished tasks per slot.
+                std::vector<unsigned int> mPending;
+                /// First exception thrown by a task of each slot, not yet rethrown.
+                std::vector<std::exception_ptr> mErrors;
+                /// Guards the queue and the pending counters.
+                std::mutex mMutex;
+                /// Signaled whenever a task is queued or termination is requested.
+                std::condition_variable mTaskQueued;
+                /// Signaled whenever a task is done.
+                std::condition_variable mTaskDone;
+                /// Termination flag for the worker.
+                bool mTerminate;
+                /// The worker executing the tasks.
+                std::thread mWorker;
+            };
+        }//namespace helpers
+    }//namespace components
+}//namespace operations
+
+#endif //OPERATIONS_LIB_COMPONENTS_FORWARD_COLLECTORS_ASYNC_FILE_HANDLER_HPP
@@ -43,6 +43,9 @@ namespace operations {
 
             void Correlate(dataunits::DataUnit *apDataUnit) override;
 
+            bool FuseInto(ComputationKernel *apComputationKernel,
+                          dataunits::DataUnit *apDataUnit) override;
+
             void ResetShotCorrelation() override;
 
             dataunits::FrameBuffer<float> *GetShotCorrelation() override;
@@ -76,6 +79,9 @@ namespace operations {
 
             COMPENSATION_TYPE mCompensationType;
 
+            /// Whether the correlation is requested to be fused into the backward steps.
+            bool mFused;
+
             dataunits::FrameBuffer<float> *mpShotCorrelation = nullptr;
             dataunits::FrameBuffer<float> *mpSourceIllumination = nullptr;
             dataunits::FrameBuffer<float> *mpReceiverIllumination = nullptr;
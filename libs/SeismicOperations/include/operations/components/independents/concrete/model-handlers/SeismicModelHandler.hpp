@@ -47,6 +47,9 @@ namespace operations {
 
             dataunits::GridBox *ReadModel(std::map<std::string, std::string> file_names) override;
 
+            dataunits::GridBox *ShareModel(dataunits::GridBox *apModelGridBox,
+                                           bool aIsSharingParameters) override;
+
             void SetupWindow() override;
 
             void AcquireConfiguration() override;
@@ -27,6 +27,7 @@
 
 
 #include <operations/components/independents/primitive/TraceManager.hpp>
+#include <operations/components/independents/concrete/forward-collectors/file-handler/AsyncFileHandler.hpp>
 #include <operations/components/dependency/concrete/HasNoDependents.hpp>
 #include <operations/data-units/concrete/holders/FrameBuffer.hpp>
 
@@ -48,6 +49,9 @@ namespace operations {
             void ReadShot(std::vector<std::string> file_names, uint shot_number,
                           std::string sort_key) override;
 
+            void PrefetchShot(std::vector<std::string> file_names, uint shot_number,
+                              std::string sort_key) override;
+
             void PreprocessShot() override;
 
             void ApplyTraces(int time_step) override;
@@ -65,6 +69,26 @@ namespace operations {
 
             void AcquireConfiguration() override;
 
+        private:
+            /**
+             * @brief
+             * Builds the per shot receivers injection tables, the grid offsets
+             * and weights of every tap of every receiver, laid out tap by tap
+             * so that each tap sweeps contiguously over the receivers.
+             *
+             * @note
+             * The weights get scaled by the window velocity on the first
+             * injection of the shot, as the window model is only set up
+             * (and adjusted for the backward propagation) after the shot
+             * preprocessing.
+             */
+            void PrepareInjection();
+
+            /**
+             * @brief Waits for any pending prefetch, then drops the prefetched traces.
+             */
+            void DiscardPrefetch();
+
         private:
             common::ComputationParameters *mpParameters = nullptr;
 
@@ -84,9 +108,48 @@ namespace operations {
 
             dataunits::FrameBuffer<uint> mpDPositionsX;
 
+            /// Receivers injection tables, of mInjectionTaps * TraceSizePerTimeStep entries.
+            dataunits::FrameBuffer<size_t> mpDInjectionOffsets;
+
+            dataunits::FrameBuffer<float> mpDInjectionWeights;
+
+            INJECTION mInjection;
+
+            uint mInjectionTaps;
+
+            /// Whether the injection weights are already scaled by the velocity.
+            bool mInjectionScaled;
+
+            /// Whether no two receivers fall on the same grid point,
+            /// allowing a parallel injection.
+            bool mUniqueReceivers;
+
             float mTotalTime;
 
             int mShotStride;
+
+            /// Whether the next shot traces get read in the background, off by default.
+            bool mShotPrefetch;
+
+            /// Background reader of the next shot, with a single slot.
+            helpers::AsyncFileHandler *mpPrefetcher = nullptr;
+
+            /// Traces of the next shot, swapped in by ReadShot.
+            dataunits::TracesHolder *mpPrefetchedTraces = nullptr;
+
+            /// Meta data only grid box receiving the window and time steps of
+            /// the next shot, keeping the main one intact during the prefetch.
+            dataunits::GridBox *mpPrefetchGridBox = nullptr;
+
+            Point3D mPrefetchedSourcePoint;
+
+            float mPrefetchedTotalTime;
+
+            uint mPrefetchedShot;
+
+            bool mPrefetchPending;
+
+            bool mPrefetchFound;
         };
     }//namespace components
 }//namespace operations
@@ -66,6 +66,16 @@ namespace operations {
              */
             virtual void ReExtendModel() = 0;
 
+            /**
+             * @brief Sets the id of the shot the next ReExtendModel call is for. Boundaries
+             * that differ from shot to shot derive their per shot state from it, so that
+             * the same shot gets the same boundary whichever engine migrates it.
+             *
+             * @param[in] aShotId
+             * The id of the shot about to be migrated.
+             */
+            virtual void SetShotId(uint aShotId) {}
+
             /**
              * @brief Adjusts the velocity/density of the model appropriately for the
              * backward propagation. Normally, but not necessary, this means removing
@@ -74,6 +84,88 @@ namespace operations {
              */
             virtual void AdjustModelForBackward() = 0;
 
+            /**
+             * @brief Whether ApplyBoundary does any work on the wave fields at each time
+             * step. Boundaries that only extend the model may return false, allowing the
+             * computation kernel to advance several time steps at once.
+             *
+             * @return[out]
+             * True if the boundary must be applied after every time step.
+             */
+            virtual bool IsAppliedEachStep() {
+                return true;
+            }
+
+            /**
+             * @brief Whether ApplyBoundary does any work on the particle velocities
+             * (kernel_id == 1). Boundaries that do not may let a staggered computation
+             * kernel update the particle velocities and the pressure in a single sweep.
+             *
+             * @return[out]
+             * True if the boundary must be applied between the particle velocity and
+             * pressure updates.
+             */
+            virtual bool IsAppliedOnVelocity() {
+                return true;
+            }
+
+            /**
+             * @brief Whether ReExtendModel modifies the full model parameters at each
+             * shot, and not only the window parameters.
+             *
+             * @return[out]
+             * True if the full model can't be shared between concurrent shots.
+             */
+            virtual bool IsReExtendingFullModel() {
+                return false;
+            }
+
+            /**
+             * @brief Whether the boundary should be applied tile by tile inside the
+             * computation kernel sweep, through UpdateTile and ApplyTile, instead of
+             * ApplyBoundary after the whole time step.
+             *
+             * @return[out]
+             * True if the kernel should call UpdateTile and ApplyTile.
+             */
+            virtual bool IsFusedInKernel() {
+                return false;
+            }
+
+            /**
+             * @brief First pass of a fused boundary on a tile of the window, called by
+             * the computation kernel right after computing the tile, while the current
+             * pressure of the tile is still in cache. Called concurrently on different tiles.
+             *
+             * @param[in] apCurrent
+             * The current pressure the kernel computed the tile from.
+             *
+             * @param[in] aStartX
+             * @param[in] aEndX
+             * @param[in] aStartZ
+             * @param[in] aEndZ
+             * The tile range, ends excluded.
+             */
+            virtual void UpdateTile(float *apCurrent, int aStartX, int aEndX,
+                                    int aStartZ, int aEndZ) {}
+
+            /**
+             * @brief Second pass of a fused boundary on a tile of the window, called by
+             * the computation kernel once UpdateTile was called on all the tiles.
+             * Called concurrently on different tiles.
+             *
+             * @param[in] apNext
+             * The next pressure computed by the kernel for the tile.
+             *
+             * @param[in] aStartX
+             * @param[in] aEndX
+             * @param[in] aStartZ
+             * @param[in] aEndZ
+             * The tile range, ends excluded.
+             */
+            virtual void ApplyTile(float *apNext, int aStartX, int aEndX,
+                                   int aStartZ, int aEndZ) {}
+
             /**
              * @brief
              * Sets the boundary to work in adjoint mode.
@@ -60,6 +60,54 @@ namespace operations {
              */
             virtual void Step() = 0;
 
+            /**
+             * @brief Advances the wave fields by the given number of time steps, with no
+             * observation of the intermediate time steps in between. The GridBox is left
+             * in the same state as after the same number of Step() calls.
+             * <br>
+             * Kernels supporting temporal blocking should override this function, the
+             * default behaviour is stepping one time step at a time.
+             *
+             * @param[in] aTimeSteps
+             * Number of time steps to advance.
+             */
+            virtual void AdvanceSteps(uint aTimeSteps) {
+                for (uint it = 0; it < aTimeSteps; it++) {
+                    this->Step();
+                }
+            }
+
+            /**
+             * @brief Fuses the cross correlation imaging condition into the adjoint steps,
+             * each newly computed pressure is correlated with the current pressure of the
+             * given forward grid box while it is still in cache, instead of in a separate
+             * pass over the window. Passing a null forward grid box ends the fusion.
+             * <br>
+             * Kernels supporting the fusion should override this function, the default
+             * behaviour is refusing it.
+             *
+             * @param[in] apForwardGridBox
+             * The grid box holding the forward pressure of the step being computed.
+             *
+             * @param[in] apCorrelation
+             * The single shot correlation to accumulate into.
+             *
+             * @param[in] apSourceIllumination
+             * The source illumination to accumulate into, null for no compensation.
+             *
+             * @param[in] apReceiverIllumination
+             * The receiver illumination to accumulate into, null for no compensation.
+             *
+             * @return
+             * Whether the kernel performs the correlation from now on.
+             */
+            virtual bool FuseCorrelation(dataunits::GridBox *apForwardGridBox,
+                                         float *apCorrelation,
+                                         float *apSourceIllumination,
+                                         float *apReceiverIllumination) {
+                return false;
+            }
+
             /**
              * @brief Set kernel boundary manager to be used and called internally.
              *
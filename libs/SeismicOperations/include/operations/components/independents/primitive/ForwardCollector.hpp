@@ -94,6 +94,27 @@ namespace operations {
              */
             virtual void SaveForward() = 0;
 
+            /**
+             * @brief Number of the upcoming forward time steps that do not need to be
+             * observed by SaveForward, starting from the current time step. The engine
+             * may advance these time steps at once, calling SkipForward instead.
+             *
+             * @return[out]
+             * Number of skippable time steps, 0 if every time step must be saved.
+             */
+            virtual uint GetSkippableSteps() {
+                return 0;
+            }
+
+            /**
+             * @brief Called instead of SaveForward for time steps advanced at once,
+             * the count never exceeds the one returned by GetSkippableSteps.
+             *
+             * @param[in] aTimeSteps
+             * Number of skipped time steps.
+             */
+            virtual void SkipForward(uint aTimeSteps) {}
+
             /**
              * @brief Resets the grid pressures or allocates new frames for the backward
              * propagation. It should either free or keep track of the old frames.
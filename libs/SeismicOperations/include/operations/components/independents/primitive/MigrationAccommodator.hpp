@@ -21,6 +21,7 @@
 #define OPERATIONS_LIB_COMPONENTS_MIGRATION_ACCOMMODATOR_HPP
 
 #include <operations/components/independents/interface/Component.hpp>
+#include <operations/components/independents/primitive/ComputationKernel.hpp>
 
 #include <operations/common/DataTypes.h>
 #include <operations/data-units/concrete/migration/MigrationData.hpp>
@@ -76,6 +77,27 @@ namespace operations {
              */
             virtual void Correlate(dataunits::DataUnit *apDataUnit) = 0;
 
+            /**
+             * @brief Hands the imaging condition of the coming backward propagation over to
+             * the given computation kernel when fusing is requested and the kernel supports
+             * it, then Correlate() should not be called for its steps.
+             * <br>
+             * The default behaviour is keeping the imaging condition as a separate pass.
+             *
+             * @param[in] apComputationKernel
+             * The computation kernel running the backward propagation.
+             *
+             * @param[in] apDataUnit
+             * The pointer to the GridBox the forward propagation is fetched into.
+             *
+             * @return
+             * Whether the kernel took the imaging condition over.
+             */
+            virtual bool FuseInto(ComputationKernel *apComputationKernel,
+                                  dataunits::DataUnit *apDataUnit) {
+                return false;
+            }
+
             /**
              * @return
              * The pointer to the array that should contain the results of the correlation
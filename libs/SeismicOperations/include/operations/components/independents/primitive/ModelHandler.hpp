@@ -77,6 +77,25 @@ namespace operations {
              */
             virtual dataunits::GridBox *ReadModel(std::map<std::string, std::string> files_names) = 0;
 
+            /**
+             * @brief Creates a new GridBox for the model already read by another
+             * model handler, instead of reading it again. The wave fields and the
+             * window parameters are allocated for the new GridBox.
+             *
+             * @param[in] apModelGridBox
+             * The GridBox returned by ReadModel of the other model handler, after
+             * its model was preprocessed and extended.
+             *
+             * @param[in] aIsSharingParameters
+             * Whether the full model parameters are shared read-only with the given
+             * GridBox, otherwise they are copied.
+             *
+             * @return[out]
+             * GridBox object that was allocated, and setup appropriately.
+             */
+            virtual dataunits::GridBox *ShareModel(dataunits::GridBox *apModelGridBox,
+                                                   bool aIsSharingParameters) = 0;
+
             /**
              * @brief Setup the window properties if needed by copying the
              * needed window from the full model.
@@ -59,6 +59,24 @@ namespace operations {
             virtual void ReadShot(std::vector<std::string> files_names,
                                   uint shot_number, std::string sort_key) = 0;
 
+            /**
+             * @brief Function that should start reading the traces of the shot to be
+             * migrated next in the background, while the current shot is being
+             * processed. A following ReadShot call for the same shot then only
+             * hands over the already read traces.
+             *
+             * @param[in] files_names
+             * A vector of files' names containing all the shots files.
+             *
+             * @param[in] shot_number
+             * The shot number or id of the shot that its traces are targeted to be read.
+             *
+             * @param[in] sort_key
+             * The type of sorting to access the data in.
+             */
+            virtual void PrefetchShot(std::vector<std::string> files_names,
+                                      uint shot_number, std::string sort_key) = 0;
+
             /**
              * @brief Function that should be possible for the pre-processing of the shot traces
              * already read. Pre-processing includes interpolation of the traces, any type
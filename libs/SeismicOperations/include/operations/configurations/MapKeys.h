@@ -26,17 +26,24 @@ namespace operations {
 #define OP_K_PROPRIETIES               "properties"
 #define OP_K_USE_TOP_LAYER             "use-top-layer"
 #define OP_K_SHOT_STRIDE               "shot-stride"
+#define OP_K_SHOT_PREFETCH             "shot-prefetch"
 #define OP_K_REFLECT_COEFFICIENT       "reflect-coeff"
 #define OP_K_SHIFT_RATIO               "shift-ratio"
 #define OP_K_RELAX_COEFFICIENT         "relax-coeff"
+#define OP_K_FUSED_SWEEP               "fused-sweep"
 #define OP_K_ZFP_TOLERANCE             "zfp-tolerance"
 #define OP_K_ZFP_PARALLEL              "zfp-parallel"
 #define OP_K_ZFP_RELATIVE              "zfp-relative"
 #define OP_K_WRITE_PATH                "write-path"
 #define OP_K_COMPRESSION               "compression"
 #define OP_K_COMPRESSION_TYPE          "compression-type"
+#define OP_K_ZFP                       "zfp"
+#define OP_K_BFP                       "bfp"
 #define OP_K_BOUNDARY_SAVING           "boundary-saving"
+#define OP_K_BOUNDARY_COMPRESSION      "boundary-compression"
+#define OP_K_MEMORY_BUDGET             "memory-budget"
 #define OP_K_COMPENSATION              "compensation"
+#define OP_K_FUSED_CORRELATION         "fused-correlation"
 #define OP_K_COMPENSATION_NONE         "none"
 #define OP_K_COMPENSATION_COMBINED     "combined"
 #define OP_K_COMPENSATION_RECEIVER     "receiver"
@@ -46,12 +53,17 @@ namespace operations {
 #define OP_K_HEADER_ONLY               "header-only"
 #define OP_K_INTERPOLATION             "interpolation"
 #define OP_K_NONE                      "none"
+#define OP_K_LINEAR                    "linear"
 #define OP_K_SPLINE                    "spline"
+#define OP_K_RECEIVER_INJECTION        "receiver-injection"
+#define OP_K_POINT                     "point"
+#define OP_K_SINC                      "sinc"
 #define OP_K_OUTPUT_FILE               "output-file"
 #define OP_K_MAX_FREQ_AMP_PERCENT      "max-freq-amplitude-percentage"
 #define OP_K_DIP_ANGLE                 "dip-angle"
 #define OP_K_DEPTH_SAMPLING_SCALING    "depth-sampling-scaling"
 #define OP_K_GRAIN_SIDE_LENGTH         "grain-side-length"
+#define OP_K_RANDOM_SEED               "random-seed"
 
     } //namespace configuration
 } //namespace operations
@@ -20,6 +20,7 @@
 #ifndef OPERATIONS_LIB_DATA_UNITS_FRAMEBUFFER_HPP
 #define OPERATIONS_LIB_DATA_UNITS_FRAMEBUFFER_HPP
 
+#include <cstddef>
 #include <string>
 
 #include <operations/data-units/interface/DataUnit.hpp>
@@ -33,15 +34,15 @@ namespace operations {
         public:
             FrameBuffer();
 
-            explicit FrameBuffer(uint aSize);
+            explicit FrameBuffer(size_t aSize);
 
             ~FrameBuffer() override;
 
             void
-            Allocate(uint aSize, const std::string &aName = "");
+            Allocate(size_t aSize, const std::string &aName = "");
 
             void
-            Allocate(uint aSize, HALF_LENGTH aHalfLength, const std::string &aName = "");
+            Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName = "");
 
             void
             Free();
@@ -64,7 +65,7 @@ namespace operations {
         private:
             T *mpDataPointer;
             T *mpHostDataPointer;
-            uint mAllocatedBytes;
+            size_t mAllocatedBytes;
         };
 
         namespace Device {
@@ -76,9 +77,9 @@ namespace operations {
                 COPY_DEFAULT
             };
 
-            void MemSet(void *apDst, int aVal, uint aSize);
+            void MemSet(void *apDst, int aVal, size_t aSize);
 
-            void MemCpy(void *apDst, const void *apSrc, uint aSize, CopyDirection aCopyDirection = COPY_DEFAULT);
+            void MemCpy(void *apDst, const void *apSrc, size_t aSize, CopyDirection aCopyDirection = COPY_DEFAULT);
         }
     } //namespace dataunits
 } //namespace operations
@@ -38,6 +38,8 @@ namespace operations {
                 Traces = nullptr;
                 PositionsX = nullptr;
                 PositionsY = nullptr;
+                ShiftsX = nullptr;
+                ShiftsY = nullptr;
             }
 
             /**
@@ -51,6 +53,11 @@ namespace operations {
             uint *PositionsX;
             uint *PositionsY;
 
+            /// Distances of the receivers from their grid points,
+            /// in cells within [-0.5, 0.5].
+            float *ShiftsX;
+            float *ShiftsY;
+
             uint ReceiversCountX;
             uint ReceiversCountY;
 
@@ -72,6 +72,14 @@ namespace operations {
                 int
                 AddComputationalPadding(int aDirection, T aComputationalPadding) override;
 
+                int
+                ResizeAxis(T aAxisSize) override;
+
+                inline T
+                GetAxisCapacity() const override {
+                    return this->mAxisSize + this->mRearComputationalPadding;
+                };
+
                 inline int
                 GetRearHalfLengthPadding() const override { return this->mRearHalfLengthPadding; };
 
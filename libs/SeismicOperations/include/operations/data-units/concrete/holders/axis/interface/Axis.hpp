@@ -79,6 +79,31 @@ namespace operations {
                 virtual int
                 AddComputationalPadding(int aDirection, T aComputationalPadding) = 0;
 
+                /**
+                 * @brief Function to resize the axis inside the points it already spans.
+                 * The points freed at the rear are moved to the rear computational padding,
+                 * so the actual axis size, the stride of the buffers allocated over the axis,
+                 * does not change.
+                 *
+                 * @param[in] aAxisSize
+                 * The new axis size, clamped to the axis capacity.
+                 *
+                 * @return
+                 * int status flag.
+                 */
+                virtual int
+                ResizeAxis(T aAxisSize) = 0;
+
+                /**
+                 * @brief Getter for the largest size the axis can be resized to.
+                 *  Axis capacity = Axis size + Rear Padding
+                 *
+                 * @return
+                 * T, The axis capacity.
+                 */
+                virtual T
+                GetAxisCapacity() const = 0;
+
                 /**
                  * @brief Getter for the Front Half Length/ Non Computational Padding
                  *
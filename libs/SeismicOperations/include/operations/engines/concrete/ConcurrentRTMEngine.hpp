@@ -0,0 +1,104 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPERATIONS_LIB_ENGINES_CONCURRENT_RTM_ENGINE_HPP
+#define OPERATIONS_LIB_ENGINES_CONCURRENT_RTM_ENGINE_HPP
+
+#include <vector>
+
+#include <operations/engines/concrete/RTMEngine.hpp>
+
+namespace operations {
+    namespace engines {
+        /**
+         * @brief RTM engine migrating several shots concurrently inside a single
+         * node. Each worker is a full RTM engine with its own components, grid box,
+         * forward collector and correlation buffers, migrating the shots it pulls
+         * on a disjoint share of the available threads. The stacked images of the
+         * workers are summed when finalizing.
+         */
+        class ConcurrentRTMEngine : public Engine {
+        public:
+            /**
+             * @brief Constructor for the concurrent RTM engine.
+             *
+             * @param[in] aWorkers
+             * The RTM engines used as workers, each built from its own configuration.
+             * The concurrent engine takes their ownership.
+             */
+            explicit ConcurrentRTMEngine(std::vector<RTMEngine *> aWorkers);
+
+            /**
+             * @brief Destructors should be overridden to ensure correct memory management.
+             */
+            ~ConcurrentRTMEngine() override;
+
+            /**
+             * @brief Reads the model with the first worker and initializes the
+             * other workers from it, sharing its full model parameters whenever
+             * the shots only write to their own window.
+             *
+             * @return[out]
+             * The grid box of the first worker, the grid boxes of the
+             * other workers are kept internally.
+             */
+            dataunits::GridBox *
+            Initialize() override;
+
+            /**
+             * @brief The function that filters and returns all possible
+             * shot ID in a vector to be fed to the migrate method.
+             *
+             * @return[out]
+             * A vector containing all unique shot IDs.
+             */
+            std::vector<uint>
+            GetValidShots() override;
+
+            /**
+             * @brief Migrates the given shots, each worker pulling the next
+             * shot not yet migrated until none is left.
+             *
+             * @param[in] shot_list
+             * A vector containing the shot IDs to be migrated.
+             */
+            void
+            MigrateShots(std::vector<uint> shot_numbers, dataunits::GridBox *apGridBox) override;
+
+            /**
+             * @brief Finalizes all workers and sums their stacked images.
+             *
+             * @return[out]
+             * The migration data holding the sum of the workers results.
+             */
+            dataunits::MigrationData *
+            Finalize(dataunits::GridBox *apGridBox) override;
+
+        private:
+            /// The RTM engines migrating the shots concurrently.
+            std::vector<RTMEngine *> mWorkers;
+            /// Grid boxes of the workers, the first one is owned by the caller.
+            std::vector<dataunits::GridBox *> mGridBoxes;
+            /// Number of threads each worker runs its kernels on.
+            int mThreadsPerWorker;
+        };
+    } //namespace engines
+} //namespace operations
+
+#endif // OPERATIONS_LIB_ENGINES_CONCURRENT_RTM_ENGINE_HPP
@@ -20,6 +20,8 @@
 #ifndef OPERATIONS_LIB_ENGINES_MODELLING_ENGINE_HPP
 #define OPERATIONS_LIB_ENGINES_MODELLING_ENGINE_HPP
 
+#include <bs/timer/configurations/ChannelHandle.hpp>
+
 #include <operations/helpers/callbacks/primitive/CallbackCollection.hpp>
 
 #include <operations/engines/interface/Engine.hpp>
@@ -129,6 +131,10 @@ namespace operations {
         private:
             ///The configuration containing the actual components to be used in the process.
             configurations::ModellingEngineConfigurations *mpConfiguration;
+            /// Handles of the timers used at each time step.
+            bs::timer::configurations::ChannelHandle mApplySourceTimer{"SourceInjector::ApplySource"};
+            bs::timer::configurations::ChannelHandle mForwardStepTimer{"Forward::ComputationKernel::Step"};
+            bs::timer::configurations::ChannelHandle mRecordTraceTimer{"TraceWriter::RecordTrace"};
         };
     } //namespace engines
 } //namespace operations
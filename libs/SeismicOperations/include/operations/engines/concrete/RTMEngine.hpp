@@ -20,6 +20,8 @@
 #ifndef OPERATIONS_LIB_ENGINES_RTM_ENGINE_HPP
 #define OPERATIONS_LIB_ENGINES_RTM_ENGINE_HPP
 
+#include <bs/timer/configurations/ChannelHandle.hpp>
+
 #include <operations/engines/interface/Engine.hpp>
 #include <operations/engine-configurations/concrete/RTMEngineConfigurations.hpp>
 
@@ -73,6 +75,20 @@ namespace operations {
             dataunits::GridBox *
             Initialize() override;
 
+            /**
+             * @brief Initializes domain model from the model already read
+             * and preprocessed by another engine instead of reading it again.
+             *
+             * @param[in] apModelEngine
+             * The engine that read the model.
+             *
+             * @param[in] apModelGridBox
+             * The grid box holding the model, its full model parameters are
+             * shared when no shot writes to them.
+             */
+            dataunits::GridBox *
+            Initialize(RTMEngine *apModelEngine, dataunits::GridBox *apModelGridBox);
+
             /**
              * @brief The function that filters and returns all possible
              * shot ID in a vector to be fed to the migrate method.
@@ -113,6 +129,26 @@ namespace operations {
             Finalize(dataunits::GridBox *apGridBox) override;
 
         private:
+            /**
+             * @brief Sets the computation parameters, dependent components
+             * and configuration of all components.
+             */
+            void
+            SetupComponents();
+
+            /**
+             * @brief Migrates a single shot, reading the traces of the next
+             * shot in the background while this one is being propagated.
+             *
+             * @param[in] aShotId
+             * Shot ID to be migrated.
+             *
+             * @param[in] apNextShotId
+             * Shot ID to be migrated next, nullptr if none.
+             */
+            void
+            MigrateShot(uint aShotId, const uint *apNextShotId, dataunits::GridBox *apGridBox);
+
             /**
              * @brief Applies the forward propagation using the different
              * components provided in the configuration.
@@ -130,6 +166,14 @@ namespace operations {
         private:
             /// The configuration containing the actual components to be used in the process.
             configurations::RTMEngineConfigurations *mpConfiguration;
+            /// Handles of the timers used at each time step.
+            bs::timer::configurations::ChannelHandle mSaveForwardTimer{"ForwardCollector::SaveForward"};
+            bs::timer::configurations::ChannelHandle mApplySourceTimer{"SourceInjector::ApplySource"};
+            bs::timer::configurations::ChannelHandle mForwardStepTimer{"Forward::ComputationKernel::Step"};
+            bs::timer::configurations::ChannelHandle mApplyTracesTimer{"TraceManager::ApplyTraces"};
+            bs::timer::configurations::ChannelHandle mBackwardStepTimer{"Backward::ComputationKernel::Step"};
+            bs::timer::configurations::ChannelHandle mFetchForwardTimer{"ForwardCollector::FetchForward"};
+            bs::timer::configurations::ChannelHandle mCorrelateTimer{"Correlation::Correlate"};
         };
     } //namespace engines
 } //namespace operations
@@ -31,13 +31,32 @@ namespace operations {
         namespace compressors {
             class Compressor {
             public:
+                /**
+                 * @brief Codecs understood by the compressor, the ZFP ones are only
+                 * available when built with ZFP and fall back to raw snapshots otherwise.
+                 */
+                enum CODEC : unsigned int {
+                    ZFP_SNAPSHOTS = 1,
+                    ZFP_SLABS = 2,
+                    BLOCK_FLOATING_POINT = 3
+                };
+
                 Compressor() = default;
 
                 ~Compressor() = default;
 
                 /**
                  * @brief This is the main-entry point for all compression algorithms.
-                 * Currently using a naive switch based differentiation of algorithm used
+                 * Currently using a naive switch based differentiation of algorithm used.
+                 * <br>
+                 * With ZFP, the snapshots are compressed in parallel, as a whole (codecType 1)
+                 * or by slabs of their slowest dimension (codecType 2), into a container
+                 * holding the offset of each of them.
+                 * <br>
+                 * The built-in block floating point codec (codecType 3) needs no external
+                 * library. Each run of values shares a power of two step, bounding the absolute
+                 * error by tolerance, or keeping tolerance bits of the run maximum if
+                 * zfp_is_relative is set. The quantized values are delta coded and bit packed.
                  */
                 static void Compress(float *array, int nx, int ny, int nz, int nt, double tolerance,
                                      unsigned int codecType, const char *filename,
@@ -50,6 +69,14 @@ namespace operations {
                 static void Decompress(float *array, int nx, int ny, int nz, int nt, double tolerance,
                                        unsigned int codecType, const char *filename,
                                        bool zfp_is_relative);
+
+                /**
+                 * @brief Decompresses the snapshot of the given time step only, out of
+                 * the nt snapshots of a file written by Compress, without reading the others.
+                 */
+                static void DecompressSnapshot(float *array, int nx, int ny, int nz, int nt, int time_step,
+                                               double tolerance, unsigned int codecType, const char *filename,
+                                               bool zfp_is_relative);
             };
         } //namespace compressors
     } //namespace utils
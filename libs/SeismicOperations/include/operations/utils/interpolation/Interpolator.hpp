@@ -41,9 +41,24 @@ namespace operations {
                 Interpolate(dataunits::TracesHolder *apTraceHolder, uint actual_nt, float total_time,
                             INTERPOLATION aInterpolation = NONE);
 
+                /**
+                 * @brief Resamples the traces to actual_nt time steps by linear interpolation.
+                 */
                 static float *
                 InterpolateLinear(dataunits::TracesHolder *apTraceHolder, uint actual_nt, float total_time);
 
+                /**
+                 * @brief Resamples the traces to actual_nt time steps by natural cubic splines.
+                 */
+                static float *
+                InterpolateSpline(dataunits::TracesHolder *apTraceHolder, uint actual_nt, float total_time);
+
+                /**
+                 * @brief Resamples the traces to actual_nt time steps by a Lanczos windowed sinc.
+                 */
+                static float *
+                InterpolateSinc(dataunits::TracesHolder *apTraceHolder, uint actual_nt, float total_time);
+
                 static void
                 InterpolateTrilinear(float *old_grid, float *new_grid,
                                      int old_nx, int old_nz, int old_ny,
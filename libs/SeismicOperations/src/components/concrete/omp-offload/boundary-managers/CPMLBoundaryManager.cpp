@@ -34,6 +34,24 @@ FORWARD_DECLARE_SINGLE_BOUND_TEMPLATE(CPMLBoundaryManager::CalculateFirstAuxilia
 
 FORWARD_DECLARE_SINGLE_BOUND_TEMPLATE(CPMLBoundaryManager::CalculateCPMLValue)
 
+FORWARD_DECLARE_TILE_BOUND_TEMPLATE(CPMLBoundaryManager::CalculateTileAuxiliary)
+
+FORWARD_DECLARE_TILE_BOUND_TEMPLATE(CPMLBoundaryManager::CalculateTileCPMLValue)
+
+template<int DIRECTION_, bool OPPOSITE_, int HALF_LENGTH_>
+void CPMLBoundaryManager::CalculateTileAuxiliary(float *apCurrent, int aStartX, int aEndX,
+                                                 int aStartZ, int aEndZ) {
+    /// Applying the CPML inside the kernel sweep is only supported by the OpenMP backend.
+    throw bs::base::exceptions::UNSUPPORTED_FEATURE_EXCEPTION();
+}
+
+template<int DIRECTION_, bool OPPOSITE_, int HALF_LENGTH_>
+void CPMLBoundaryManager::CalculateTileCPMLValue(float *apNext, int aStartX, int aEndX,
+                                                 int aStartZ, int aEndZ) {
+    /// Applying the CPML inside the kernel sweep is only supported by the OpenMP backend.
+    throw bs::base::exceptions::UNSUPPORTED_FEATURE_EXCEPTION();
+}
+
 template<int DIRECTION_, bool OPPOSITE_, int HALF_LENGTH_>
 void CPMLBoundaryManager::CalculateFirstAuxiliary() {
     /* Finding the GPU device. */
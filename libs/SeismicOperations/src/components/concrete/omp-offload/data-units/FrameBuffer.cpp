@@ -46,15 +46,18 @@ class operations::dataunits::FrameBuffer<int>;
 template
 class operations::dataunits::FrameBuffer<uint>;
 
+template
+class operations::dataunits::FrameBuffer<size_t>;
+
 template FrameBuffer<float>::FrameBuffer();
 
-template FrameBuffer<float>::FrameBuffer(uint size);
+template FrameBuffer<float>::FrameBuffer(size_t size);
 
 template FrameBuffer<float>::~FrameBuffer();
 
-template void FrameBuffer<float>::Allocate(uint aSize, const std::string &aName);
+template void FrameBuffer<float>::Allocate(size_t aSize, const std::string &aName);
 
-template void FrameBuffer<float>::Allocate(uint aSize, HALF_LENGTH aHalfLength, const std::string &aName);
+template void FrameBuffer<float>::Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName);
 
 template void FrameBuffer<float>::Free();
 
@@ -71,13 +74,13 @@ template void FrameBuffer<float>::ReflectOnNative();
 
 template FrameBuffer<int>::FrameBuffer();
 
-template FrameBuffer<int>::FrameBuffer(uint size);
+template FrameBuffer<int>::FrameBuffer(size_t size);
 
 template FrameBuffer<int>::~FrameBuffer();
 
-template void FrameBuffer<int>::Allocate(uint aSize, const std::string &aName);
+template void FrameBuffer<int>::Allocate(size_t aSize, const std::string &aName);
 
-template void FrameBuffer<int>::Allocate(uint aSize, HALF_LENGTH aHalfLength, const std::string &aName);
+template void FrameBuffer<int>::Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName);
 
 template void FrameBuffer<int>::Free();
 
@@ -94,13 +97,13 @@ template void FrameBuffer<int>::ReflectOnNative();
 
 template FrameBuffer<uint>::FrameBuffer();
 
-template FrameBuffer<uint>::FrameBuffer(uint size);
+template FrameBuffer<uint>::FrameBuffer(size_t size);
 
 template FrameBuffer<uint>::~FrameBuffer();
 
-template void FrameBuffer<uint>::Allocate(uint aSize, const std::string &aName);
+template void FrameBuffer<uint>::Allocate(size_t aSize, const std::string &aName);
 
-template void FrameBuffer<uint>::Allocate(uint aSize, HALF_LENGTH aHalfLength, const std::string &aName);
+template void FrameBuffer<uint>::Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName);
 
 template void FrameBuffer<uint>::Free();
 
@@ -114,6 +117,28 @@ template void FrameBuffer<uint>::SetNativePointer(uint *ptr);
 
 template void FrameBuffer<uint>::ReflectOnNative();
 
+template FrameBuffer<size_t>::FrameBuffer();
+
+template FrameBuffer<size_t>::FrameBuffer(size_t size);
+
+template FrameBuffer<size_t>::~FrameBuffer();
+
+template void FrameBuffer<size_t>::Allocate(size_t aSize, const std::string &aName);
+
+template void FrameBuffer<size_t>::Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName);
+
+template void FrameBuffer<size_t>::Free();
+
+template size_t *FrameBuffer<size_t>::GetNativePointer();
+
+template size_t *FrameBuffer<size_t>::GetHostPointer();
+
+template size_t *FrameBuffer<size_t>::GetDiskFlushPointer();
+
+template void FrameBuffer<size_t>::SetNativePointer(size_t *ptr);
+
+template void FrameBuffer<size_t>::ReflectOnNative();
+
 
 template<typename T>
 FrameBuffer<T>::FrameBuffer() {
@@ -123,7 +148,7 @@ FrameBuffer<T>::FrameBuffer() {
 }
 
 template<typename T>
-FrameBuffer<T>::FrameBuffer(uint size) {
+FrameBuffer<T>::FrameBuffer(size_t size) {
     Allocate(size);
     mpHostDataPointer = nullptr;
 }
@@ -134,7 +159,7 @@ FrameBuffer<T>::~FrameBuffer() {
 }
 
 template<typename T>
-void FrameBuffer<T>::Allocate(uint aSize, const std::string &aName) {
+void FrameBuffer<T>::Allocate(size_t aSize, const std::string &aName) {
     mAllocatedBytes = sizeof(T) * aSize;
 
     /* Finding gpu device. */
@@ -151,7 +176,7 @@ void FrameBuffer<T>::Allocate(uint aSize, const std::string &aName) {
 }
 
 template<typename T>
-void FrameBuffer<T>::Allocate(uint aSize, HALF_LENGTH aHalfLength, const std::string &aName) {
+void FrameBuffer<T>::Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName) {
     Allocate(aSize, aName);
 }
 
@@ -209,7 +234,7 @@ void FrameBuffer<T>::ReflectOnNative() {
 }
 
 
-void Device::MemSet(void *dest, int value, uint size) {
+void Device::MemSet(void *dest, int value, size_t size) {
     char *h_dest = new char[size];
     memset(h_dest, value, size);
     Device::MemCpy(dest, h_dest, size, Device::COPY_HOST_TO_DEVICE);
@@ -217,7 +242,7 @@ void Device::MemSet(void *dest, int value, uint size) {
 
 }
 
-void Device::MemCpy(void *dest, const void *src, uint size, CopyDirection direction) {
+void Device::MemCpy(void *dest, const void *src, size_t size, CopyDirection direction) {
     /* Finding the host CPU. */
     int host_num = omp_get_initial_device();
 
@@ -31,8 +31,8 @@ using namespace operations::utils::checks;
 
 void
 ApplyBoundaries(uint start_y, uint start_z, uint start_x, uint end_y, uint end_z, uint end_x,
-                uint ny, uint wnx, uint wnznx, uint lny, uint lnz, uint lnx, uint index,
-                uint time_step, uint bound_length, uint half_length, uint size_of_boundaries,
+                uint ny, uint wnx, uint wnznx, uint lny, uint lnz, uint lnx, size_t index,
+                size_t time_step, uint bound_length, uint half_length, size_t size_of_boundaries,
                 float *current_pressure, float *backup_boundaries) {
     for (int iy = start_y; iy < end_y; iy++) {
         for (int iz = start_z; iz < end_z; iz++) {
@@ -79,8 +79,8 @@ ApplyBoundaries(uint start_y, uint start_z, uint start_x, uint end_y, uint end_z
 
 void
 GetBoundaries(uint start_y, uint start_z, uint start_x, uint end_y, uint end_z, uint end_x,
-              uint ny, uint wnx, uint wnznx, uint lny, uint lnz, uint lnx, uint index,
-              uint time_step, uint bound_length, uint half_length, uint size_of_boundaries,
+              uint ny, uint wnx, uint wnznx, uint lny, uint lnz, uint lnx, size_t index,
+              size_t time_step, uint bound_length, uint half_length, size_t size_of_boundaries,
               float *current_pressure, float *backup_boundaries) {
     for (int iy = start_y; iy < end_y; iy++) {
         for (int iz = start_z; iz < end_z; iz++) {
@@ -127,6 +127,9 @@ GetBoundaries(uint start_y, uint start_z, uint start_x, uint end_y, uint end_z,
 
 void
 BoundarySaver::SaveBoundaries(uint aStep) {
+    if (this->mIsCompressed) {
+        throw UNSUPPORTED_FEATURE_EXCEPTION();
+    }
 
     //finding gpu device 
     int device_num = omp_get_default_device();
@@ -135,9 +138,9 @@ BoundarySaver::SaveBoundaries(uint aStep) {
         throw DEVICE_NOT_FOUND_EXCEPTION();
     }
 
-    uint index = 0;
-    uint size_of_boundaries = this->mBoundarySize;
-    uint time_step = aStep;
+    size_t index = 0;
+    size_t size_of_boundaries = this->mBoundarySize;
+    size_t time_step = aStep;
     uint half_length = this->mpComputationParameters->GetHalfLength();
     uint bound_length = this->mpComputationParameters->GetBoundaryLength();
     uint offset = half_length + bound_length;
@@ -181,6 +184,10 @@ BoundarySaver::SaveBoundaries(uint aStep) {
 
 void
 BoundarySaver::RestoreBoundaries(uint aStep) {
+    if (this->mIsCompressed) {
+        throw UNSUPPORTED_FEATURE_EXCEPTION();
+    }
+
     /* Finding the GPU device. */
     int device_num = omp_get_default_device();
 
@@ -188,9 +195,9 @@ BoundarySaver::RestoreBoundaries(uint aStep) {
         throw DEVICE_NOT_FOUND_EXCEPTION();
     }
 
-    uint index = 0;
-    uint size_of_boundaries = this->mBoundarySize;
-    uint time_step = aStep;
+    size_t index = 0;
+    size_t size_of_boundaries = this->mBoundarySize;
+    size_t time_step = aStep;
     uint half_length = this->mpComputationParameters->GetHalfLength();
     uint bound_length = this->mpComputationParameters->GetBoundaryLength();
     uint offset = half_length + bound_length;
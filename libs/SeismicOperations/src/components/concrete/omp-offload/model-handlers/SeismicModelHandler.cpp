@@ -66,8 +66,8 @@ void SeismicModelHandler::SetupWindow() {
             for (uint iy = start_y; iy < end_y; iy++) {
                 for (uint iz = start_z; iz < end_z; iz++) {
                     for (uint ix = start_x; ix < end_x; ix++) {
-                        uint offset_window = iy * wnx * wnz + iz * wnx + ix;
-                        uint offset_full = (iy + sy) * nx * nz + (iz + sz) * nx + ix + sx;
+                        size_t offset_window = (size_t) iy * wnx * wnz + iz * wnx + ix;
+                        size_t offset_full = (size_t) (iy + sy) * nx * nz + (iz + sz) * nx + ix + sx;
                         window_param[offset_window] = param_ptr[offset_full];
                     }
                 }
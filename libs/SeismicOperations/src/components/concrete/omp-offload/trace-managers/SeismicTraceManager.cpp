@@ -19,6 +19,8 @@
 
 #include <omp.h>
 
+#include <bs/base/api/cpp/BSBase.hpp>
+
 #include <operations/components/independents/concrete/trace-managers/SeismicTraceManager.hpp>
 #include <operations/utils/interpolation/Interpolator.hpp>
 #include <operations/utils/io/read_utils.h>
@@ -34,6 +36,16 @@ using namespace operations::utils::checks;
 using namespace operations::utils::io;
 
 
+void SeismicTraceManager::PrepareInjection() {
+    if (this->mInjection == SINC_INJECTION) {
+        bs::base::logger::LoggerSystem::GetInstance()->Error()
+                << "Sinc receiver injection is not supported by this backend, "
+                   "using point injection..." << '\n';
+        this->mInjection = POINT_INJECTION;
+    }
+    this->mInjectionTaps = 1;
+}
+
 // Adding the traces and velocity values over the pressure array
 #pragma omp declare target
 
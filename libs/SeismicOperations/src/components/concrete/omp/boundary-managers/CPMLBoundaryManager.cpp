@@ -29,20 +29,23 @@ FORWARD_DECLARE_SINGLE_BOUND_TEMPLATE(CPMLBoundaryManager::CalculateFirstAuxilia
 
 FORWARD_DECLARE_SINGLE_BOUND_TEMPLATE(CPMLBoundaryManager::CalculateCPMLValue)
 
+FORWARD_DECLARE_TILE_BOUND_TEMPLATE(CPMLBoundaryManager::CalculateTileAuxiliary)
+
+FORWARD_DECLARE_TILE_BOUND_TEMPLATE(CPMLBoundaryManager::CalculateTileCPMLValue)
+
 template<int DIRECTION_, bool OPPOSITE_, int HALF_LENGTH_>
 void CPMLBoundaryManager::CalculateFirstAuxiliary() {
-    int ix, iz;
     float *curr_base = this->mpGridBox->Get(WAVE | GB_PRSS | PREV | DIR_Z)->GetNativePointer();
 
     int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
     int wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
-    int nx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
-    int nz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
+    int lny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize();
 
     int bound_length = this->mpParameters->GetBoundaryLength();
 
     int block_x = this->mpParameters->GetBlockX();
+    int block_y = this->mpParameters->GetBlockY();
     int block_z = this->mpParameters->GetBlockZ();
 
     int nxEnd = this->mpGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - HALF_LENGTH_;
@@ -57,6 +60,14 @@ void CPMLBoundaryManager::CalculateFirstAuxiliary() {
     int *distance_1;
     int WIDTH = bound_length + 2 * HALF_LENGTH_;
 
+    /// The y-axis is only walked in 3D.
+    int y_start = 0;
+    int nyEnd = 1;
+    if (lny > 1) {
+        y_start = HALF_LENGTH_;
+        nyEnd = lny - HALF_LENGTH_;
+    }
+
     // decides the jump step for the stencil
     if (DIRECTION_ == X_AXIS) {
         coeff_a = mpCoeffax->GetNativePointer();
@@ -86,6 +97,18 @@ void CPMLBoundaryManager::CalculateFirstAuxiliary() {
             nzEnd = this->mpGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - HALF_LENGTH_;
             aux = this->mpAux1zdown->GetNativePointer();
         }
+    } else if (DIRECTION_ == Y_AXIS && lny > 1) {
+        coeff_a = this->mpCoeffay->GetNativePointer();
+        coeff_b = this->mpCoeffby->GetNativePointer();
+        first_coeff_h = this->mpFirstCoeffy->GetNativePointer();
+        distance = this->mpDistanceDim3->GetNativePointer();
+        if (!OPPOSITE_) {
+            nyEnd = bound_length + HALF_LENGTH_;
+            aux = this->mpAux1yup->GetNativePointer();
+        } else {
+            y_start = lny - HALF_LENGTH_ - bound_length;
+            aux = this->mpAux1ydown->GetNativePointer();
+        }
     } else {
         throw bs::base::exceptions::UNSUPPORTED_FEATURE_EXCEPTION();
     }
@@ -95,38 +118,52 @@ void CPMLBoundaryManager::CalculateFirstAuxiliary() {
 
 #pragma omp parallel default(shared)
     {
-#pragma omp for schedule(static, 1) collapse(1)
-        for (int bz = z_start; bz < nzEnd; bz += block_z) {
-            for (int bx = x_start; bx < nxEnd; bx += block_x) {
-                // Calculate the endings appropriately (Handle remainder of the cache
-                // blocking loops).
-                int ixEnd = min(bx + block_x, nxEnd);
-                int izEnd = min(bz + block_z, nzEnd);
-
-                for (iz = bz; iz < izEnd; iz++) {
-                    int offset = iz * wnx;
-                    float *curr = curr_base + offset;
+#pragma omp for schedule(static, 1) collapse(3)
+        for (int by = y_start; by < nyEnd; by += block_y) {
+            for (int bz = z_start; bz < nzEnd; bz += block_z) {
+                for (int bx = x_start; bx < nxEnd; bx += block_x) {
+                    // Calculate the endings appropriately (Handle remainder of the cache
+                    // blocking loops).
+                    int ixEnd = min(bx + block_x, nxEnd);
+                    int izEnd = min(bz + block_z, nzEnd);
+                    int iyEnd = min(by + block_y, nyEnd);
+
+                    for (int iy = by; iy < iyEnd; iy++) {
+                        for (int iz = bz; iz < izEnd; iz++) {
+                            size_t offset = (size_t) iy * wnx * wnz + iz * wnx;
+                            float *curr = curr_base + offset;
 #pragma ivdep
-                    for (ix = bx; ix < ixEnd; ix++) {
-                        float value = 0.0;
-                        value = fma(curr[ix], first_coeff_h[0], value);
-                        DERIVE_ARRAY_AXIS_EQ_OFF(ix, distance_1, -, curr, first_coeff_h_1, value)
-                        int index = 0, coeff_ind = 0;
-                        if (DIRECTION_ == X_AXIS) { // case x
-                            if (OPPOSITE_) {
-                                coeff_ind = ix - x_start;
-                                index = iz * WIDTH + (ix - x_start + HALF_LENGTH_);
-                            } else {
-                                coeff_ind = bound_length - ix + HALF_LENGTH_ - 1;
-                                index = iz * WIDTH + ix;
-                            }
-                        } else if (DIRECTION_ == Z_AXIS) { // case z
-                            if (OPPOSITE_) {
-                                coeff_ind = iz - z_start;
-                                index = (iz - z_start + HALF_LENGTH_) * wnx + ix;
-                            } else {
-                                coeff_ind = bound_length - iz + HALF_LENGTH_ - 1;
-                                index = iz * wnx + ix;
+                            for (int ix = bx; ix < ixEnd; ix++) {
+                                float value = 0.0;
+                                value = fma(curr[ix], first_coeff_h[0], value);
+                                DERIVE_ARRAY_AXIS_EQ_OFF(ix, distance_1, -, curr, first_coeff_h_1, value)
+                                int index = 0, coeff_ind = 0;
+                                if (DIRECTION_ == X_AXIS) { // case x
+                                    if (OPPOSITE_) {
+                                        coeff_ind = ix - x_start;
+                                        index = (iy * wnz + iz) * WIDTH + (ix - x_start + HALF_LENGTH_);
+                                    } else {
+                                        coeff_ind = bound_length - ix + HALF_LENGTH_ - 1;
+                                        index = (iy * wnz + iz) * WIDTH + ix;
+                                    }
+                                } else if (DIRECTION_ == Z_AXIS) { // case z
+                                    if (OPPOSITE_) {
+                                        coeff_ind = iz - z_start;
+                                        index = (iy * WIDTH + iz - z_start + HALF_LENGTH_) * wnx + ix;
+                                    } else {
+                                        coeff_ind = bound_length - iz + HALF_LENGTH_ - 1;
+                                        index = (iy * WIDTH + iz) * wnx + ix;
+                                    }
+                                } else { // case y
+                                    if (OPPOSITE_) {
+                                        coeff_ind = iy - y_start;
+                                        index = (iy - y_start + HALF_LENGTH_) * wnx * wnz + iz * wnx + ix;
+                                    } else {
+                                        coeff_ind = bound_length - iy + HALF_LENGTH_ - 1;
+                                        index = iy * wnx * wnz + iz * wnx + ix;
+                                    }
+                                }
+                                aux[index] = coeff_a[coeff_ind] * aux[index] + coeff_b[coeff_ind] * value;
                             }
                         }
                     }
@@ -138,7 +175,6 @@ void CPMLBoundaryManager::CalculateFirstAuxiliary() {
 
 template<int direction, bool OPPOSITE_, int HALF_LENGTH_>
 void CPMLBoundaryManager::CalculateCPMLValue() {
-    int ix, iz;
     // direction 1 means in x , direction 2 means in z , else means in y;
 
     float *curr_base = this->mpGridBox->Get(WAVE | GB_PRSS | PREV | DIR_Z)->GetNativePointer();
@@ -149,10 +185,10 @@ void CPMLBoundaryManager::CalculateCPMLValue() {
     int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
     int wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
-    int nx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
-    int nz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
+    int lny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize();
 
     int block_x = this->mpParameters->GetBlockX();
+    int block_y = this->mpParameters->GetBlockY();
     int block_z = this->mpParameters->GetBlockZ();
 
     float *vel_base = this->mpGridBox->Get(PARM | WIND | GB_VEL)->GetNativePointer();
@@ -167,6 +203,14 @@ void CPMLBoundaryManager::CalculateCPMLValue() {
 
     int WIDTH = bound_length + 2 * half_length;
 
+    /// The y-axis is only walked in 3D.
+    int y_start = 0;
+    int nyEnd = 1;
+    if (lny > 1) {
+        y_start = half_length;
+        nyEnd = lny - half_length;
+    }
+
     int *distance;
     float *coeff_first_h;
     float *coeff_h;
@@ -206,6 +250,21 @@ void CPMLBoundaryManager::CalculateCPMLValue() {
             aux_first = this->mpAux1zdown->GetNativePointer();
             aux_second = this->mpAux2zdown->GetNativePointer();
         }
+    } else if (direction == Y_AXIS && lny > 1) {
+        coeff_a = this->mpCoeffay->GetNativePointer();
+        coeff_b = this->mpCoeffby->GetNativePointer();
+        distance = this->mpDistanceDim3->GetNativePointer();
+        coeff_first_h = this->mpFirstCoeffy->GetNativePointer();
+        coeff_h = this->mpSecondCoeffy->GetNativePointer();
+        if (!OPPOSITE_) {
+            nyEnd = bound_length + half_length;
+            aux_first = this->mpAux1yup->GetNativePointer();
+            aux_second = this->mpAux2yup->GetNativePointer();
+        } else {
+            y_start = lny - half_length - bound_length;
+            aux_first = this->mpAux1ydown->GetNativePointer();
+            aux_second = this->mpAux2ydown->GetNativePointer();
+        }
     } else {
         throw bs::base::exceptions::UNSUPPORTED_FEATURE_EXCEPTION();
     }
@@ -216,61 +275,274 @@ void CPMLBoundaryManager::CalculateCPMLValue() {
 
 #pragma omp parallel default(shared)
     {
-#pragma omp for schedule(static, 1) collapse(1)
-        for (int bz = z_start; bz < nzEnd; bz += block_z) {
-            for (int bx = x_start; bx < nxEnd; bx += block_x) {
-                // Calculate the endings appropriately (Handle remainder of the cache
-                // blocking loops).
-                int ixEnd = fmin(bx + block_x, nxEnd);
-                int izEnd = fmin(bz + block_z, nzEnd);
-                // Loop on the elements in the block.
-                for (iz = bz; iz < izEnd; ++iz) {
-                    int offset = iz * wnx;
-                    float *curr = curr_base + offset;
-                    float *vel = vel_base + offset;
-                    float *next = next_base + offset;
+#pragma omp for schedule(static, 1) collapse(3)
+        for (int by = y_start; by < nyEnd; by += block_y) {
+            for (int bz = z_start; bz < nzEnd; bz += block_z) {
+                for (int bx = x_start; bx < nxEnd; bx += block_x) {
+                    // Calculate the endings appropriately (Handle remainder of the cache
+                    // blocking loops).
+                    int ixEnd = fmin(bx + block_x, nxEnd);
+                    int izEnd = fmin(bz + block_z, nzEnd);
+                    int iyEnd = fmin(by + block_y, nyEnd);
+                    // Loop on the elements in the block.
+                    for (int iy = by; iy < iyEnd; ++iy) {
+                        for (int iz = bz; iz < izEnd; ++iz) {
+                            size_t offset = (size_t) iy * wnx * wnz + iz * wnx;
+                            float *curr = curr_base + offset;
+                            float *vel = vel_base + offset;
+                            float *next = next_base + offset;
 #pragma ivdep
-                    for (ix = bx; ix < ixEnd; ix++) {
-                        float pressure_value = 0.0;
-                        float d_first_value = 0.0;
-                        int index = 0;
-                        int coeff_ind = 0;
-                        float sum_val = 0.0;
-                        float cpml_val = 0.0;
-
-                        if (direction == X_AXIS) { // case x
-                            if (OPPOSITE_) {
-                                coeff_ind = ix - x_start;
-                                index = iz * WIDTH + (ix - x_start + half_length);
-                            } else {
-                                coeff_ind = bound_length - ix + half_length - 1;
-                                index = iz * WIDTH + ix;
-                            }
-                        } else if (direction == Z_AXIS) { // case z
-                            if (OPPOSITE_) {
-                                coeff_ind = iz - z_start;
-                                index = (iz - z_start + half_length) * wnx + ix;
-                            } else {
-                                coeff_ind = bound_length - iz + half_length - 1;
-                                index = iz * wnx + ix;
+                            for (int ix = bx; ix < ixEnd; ix++) {
+                                float pressure_value = 0.0;
+                                float d_first_value = 0.0;
+                                int index = 0;
+                                int coeff_ind = 0;
+                                float sum_val = 0.0;
+                                float cpml_val = 0.0;
+
+                                if (direction == X_AXIS) { // case x
+                                    if (OPPOSITE_) {
+                                        coeff_ind = ix - x_start;
+                                        index = (iy * wnz + iz) * WIDTH + (ix - x_start + half_length);
+                                    } else {
+                                        coeff_ind = bound_length - ix + half_length - 1;
+                                        index = (iy * wnz + iz) * WIDTH + ix;
+                                    }
+                                } else if (direction == Z_AXIS) { // case z
+                                    if (OPPOSITE_) {
+                                        coeff_ind = iz - z_start;
+                                        index = (iy * WIDTH + iz - z_start + half_length) * wnx + ix;
+                                    } else {
+                                        coeff_ind = bound_length - iz + half_length - 1;
+                                        index = (iy * WIDTH + iz) * wnx + ix;
+                                    }
+                                } else { // case y
+                                    if (OPPOSITE_) {
+                                        coeff_ind = iy - y_start;
+                                        index = (iy - y_start + half_length) * wnx * wnz + iz * wnx + ix;
+                                    } else {
+                                        coeff_ind = bound_length - iy + half_length - 1;
+                                        index = iy * wnx * wnz + iz * wnx + ix;
+                                    }
+                                }
+
+                                pressure_value = fma(curr[ix], coeff_h[0], pressure_value);
+                                DERIVE_ARRAY_AXIS_EQ_OFF(ix, distance_1, +, curr, coeff_h_1, pressure_value)
+
+                                // calculating the first derivative of the aux1
+                                d_first_value = fma(aux_first[index], coeff_first_h[0], d_first_value);
+                                DERIVE_ARRAY_AXIS_EQ_OFF(index, distance_1, -, aux_first, coeff_first_h_1,
+                                                         d_first_value)
+                                sum_val = d_first_value + pressure_value;
+                                aux_second[index] = coeff_a[coeff_ind] * aux_second[index] +
+                                                    coeff_b[coeff_ind] * sum_val;
+                                cpml_val = vel[ix] * (d_first_value + aux_second[index]);
+                                next[ix] += cpml_val;
                             }
                         }
-
-                        pressure_value = fma(curr[ix], coeff_h[0], pressure_value);
-                        DERIVE_ARRAY_AXIS_EQ_OFF(ix, distance_1, +, curr, coeff_h_1, pressure_value)
-
-                        // calculating the first derivative of the aux1
-                        d_first_value = fma(aux_first[index], coeff_first_h[0], d_first_value);
-                        DERIVE_ARRAY_AXIS_EQ_OFF(index, distance_1, -, aux_first, coeff_first_h_1,
-                                                 d_first_value)
-                        sum_val = d_first_value + pressure_value;
-                        aux_second[index] = coeff_a[coeff_ind] * aux_second[index] +
-                                            coeff_b[coeff_ind] * sum_val;
-                        cpml_val = vel[ix] * (d_first_value + aux_second[index]);
-                        next[ix] += cpml_val;
                     }
                 }
             }
         }
     }
 }
+
+template<int DIRECTION_, bool OPPOSITE_, int HALF_LENGTH_>
+void CPMLBoundaryManager::CalculateTileAuxiliary(float *apCurrent, int aStartX, int aEndX,
+                                                 int aStartZ, int aEndZ) {
+    int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+
+    int bound_length = this->mpParameters->GetBoundaryLength();
+
+    int nxEnd = this->mpGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - HALF_LENGTH_;
+    int nzEnd = this->mpGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - HALF_LENGTH_;
+
+    float *aux_first, *aux_second, *coeff_a, *coeff_b;
+    int z_start = HALF_LENGTH_;
+    int x_start = HALF_LENGTH_;
+    float *coeff_first_h;
+    float *coeff_h;
+    int *distance;
+    int WIDTH = bound_length + 2 * HALF_LENGTH_;
+
+    // decides the jump step for the stencil
+    if (DIRECTION_ == X_AXIS) {
+        coeff_a = this->mpCoeffax->GetNativePointer();
+        coeff_b = this->mpCoeffbx->GetNativePointer();
+        distance = this->mpDistanceDim1->GetNativePointer();
+        coeff_first_h = this->mpFirstCoeffx->GetNativePointer();
+        coeff_h = this->mpSecondCoeffx->GetNativePointer();
+        if (!OPPOSITE_) {
+            nxEnd = bound_length + HALF_LENGTH_;
+            aux_first = this->mpAux1xup->GetNativePointer();
+            aux_second = this->mpAux2xup->GetNativePointer();
+        } else {
+            x_start = nxEnd - bound_length;
+            aux_first = this->mpAux1xdown->GetNativePointer();
+            aux_second = this->mpAux2xdown->GetNativePointer();
+        }
+    } else if (DIRECTION_ == Z_AXIS) {
+        coeff_a = this->mpCoeffaz->GetNativePointer();
+        coeff_b = this->mpCoeffbz->GetNativePointer();
+        distance = this->mpDistanceDim2->GetNativePointer();
+        coeff_first_h = this->mpFirstCoeffz->GetNativePointer();
+        coeff_h = this->mpSecondCoeffz->GetNativePointer();
+        if (!OPPOSITE_) {
+            nzEnd = bound_length + HALF_LENGTH_;
+            aux_first = this->mpAux1zup->GetNativePointer();
+            aux_second = this->mpAux2zup->GetNativePointer();
+        } else {
+            z_start = nzEnd - bound_length;
+            aux_first = this->mpAux1zdown->GetNativePointer();
+            aux_second = this->mpAux2zdown->GetNativePointer();
+        }
+    } else {
+        throw bs::base::exceptions::UNSUPPORTED_FEATURE_EXCEPTION();
+    }
+
+    auto distance_1 = &distance[1];
+    auto coeff_h_1 = &coeff_h[1];
+    auto coeff_first_h_1 = &coeff_first_h[1];
+
+    /// Only the part of the tile inside the boundary strip is processed.
+    int ixStart = max(aStartX, x_start);
+    int ixEnd = min(aEndX, nxEnd);
+    int izStart = max(aStartZ, z_start);
+    int izEnd = min(aEndZ, nzEnd);
+
+    for (int iz = izStart; iz < izEnd; ++iz) {
+        float *curr = apCurrent + iz * wnx;
+#pragma ivdep
+        for (int ix = ixStart; ix < ixEnd; ix++) {
+            int index = 0;
+            int coeff_ind = 0;
+            if (DIRECTION_ == X_AXIS) { // case x
+                if (OPPOSITE_) {
+                    coeff_ind = ix - x_start;
+                    index = iz * WIDTH + (ix - x_start + HALF_LENGTH_);
+                } else {
+                    coeff_ind = bound_length - ix + HALF_LENGTH_ - 1;
+                    index = iz * WIDTH + ix;
+                }
+            } else if (DIRECTION_ == Z_AXIS) { // case z
+                if (OPPOSITE_) {
+                    coeff_ind = iz - z_start;
+                    index = (iz - z_start + HALF_LENGTH_) * wnx + ix;
+                } else {
+                    coeff_ind = bound_length - iz + HALF_LENGTH_ - 1;
+                    index = iz * wnx + ix;
+                }
+            }
+
+            float first_value = 0.0;
+            first_value = fma(curr[ix], coeff_first_h[0], first_value);
+            DERIVE_ARRAY_AXIS_EQ_OFF(ix, distance_1, -, curr, coeff_first_h_1, first_value)
+
+            float pressure_value = 0.0;
+            pressure_value = fma(curr[ix], coeff_h[0], pressure_value);
+            DERIVE_ARRAY_AXIS_EQ_OFF(ix, distance_1, +, curr, coeff_h_1, pressure_value)
+
+            aux_first[index] = coeff_a[coeff_ind] * aux_first[index] +
+                               coeff_b[coeff_ind] * first_value;
+            // The derivative of the first auxiliary needs the neighbouring tiles,
+            // it is added once all of them are updated.
+            aux_second[index] = coeff_a[coeff_ind] * aux_second[index] +
+                                coeff_b[coeff_ind] * pressure_value;
+        }
+    }
+}
+
+template<int DIRECTION_, bool OPPOSITE_, int HALF_LENGTH_>
+void CPMLBoundaryManager::CalculateTileCPMLValue(float *apNext, int aStartX, int aEndX,
+                                                 int aStartZ, int aEndZ) {
+    int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+
+    int bound_length = this->mpParameters->GetBoundaryLength();
+
+    float *vel_base = this->mpGridBox->Get(PARM | WIND | GB_VEL)->GetNativePointer();
+
+    int nxEnd = this->mpGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - HALF_LENGTH_;
+    int nzEnd = this->mpGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - HALF_LENGTH_;
+
+    float *aux_first, *aux_second, *coeff_b;
+    int z_start = HALF_LENGTH_;
+    int x_start = HALF_LENGTH_;
+    float *coeff_first_h;
+    int *distance;
+    int WIDTH = bound_length + 2 * HALF_LENGTH_;
+
+    // decides the jump step for the stencil
+    if (DIRECTION_ == X_AXIS) {
+        coeff_b = this->mpCoeffbx->GetNativePointer();
+        distance = this->mpDistanceDim1->GetNativePointer();
+        coeff_first_h = this->mpFirstCoeffx->GetNativePointer();
+        if (!OPPOSITE_) {
+            nxEnd = bound_length + HALF_LENGTH_;
+            aux_first = this->mpAux1xup->GetNativePointer();
+            aux_second = this->mpAux2xup->GetNativePointer();
+        } else {
+            x_start = nxEnd - bound_length;
+            aux_first = this->mpAux1xdown->GetNativePointer();
+            aux_second = this->mpAux2xdown->GetNativePointer();
+        }
+    } else if (DIRECTION_ == Z_AXIS) {
+        coeff_b = this->mpCoeffbz->GetNativePointer();
+        distance = this->mpDistanceDim2->GetNativePointer();
+        coeff_first_h = this->mpFirstCoeffz->GetNativePointer();
+        if (!OPPOSITE_) {
+            nzEnd = bound_length + HALF_LENGTH_;
+            aux_first = this->mpAux1zup->GetNativePointer();
+            aux_second = this->mpAux2zup->GetNativePointer();
+        } else {
+            z_start = nzEnd - bound_length;
+            aux_first = this->mpAux1zdown->GetNativePointer();
+            aux_second = this->mpAux2zdown->GetNativePointer();
+        }
+    } else {
+        throw bs::base::exceptions::UNSUPPORTED_FEATURE_EXCEPTION();
+    }
+
+    auto distance_1 = &distance[1];
+    auto coeff_first_h_1 = &coeff_first_h[1];
+
+    /// Only the part of the tile inside the boundary strip is processed.
+    int ixStart = max(aStartX, x_start);
+    int ixEnd = min(aEndX, nxEnd);
+    int izStart = max(aStartZ, z_start);
+    int izEnd = min(aEndZ, nzEnd);
+
+    for (int iz = izStart; iz < izEnd; ++iz) {
+        float *next = apNext + iz * wnx;
+        float *vel = vel_base + iz * wnx;
+#pragma ivdep
+        for (int ix = ixStart; ix < ixEnd; ix++) {
+            int index = 0;
+            int coeff_ind = 0;
+            if (DIRECTION_ == X_AXIS) { // case x
+                if (OPPOSITE_) {
+                    coeff_ind = ix - x_start;
+                    index = iz * WIDTH + (ix - x_start + HALF_LENGTH_);
+                } else {
+                    coeff_ind = bound_length - ix + HALF_LENGTH_ - 1;
+                    index = iz * WIDTH + ix;
+                }
+            } else if (DIRECTION_ == Z_AXIS) { // case z
+                if (OPPOSITE_) {
+                    coeff_ind = iz - z_start;
+                    index = (iz - z_start + HALF_LENGTH_) * wnx + ix;
+                } else {
+                    coeff_ind = bound_length - iz + HALF_LENGTH_ - 1;
+                    index = iz * wnx + ix;
+                }
+            }
+
+            // calculating the first derivative of the aux1
+            float d_first_value = 0.0;
+            d_first_value = fma(aux_first[index], coeff_first_h[0], d_first_value);
+            DERIVE_ARRAY_AXIS_EQ_OFF(index, distance_1, -, aux_first, coeff_first_h_1,
+                                     d_first_value)
+            aux_second[index] += coeff_b[coeff_ind] * d_first_value;
+            next[ix] += vel[ix] * (d_first_value + aux_second[index]);
+        }
+    }
+}
@@ -46,6 +46,52 @@ void SpongeBoundaryManager::ApplyBoundaryOnField(float *next) {
     uint half_length = mpParameters->GetHalfLength();
 
     float *sponge_coefficients = mpSpongeCoefficients->GetNativePointer();
+
+    int lwny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize();
+    if (lwny > 1) {
+        /*
+         * In 3D each point of the boundary layers is damped once by the strongest
+         * coefficient among the axes it lies in the boundary of, which extends the
+         * 2D corners handling to the edges and corners of the volume.
+         */
+        int wnx_wnz = wnx * wnz;
+        int b_l = bound_length;
+        int h_l = half_length;
+#pragma omp parallel for schedule(static) collapse(2)
+        for (int iy = h_l; iy < lwny - h_l; iy++) {
+            for (int iz = h_l; iz < lwnz - h_l; iz++) {
+                int depth_y = min(iy - h_l, lwny - h_l - 1 - iy);
+                int depth_z = min(iz - h_l, lwnz - h_l - 1 - iz);
+                float *row = next + iy * wnx_wnz + iz * wnx;
+                if (depth_y < b_l || depth_z < b_l) {
+                    /// Rows inside the y or z layers are damped along all their length.
+                    float coefficient_yz = 1.0f;
+                    if (depth_y < b_l) {
+                        coefficient_yz = sponge_coefficients[depth_y];
+                    }
+                    if (depth_z < b_l) {
+                        coefficient_yz = min(coefficient_yz, sponge_coefficients[depth_z]);
+                    }
+                    for (int ix = h_l; ix < lwnx - h_l; ix++) {
+                        int depth_x = min(ix - h_l, lwnx - h_l - 1 - ix);
+                        float coefficient = coefficient_yz;
+                        if (depth_x < b_l) {
+                            coefficient = min(coefficient, sponge_coefficients[depth_x]);
+                        }
+                        row[ix] *= coefficient;
+                    }
+                } else {
+                    /// The other rows only cross the x layers at both of their ends.
+                    for (int column = 0; column < b_l; column++) {
+                        row[h_l + column] *= sponge_coefficients[column];
+                        row[lwnx - h_l - 1 - column] *= sponge_coefficients[column];
+                    }
+                }
+            }
+        }
+        return;
+    }
+
 #pragma omp parallel default(shared)
     {
 #pragma omp for schedule(static, 1) collapse(1)
@@ -16,6 +16,8 @@
  * You should have received a copy of the GNU Lesser General Public
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <algorithm>
+#include <cmath>
 
 #include <operations/components/independents/concrete/boundary-managers/extensions/RandomExtension.hpp>
 
@@ -24,6 +26,28 @@ using namespace operations::components;
 using namespace operations::components::addons;
 using namespace bs::base::exceptions;
 
+/*
+ * Draw identifiers, each boundary point consumes its own draws so
+ * the result does not depend on the evaluation order.
+ */
+#define DRAW_SEED       0
+#define DRAW_X          1
+#define DRAW_Z          2
+
+/**
+ * @brief
+ * Counter based random value between 0 and 1, computed from the shot seed,
+ * the index of the point and the draw of this point (SplitMix64 finalizer).
+ */
+static inline float random_value(uint64_t aSeed, size_t aIndex, uint aDraw) {
+    uint64_t z = aSeed ^((aIndex << 2u) | aDraw);
+    z += 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27u)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31u);
+    return (float) (z >> 40u) / (float) (1u << 24u);
+}
+
 void RandomExtension::VelocityExtensionHelper(float *apPropertyArray,
                                               int aStartX, int aStartY, int aStartZ,
                                               int aEndX, int aEndY, int aEndZ,
@@ -34,169 +58,104 @@ void RandomExtension::VelocityExtensionHelper(float *apPropertyArray,
      * initialize values required for grain computing
      */
     int dx = mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetCellDimension();
-    int dy = mpGridBox->GetAfterSamplingAxis()->GetYAxis().GetCellDimension();
     int dz = mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetCellDimension();
 
     int grain_side_length = this->mGrainSideLength; // in meters
 
-    int stride_x = grain_side_length / dx;
-    int stride_z = grain_side_length / dz;
+    int stride_x = max(grain_side_length / dx, 1);
+    int stride_z = max(grain_side_length / dz, 1);
 
-    int stride_y = 0;
-
-    if (aNy != 1) {
-        stride_y = grain_side_length / dy;
-    }
+    int bl = aBoundaryLength;
+    uint64_t seed = this->mShotSeed;
 
     /*
      * compute maximum value of the property
      */
-    float max_velocity = 0;
-    max_velocity = *max_element(apPropertyArray, apPropertyArray + aNx * aNy * aNz);
+    float max_velocity = *max_element(apPropertyArray, apPropertyArray + (size_t) aNx * aNy * aNz);
 
     /*
      * processing boundaries in X dimension "left and right bounds"
+     *
+     * seeds lie on a regular grid starting from the first boundary row and
+     * the outer column, so the seed owning a point is found by integer division.
      */
+    int row_start = aStartZ + bl;
+    int row_end = aEndZ - bl;
 
     /*
      * populate random seeds
      */
-    vector<Point3D> seeds;
-
-
-    float temp = 0;
-    for (int row = aStartZ + aBoundaryLength; row < aEndZ - aBoundaryLength; row += stride_z) {
-        for (int column = 0; column < aBoundaryLength; column += stride_x) {
+#pragma omp parallel for collapse(2) schedule(static)
+    for (int row = row_start; row < row_end; row += stride_z) {
+        for (int column = 0; column < bl; column += stride_x) {
+            float scale = ((float) (bl - column) / bl) * max_velocity;
 
             int index = row * aNx + column + aStartX;
-            temp = GET_RANDOM_VALUE(aBoundaryLength, column) * max_velocity;
-            apPropertyArray[index] = abs(apPropertyArray[row * aNx + aBoundaryLength + aStartX] - temp);
-
-            seeds.push_back(Point3D(column + aStartX, 1, row));
+            apPropertyArray[index] = abs(apPropertyArray[row * aNx + bl + aStartX] -
+                                         random_value(seed, index, DRAW_SEED) * scale);
 
             index = row * aNx + (aEndX - column - 1);
-            temp = GET_RANDOM_VALUE(aBoundaryLength, column) * max_velocity;
-            apPropertyArray[index] = abs(apPropertyArray[row * aNx + (aEndX - 1 - aBoundaryLength)] - temp);
-
-            seeds.push_back(Point3D((aEndX - column - 1), 1, row));
+            apPropertyArray[index] = abs(apPropertyArray[row * aNx + (aEndX - 1 - bl)] -
+                                         random_value(seed, index, DRAW_SEED) * scale);
         }
     }
 
-
     /*
-     * fill empty points
+     * fill empty points, each point only reads seeds or interior points
      */
-    for (int row = aStartZ + aBoundaryLength; row < aEndZ - aBoundaryLength; row++) {
-        for (int column = 0; column < aBoundaryLength; column++) {
-
-            Point3D left_point(column + aStartX, 1, row);
-            Point3D right_point((aEndX - column - 1), 1, row);
+#pragma omp parallel for collapse(2) schedule(static)
+    for (int row = row_start; row < row_end; row++) {
+        for (int column = 0; column < bl; column++) {
+            int seed_column = (column / stride_x) * stride_x;
+            int seed_z = row_start + ((row - row_start) / stride_z) * stride_z;
 
-            /*
-             * check if this point is a seed point
-             * same check works for both left and right points
-             */
-            bool is_seed = false;
-            for (auto seed : seeds) {
-                if (left_point == seed) {
-                    is_seed = true;
-                    break;
-                }
-            }
-            if (is_seed) {
+            if (seed_column == column && seed_z == row) {
                 continue; // this is a seed point, don't fill
             }
 
-            Point3D left_point_seed(0, 0, 0);
-            Point3D right_point_seed(0, 0, 0);
             /*
-             * Get nearest seed
+             * populate left point
              */
+            int left_x = column + aStartX;
+            int seed_x = seed_column + aStartX;
+            int left_index = row * aNx + left_x;
 
-            for (auto seed : seeds) {
-                if (
-                        (seed.x <= left_point.x) && (seed.x + stride_x > left_point.x) &&
-                        (seed.z <= left_point.z) && (seed.z + stride_z > left_point.z)
-                        ) {
-                    left_point_seed = seed;
-                }
-
-                if (
-                        (seed.x >= right_point.x) && (seed.x - stride_x < right_point.x) &&
-                        (seed.z <= right_point.z) && (seed.z + stride_z > right_point.z)
-                        ) {
-                    right_point_seed = seed;
-                }
-            }
+            float px = random_value(seed, left_index, DRAW_X);
+            float pz = random_value(seed, left_index, DRAW_Z);
 
-            /*
-             * populate left point
-             */
-            int id_x;
-            int id_z;
-
-            float px = RANDOM_VALUE;
-            float pz = RANDOM_VALUE;
-
-            float denom_x = (float) (left_point.x - left_point_seed.x) / stride_x;
-            float denom_z = (float) (left_point.z - left_point_seed.z) / stride_z;
-
-            if ((px <= denom_x) && (pz <= denom_z)) {
-                id_x = left_point_seed.x + stride_x;
-                id_z = left_point_seed.z + stride_z;
-            } else if ((px <= denom_x) && (pz > denom_z)) {
-                id_x = left_point_seed.x + stride_x;
-                id_z = left_point_seed.z;
-            } else if ((px > denom_x) && (pz <= denom_z)) {
-                id_x = left_point_seed.x;
-                id_z = left_point_seed.z + stride_z;
-            } else if ((px > denom_x) && (pz > denom_z)) {
-                id_x = left_point_seed.x;
-                id_z = left_point_seed.z;
-            }
+            float denom_x = (float) (left_x - seed_x) / stride_x;
+            float denom_z = (float) (row - seed_z) / stride_z;
 
-            if (id_z >= aEndZ - aBoundaryLength) {
-                id_z = left_point_seed.z;
+            int id_x = (px <= denom_x) ? seed_x + stride_x : seed_x;
+            int id_z = (pz <= denom_z) ? seed_z + stride_z : seed_z;
+
+            if (id_z >= row_end) {
+                id_z = seed_z;
             }
-            apPropertyArray[left_point.z * aNx + left_point.x] = apPropertyArray[id_z * aNx + id_x];
+            apPropertyArray[left_index] = apPropertyArray[id_z * aNx + id_x];
 
             /*
              * populate right point
              */
+            int right_x = aEndX - column - 1;
+            seed_x = aEndX - seed_column - 1;
+            int right_index = row * aNx + right_x;
 
-            px = RANDOM_VALUE;
-            pz = RANDOM_VALUE;
-
-            denom_x = (float) (right_point_seed.x - right_point.x) / stride_x;
-            denom_z = (float) (right_point.z - right_point_seed.z) / stride_z;
-
-            if ((px >= denom_x) && (pz <= denom_z)) {
-                id_x = right_point_seed.x;
-                id_z = right_point_seed.z + stride_z;
-            } else if ((px >= denom_x) && (pz > denom_z)) {
-                id_x = right_point_seed.x;
-                id_z = right_point_seed.z;
-            } else if ((px < denom_x) && (pz <= denom_z)) {
-                id_x = right_point_seed.x - stride_x;
-                id_z = right_point_seed.z + stride_z;
-            } else if ((px < denom_x) && (pz > denom_z)) {
-                id_x = right_point_seed.x - stride_x;
-                id_z = right_point_seed.z;
-            }
+            px = random_value(seed, right_index, DRAW_X);
+            pz = random_value(seed, right_index, DRAW_Z);
 
-            if (id_x >= aEndX) {
-                id_x = right_point_seed.x;
-            }
+            denom_x = (float) (seed_x - right_x) / stride_x;
+
+            id_x = (px >= denom_x) ? seed_x : seed_x - stride_x;
+            id_z = (pz <= denom_z) ? seed_z + stride_z : seed_z;
 
-            if (id_z >= aEndZ - aBoundaryLength) {
-                id_z = right_point_seed.z;
+            if (id_z >= row_end) {
+                id_z = seed_z;
             }
-            apPropertyArray[right_point.z * aNx + right_point.x] = apPropertyArray[id_z * aNx + id_x];
+            apPropertyArray[right_index] = apPropertyArray[id_z * aNx + id_x];
         }
     }
 
-    seeds.clear();
-
     /*
      * processing boundaries in Z dimension "bottom bound"
      */
@@ -204,88 +163,47 @@ void RandomExtension::VelocityExtensionHelper(float *apPropertyArray,
     /*
      * populate random seeds
      */
-    for (int row = 0; row < aBoundaryLength; row += stride_z) {
+#pragma omp parallel for collapse(2) schedule(static)
+    for (int row = 0; row < bl; row += stride_z) {
         for (int column = aStartX; column < aEndX; column += stride_x) {
-
-
             int index = (aEndZ - row - 1) * aNx + column;
-            temp = GET_RANDOM_VALUE(aBoundaryLength, row) * max_velocity;
-            apPropertyArray[index] = abs(apPropertyArray[(aEndZ - 1 - aBoundaryLength) * aNx + column] - temp);
-
-            seeds.push_back(Point3D(column, 1, (aEndZ - row - 1)));
+            float temp = random_value(seed, index, DRAW_SEED) * ((float) (bl - row) / bl) * max_velocity;
+            apPropertyArray[index] = abs(apPropertyArray[(aEndZ - 1 - bl) * aNx + column] - temp);
         }
     }
 
     /*
      * fill empty points
      */
-    for (int row = 0; row < aBoundaryLength; row++) {
+#pragma omp parallel for collapse(2) schedule(static)
+    for (int row = 0; row < bl; row++) {
         for (int column = aStartX; column < aEndX; column++) {
+            int seed_row = (row / stride_z) * stride_z;
+            int seed_x = aStartX + ((column - aStartX) / stride_x) * stride_x;
 
-            Point3D bottom_point(column, 1, (aEndZ - row - 1));
-
-            /*
-             * check if this point is a seed point
-             */
-            bool is_seed = false;
-            for (auto seed:seeds) {
-                if (bottom_point == seed) {
-                    is_seed = true;
-                    break;
-                }
-            }
-            if (is_seed) {
+            if (seed_row == row && seed_x == column) {
                 continue; // this is a seed point, don't fill
             }
 
-            Point3D bottom_point_seed(0, 0, 0);
-            /*
-             * Get nearest seed
-             */
+            int bottom_z = aEndZ - row - 1;
+            int seed_z = aEndZ - seed_row - 1;
+            int index = bottom_z * aNx + column;
 
-            for (auto seed:seeds) {
-                if (
-                        (seed.x <= bottom_point.x) && (seed.x + stride_x > bottom_point.x) &&
-                        (seed.z >= bottom_point.z) && (seed.z - stride_z < bottom_point.z)
-                        ) {
-                    bottom_point_seed = seed;
-                }
-            }
+            float px = random_value(seed, index, DRAW_X);
+            float pz = random_value(seed, index, DRAW_Z);
 
-            /*
-             * populate left point
-             */
-            int id_x;
-            int id_z;
-
-            float px = RANDOM_VALUE;
-            float pz = RANDOM_VALUE;
-
-            float denom_x = (float) (bottom_point.x - bottom_point_seed.x) / stride_x;
-            float denom_z = (float) (bottom_point_seed.z - bottom_point.z) / stride_z;
-
-            if ((px <= denom_x) && (pz >= denom_z)) {
-                id_x = bottom_point_seed.x + stride_x;
-                id_z = bottom_point_seed.z;
-            } else if ((px <= denom_x) && (pz < denom_z)) {
-                id_x = bottom_point_seed.x + stride_x;
-                id_z = bottom_point_seed.z - stride_z;
-            } else if ((px > denom_x) && (pz >= denom_z)) {
-                id_x = bottom_point_seed.x;
-                id_z = bottom_point_seed.z;
-            } else if ((px > denom_x) && (pz < denom_z)) {
-                id_x = bottom_point_seed.x;
-                id_z = bottom_point_seed.z - stride_z;
-            }
+            float denom_x = (float) (column - seed_x) / stride_x;
+            float denom_z = (float) (seed_z - bottom_z) / stride_z;
+
+            int id_x = (px <= denom_x) ? seed_x + stride_x : seed_x;
+            int id_z = (pz >= denom_z) ? seed_z : seed_z - stride_z;
 
-            if (id_z >= aEndZ) {
-                id_z = bottom_point_seed.z;
+            if (id_x >= aEndX) {
+                id_x = seed_x;
             }
-            apPropertyArray[bottom_point.z * aNx + bottom_point.x] = apPropertyArray[id_z * aNx + id_x];
+            apPropertyArray[index] = apPropertyArray[id_z * aNx + id_x];
         }
     }
-
-    seeds.clear();
 }
 
 void RandomExtension::TopLayerExtensionHelper(float *property_array,
@@ -300,4 +218,4 @@ void RandomExtension::TopLayerRemoverHelper(float *property_array,
                                             int aEndX, int aEndY, int aEndZ,
                                             int aNx, int aNy, int aNz, uint aBoundaryLength) {
     // Do nothing, no top layer to remove in random boundaries.
-}
\ No newline at end of file
+}
@@ -32,6 +32,34 @@ using namespace operations::common;
 
 FORWARD_DECLARE_COMPUTE_TEMPLATE(SecondOrderComputationKernel, Compute)
 
+FORWARD_DECLARE_TEMPORAL_BLOCK_TEMPLATE(SecondOrderComputationKernel, ComputeTemporalBlock)
+
+/**
+ * @brief Accumulates the cross correlation of a freshly computed row of the
+ * receiver pressure with the same row of the forward pressure, and the
+ * illuminations when they are given.
+ */
+static inline void correlate_row(const float *apReceiver, const float *apSourceBase,
+                                 float *apCorrelationBase,
+                                 float *apSourceIlluminationBase, float *apReceiverIlluminationBase,
+                                 size_t aOffset, int aLength) {
+    const float *source = apSourceBase + aOffset;
+    float *correlation = apCorrelationBase + aOffset;
+#pragma omp simd
+    for (int ix = 0; ix < aLength; ++ix) {
+        correlation[ix] += source[ix] * apReceiver[ix];
+    }
+    if (apSourceIlluminationBase != nullptr) {
+        float *source_i = apSourceIlluminationBase + aOffset;
+        float *receive_i = apReceiverIlluminationBase + aOffset;
+#pragma omp simd
+        for (int ix = 0; ix < aLength; ++ix) {
+            source_i[ix] += source[ix] * source[ix];
+            receive_i[ix] += apReceiver[ix] * apReceiver[ix];
+        }
+    }
+}
+
 template<KERNEL_MODE KERNEL_MODE_, bool IS_2D_, HALF_LENGTH HALF_LENGTH_>
 void SecondOrderComputationKernel::Compute() {
     /*
@@ -49,15 +77,37 @@ void SecondOrderComputationKernel::Compute() {
     int *vertical_index = mpVerticalIdx->GetNativePointer();
 
     int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     int wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
     int block_x = this->mpParameters->GetBlockX();
+    int block_y = this->mpParameters->GetBlockY();
     int block_z = this->mpParameters->GetBlockZ();
 
     int nx_end = this->mpGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - HALF_LENGTH_;
+    int ny_end = this->mpGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize() - HALF_LENGTH_;
     int nz_end = this->mpGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - HALF_LENGTH_;
 
     int size = (wnx - 2 * HALF_LENGTH_) * (wnz - 2 * HALF_LENGTH_);
+    if constexpr (!IS_2D_) {
+        size *= (wny - 2 * HALF_LENGTH_);
+    }
+
+    /// The boundary layers are updated tile by tile while the tile is still in cache,
+    /// instead of sweeping them again once the step is computed.
+    BoundaryManager *boundary_manager = this->mpBoundaryManager;
+    bool fused = IS_2D_ && boundary_manager != nullptr && boundary_manager->IsFusedInKernel();
+    this->mBoundaryInSweep = fused;
+
+    /// The imaging condition is accumulated row by row while the computed row is still in cache.
+    bool correlate = KERNEL_MODE_ == KERNEL_MODE::ADJOINT && this->mpForwardGridBox != nullptr;
+    float *source_base = nullptr;
+    if (correlate) {
+        source_base = this->mpForwardGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer();
+    }
+    float *corr_base = this->mpCorrelation;
+    float *source_illumination_base = this->mpSourceIllumination;
+    float *receiver_illumination_base = this->mpReceiverIllumination;
 
     /// General note: floating point operations for forward is the same as backward
     /// (calculated below are for forward). number of floating point operations for
@@ -65,6 +115,10 @@ void SecondOrderComputationKernel::Compute() {
     /// half_length 5 floating point operations outside the half_length loop Total
     /// = 6*K+5 =6*K+5
     int flops_per_second = 6 * HALF_LENGTH_ + 5;
+    if constexpr (!IS_2D_) {
+        /// 3 more floating point operations for the y-direction in the half_length loop.
+        flops_per_second += 3 * HALF_LENGTH_;
+    }
 
     ElasticTimer timer("ComputationKernel::Kernel",
                        size, 4, true,
@@ -76,6 +130,64 @@ void SecondOrderComputationKernel::Compute() {
      * Start the computation by creating the threads.
      */
 
+    if constexpr (!IS_2D_) {
+        float *coeff_y = mpCoeffY->GetNativePointer();
+        int *frontal_index = mpFrontalIdx->GetNativePointer();
+        int wnxnz = wnx * wnz;
+
+#pragma omp parallel default(shared)
+        {
+            float *prev, *curr, *next, *vel;
+
+/// Three blocking loops over y, z and x, the y-direction finite difference
+/// reuses the frontal strides precomputed with the coefficients.
+#pragma omp for schedule(static, 1) collapse(3)
+            for (int by = HALF_LENGTH_; by < ny_end; by += block_y) {
+                for (int bz = HALF_LENGTH_; bz < nz_end; bz += block_z) {
+                    for (int bx = HALF_LENGTH_; bx < nx_end; bx += block_x) {
+                        /// Calculate the endings appropriately
+                        /// (Handle remainder of the cache blocking loops).
+                        int ixEnd = min(block_x, nx_end - bx);
+                        int izEnd = min(bz + block_z, nz_end);
+                        int iyEnd = min(by + block_y, ny_end);
+
+                        /// Loop on the elements in the block.
+                        for (int iy = by; iy < iyEnd; ++iy) {
+                            for (int iz = bz; iz < izEnd; ++iz) {
+                                size_t offset = (size_t) iy * wnxnz + iz * wnx + bx;
+
+                                prev = prev_base + offset;
+                                curr = curr_base + offset;
+                                next = next_base + offset;
+
+                                vel = vel_base + offset;
+
+#pragma vector aligned
+#pragma vector vecremainder
+#pragma omp simd
+#pragma ivdep
+                                for (int ix = 0; ix < ixEnd; ++ix) {
+                                    float value = 0;
+                                    value = fma(curr[ix], mCoeffXYZ, value);
+                                    DERIVE_SEQ_AXIS_EQ_OFF(ix, 1, +, curr, coeff_x, value)
+                                    DERIVE_ARRAY_AXIS_EQ_OFF(ix, vertical_index, +, curr, coeff_z, value)
+                                    DERIVE_ARRAY_AXIS_EQ_OFF(ix, frontal_index, +, curr, coeff_y, value)
+                                    next[ix] = (2 * curr[ix]) - prev[ix] + (vel[ix] * value);
+                                }
+                                if (correlate) {
+                                    correlate_row(next, source_base, corr_base, source_illumination_base,
+                                                  receiver_illumination_base, offset, ixEnd);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        timer.Stop();
+        return;
+    }
+
 #pragma omp parallel default(shared)
     {
         float *prev, *curr, *next, *vel;
@@ -127,6 +239,26 @@ void SecondOrderComputationKernel::Compute() {
                         /// 4 floating point operations.
                         next[ix] = (2 * curr[ix]) - prev[ix] + (vel[ix] * value);
                     }
+                    if (correlate) {
+                        correlate_row(next, source_base, corr_base, source_illumination_base,
+                                      receiver_illumination_base, offset, ixEnd);
+                    }
+                }
+                if (fused) {
+                    boundary_manager->UpdateTile(curr_base, bx, bx + ixEnd, bz, izEnd);
+                }
+            }
+        }
+
+        /// The boundary correction needs the derivatives of the auxiliary variables,
+        /// so it waits for all the tiles to be updated (implicit barrier above).
+        if (fused) {
+#pragma omp for schedule(static, 1) collapse(2)
+            for (int bz = HALF_LENGTH_; bz < nz_end; bz += block_z) {
+                for (int bx = HALF_LENGTH_; bx < nx_end; bx += block_x) {
+                    int ixEnd = min(bx + block_x, nx_end);
+                    int izEnd = min(bz + block_z, nz_end);
+                    boundary_manager->ApplyTile(next_base, bx, ixEnd, bz, izEnd);
                 }
             }
         }
@@ -134,8 +266,132 @@ void SecondOrderComputationKernel::Compute() {
     timer.Stop();
 }
 
+template<HALF_LENGTH HALF_LENGTH_>
+void SecondOrderComputationKernel::ComputeTemporalBlock(uint aTimeSteps) {
+    /*
+     * Read parameters into local variables to be shared.
+     */
+
+    FrameBuffer<float> *prev_buffer = this->mpGridBox->Get(WAVE | GB_PRSS | PREV | DIR_Z);
+    FrameBuffer<float> *curr_buffer = this->mpGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z);
+
+    /// Each time step overwrites the time step before the previous one in place,
+    /// so time step k is written into buffers[(k - 1) % 2] reading buffers[k % 2].
+    float *buffers[2] = {prev_buffer->GetNativePointer(), curr_buffer->GetNativePointer()};
+
+    float *vel_base = this->mpGridBox->Get(PARM | WIND | GB_VEL)->GetNativePointer();
+
+    float *coeff_x = mpCoeffX->GetNativePointer();
+    float *coeff_z = mpCoeffZ->GetNativePointer();
+    int *vertical_index = mpVerticalIdx->GetNativePointer();
+
+    int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    int block_x = this->mpParameters->GetBlockX();
+    int block_z = this->mpParameters->GetBlockZ();
+
+    int nx_end = this->mpGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - HALF_LENGTH_;
+    int nz_end = this->mpGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - HALF_LENGTH_;
+
+    int time_steps = aTimeSteps;
+
+    /// A band of time step k can only be computed once time step k - 1 is done on all
+    /// the bands it reads from, and before time step k + 1 overwrites them. Lagging each
+    /// time step enough bands behind the previous one keeps the bands processed in the
+    /// same front independent.
+    int bands = (nz_end - HALF_LENGTH_ + block_z - 1) / block_z;
+    int lag = 1 + (HALF_LENGTH_ + block_z - 1) / block_z;
+    int fronts = bands + (time_steps - 1) * lag;
+
+    int size = (wnx - 2 * HALF_LENGTH_) * (wnz - 2 * HALF_LENGTH_);
+
+    int flops_per_second = 6 * HALF_LENGTH_ + 5;
+
+    ElasticTimer timer("ComputationKernel::TemporalBlock",
+                       size * aTimeSteps, 3, true,
+                       flops_per_second);
+    timer.Start();
+
+#pragma omp parallel default(shared)
+    {
+        float *prev, *curr, *next, *vel;
+
+        for (int front = 0; front < fronts; ++front) {
+/// Time steps of the same front are independent, the implicit
+/// barrier separates the fronts.
+#pragma omp for schedule(static, 1) collapse(2)
+            for (int step = 1; step <= time_steps; ++step) {
+                for (int bx = HALF_LENGTH_; bx < nx_end; bx += block_x) {
+                    int band = front - (step - 1) * lag;
+                    if (band < 0 || band >= bands) {
+                        continue;
+                    }
+                    int bz = HALF_LENGTH_ + band * block_z;
+                    int ixEnd = min(block_x, nx_end - bx);
+                    int izEnd = min(bz + block_z, nz_end);
+
+                    float *next_base = buffers[(step - 1) & 1];
+                    float *curr_base = buffers[step & 1];
+
+                    for (int iz = bz; iz < izEnd; ++iz) {
+                        int offset = iz * wnx + bx;
+
+                        // The previous time step is read from where the next is written.
+                        prev = next_base + offset;
+                        curr = curr_base + offset;
+                        next = next_base + offset;
+
+                        vel = vel_base + offset;
+
+#pragma vector aligned
+#pragma vector vecremainder
+#pragma omp simd
+#pragma ivdep
+                        for (int ix = 0; ix < ixEnd; ++ix) {
+                            float value = 0;
+                            value = fma(curr[ix], mCoeffXYZ, value);
+                            DERIVE_SEQ_AXIS_EQ_OFF(ix, 1, +, curr, coeff_x, value)
+                            DERIVE_ARRAY_AXIS_EQ_OFF(ix, vertical_index, +, curr, coeff_z, value)
+                            next[ix] = (2 * curr[ix]) - prev[ix] + (vel[ix] * value);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    timer.Stop();
+
+    /*
+     * The last time step is in buffers[(aTimeSteps - 1) % 2], and the one
+     * before it in the other buffer, so the pointers only move for odd counts.
+     */
+
+    bool two_pointers = this->mpGridBox->Get(WAVE | GB_PRSS | PREV | DIR_Z) ==
+                        this->mpGridBox->Get(WAVE | GB_PRSS | NEXT | DIR_Z);
+    if (aTimeSteps % 2 == 1) {
+        this->mpGridBox->Swap(WAVE | GB_PRSS | PREV | DIR_Z, WAVE | GB_PRSS | CURR | DIR_Z);
+    }
+    if (two_pointers) {
+        this->mpGridBox->Set(WAVE | GB_PRSS | NEXT | DIR_Z,
+                             this->mpGridBox->Get(WAVE | GB_PRSS | PREV | DIR_Z));
+    }
+}
+
+bool SecondOrderComputationKernel::FuseCorrelation(GridBox *apForwardGridBox,
+                                                   float *apCorrelation,
+                                                   float *apSourceIllumination,
+                                                   float *apReceiverIllumination) {
+    this->mpForwardGridBox = apForwardGridBox;
+    this->mpCorrelation = apCorrelation;
+    this->mpSourceIllumination = apSourceIllumination;
+    this->mpReceiverIllumination = apReceiverIllumination;
+    return true;
+}
+
 void SecondOrderComputationKernel::PreprocessModel() {
     int nx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
+    int ny = this->mpGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
     int nz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
 
     float dt = this->mpGridBox->GetDT();
@@ -144,16 +400,19 @@ void SecondOrderComputationKernel::PreprocessModel() {
     float *velocity_values = this->mpGridBox->Get(PARM | GB_VEL)->GetNativePointer();
 
     int full_nx = nx;
+    size_t full_nx_nz = (size_t) nx * nz;
     /// Preprocess the velocity model by calculating the
     /// dt2 * c2 component of the wave equation.
 #pragma omp parallel default(shared)
     {
-#pragma omp for schedule(static) collapse(2)
-        for (int z = 0; z < nz; ++z) {
-            for (int x = 0; x < nx; ++x) {
-                float value = velocity_values[z * full_nx + x];
-                velocity_values[z * full_nx + x] =
-                        value * value * dt2;
+#pragma omp for schedule(static) collapse(3)
+        for (int y = 0; y < ny; ++y) {
+            for (int z = 0; z < nz; ++z) {
+                for (int x = 0; x < nx; ++x) {
+                    size_t offset = y * full_nx_nz + z * full_nx + x;
+                    float value = velocity_values[offset];
+                    velocity_values[offset] = value * value * dt2;
+                }
             }
         }
     }
@@ -19,6 +19,8 @@
 
 #include <cmath>
 
+#include <omp.h>
+
 #include <bs/timer/api/cpp/BSTimer.hpp>
 
 #include <operations/components/independents/concrete/computation-kernels/isotropic/StaggeredComputationKernel.hpp>
@@ -35,72 +37,81 @@ FORWARD_DECLARE_COMPUTE_TEMPLATE(StaggeredComputationKernel, ComputePressure)
 
 FORWARD_DECLARE_COMPUTE_TEMPLATE(StaggeredComputationKernel, ComputeVelocity)
 
+FORWARD_DECLARE_COMPUTE_TEMPLATE(StaggeredComputationKernel, ComputeFused)
+
 template<KERNEL_MODE KERNEL_MODE_, bool IS_2D_, HALF_LENGTH HALF_LENGTH_>
 void StaggeredComputationKernel::ComputeVelocity() {
     /*
      * Read parameters into local variables to be shared.
      */
     float *curr_base = this->mpGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer();
-    float *next_base = this->mpGridBox->Get(WAVE | GB_PRSS | NEXT | DIR_Z)->GetNativePointer();
 
     float *particle_vel_x = this->mpGridBox->Get(WAVE | GB_PRTC | CURR | DIR_X)->GetNativePointer();
     float *particle_vel_z = this->mpGridBox->Get(WAVE | GB_PRTC | CURR | DIR_Z)->GetNativePointer();
+    float *particle_vel_y = nullptr;
+    if constexpr (!IS_2D_) {
+        particle_vel_y = this->mpGridBox->Get(WAVE | GB_PRTC | CURR | DIR_Y)->GetNativePointer();
+    }
 
-    float *vel_base = this->mpGridBox->Get(PARM | WIND | GB_VEL)->GetNativePointer();
     float *den_base = this->mpGridBox->Get(PARM | WIND | GB_DEN)->GetNativePointer();
 
     int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     int wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+    int wnxnz = wnx * wnz;
 
     float dx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetCellDimension();
+    float dy = this->mpGridBox->GetAfterSamplingAxis()->GetYAxis().GetCellDimension();
     float dz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetCellDimension();
 
-    float dt = this->mpGridBox->GetDT();
     float *coefficients = this->mpParameters->GetFirstDerivativeStaggeredFDCoefficient();
 
     int block_x = this->mpParameters->GetBlockX();
+    int block_y = this->mpParameters->GetBlockY();
     int block_z = this->mpParameters->GetBlockZ();
 
     int nx_end = this->mpGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - HALF_LENGTH_;
     int nz_end = this->mpGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - HALF_LENGTH_;
 
-    int nx = wnx;
-    int nz = wnz;
+    int y_start = 0;
+    int ny_end = 1;
     int size = (wnx - 2 * HALF_LENGTH_) * (wnz - 2 * HALF_LENGTH_);
-
-    /// General note: floating point operations for forward is the same as backward
-    /// (calculated below are for forward). number of floating point operations for
-    /// the pressure kernel in 2D for the half_length loop:6*k -2(for adding zeros)
-    /// =6*K-2 where K is the half_length 5 floating point operations outside the
-    /// half_length loop Total = 6*K-2+5 =6*K+3
-    int flops_per_pressure = 6 * HALF_LENGTH_ + 3;
-
-    // vel,curr,next,vel_x,vel_z
-    int num_of_arrays_pressure = 5;
+    if constexpr (!IS_2D_) {
+        y_start = HALF_LENGTH_;
+        ny_end = this->mpGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize() - HALF_LENGTH_;
+        size *= (wny - 2 * HALF_LENGTH_);
+    }
 
     /// General note: floating point operations for forward is the same as backward
     /// (calculated below are for forward). number of floating point operations for
     /// the velocity kernel in 2D for the half_length loop:6*k -2(for adding zeros)
-    /// =6*K-2 where K is the half_length 6 floating point operations outside the
-    /// half_length loop Total = 6*K-2+6 =6*K+4
-    int flops_per_velocity = 6 * HALF_LENGTH_ + 4;
+    /// =6*K-2 where K is the half_length 4 floating point operations outside the
+    /// half_length loop Total = 6*K-2+4 =6*K+2
+    int flops_per_velocity = 6 * HALF_LENGTH_ + 2;
 
     // curr,den,vel_x(load),vel_x(store),vel_z(load),vel_z(store)
     int num_of_arrays_velocity = 6;
 
+    if constexpr (!IS_2D_) {
+        /// The y-direction adds 3*K-1 in the half_length loop and 2 outside it.
+        flops_per_velocity += 3 * HALF_LENGTH_ + 1;
+        // vel_y(load),vel_y(store)
+        num_of_arrays_velocity += 2;
+    }
+
     /*
-     * Pre-compute the coefficients for each direction.
+     * Pre-compute the coefficients for each direction, scaled by the
+     * cell dimension so the sweep needs no division.
      */
 
     float coefficients_x[HALF_LENGTH_];
+    float coefficients_y[HALF_LENGTH_];
     float coefficients_z[HALF_LENGTH_];
 
-    int vertical[HALF_LENGTH_];
-
     for (int i = 0; i < HALF_LENGTH_; i++) {
-        coefficients_x[i] = coefficients[i + 1];
-        coefficients_z[i] = coefficients[i + 1];
-        vertical[i] = (i + 1) * wnx;
+        coefficients_x[i] = coefficients[i + 1] / dx;
+        coefficients_y[i] = coefficients[i + 1] / dy;
+        coefficients_z[i] = coefficients[i + 1] / dz;
     }
 
     // start the timers for the velocity kernel.
@@ -114,52 +125,68 @@ void StaggeredComputationKernel::ComputeVelocity() {
 // Start the computation by creating the threads.
 #pragma omp parallel default(shared)
     {
-        float *prev, *next, *den, *vel, *vel_x, *vel_z;
+        float *prev, *den, *vel_x, *vel_y, *vel_z;
 
 /// Three loops for cache blocking.
 /// Utilizing the cache to the maximum to speed up computation.
-#pragma omp for schedule(static, 1) collapse(1)
-        for (int bz = HALF_LENGTH_; bz < nz_end; bz += block_z) {
-            for (int bx = HALF_LENGTH_; bx < nx_end; bx += block_x) {
-                /// Calculate the endings appropriately
-                /// (Handle remainder of the cache blocking loops).
-                int ixEnd = min(block_x, nx_end - bx);
-                int izEnd = min(bz + block_z, nz_end);
-
-                /// Loop on the elements in the block.
-                for (int iz = bz; iz < izEnd; ++iz) {
-
-                    // Pre-compute in advance the pointer to the start of the current
-                    // start point of the processing.
-                    int offset = iz * wnx + bx;
-
-                    prev = curr_base + offset;
-                    den = den_base + offset;
-                    vel = vel_base + offset;
-
-                    vel_x = particle_vel_x + offset;
-                    vel_z = particle_vel_z + offset;
+#pragma omp for schedule(static, 1) collapse(3)
+        for (int by = y_start; by < ny_end; by += block_y) {
+            for (int bz = HALF_LENGTH_; bz < nz_end; bz += block_z) {
+                for (int bx = HALF_LENGTH_; bx < nx_end; bx += block_x) {
+                    /// Calculate the endings appropriately
+                    /// (Handle remainder of the cache blocking loops).
+                    int ixEnd = min(block_x, nx_end - bx);
+                    int izEnd = min(bz + block_z, nz_end);
+                    int iyEnd = min(by + block_y, ny_end);
+
+                    /// Loop on the elements in the block.
+                    for (int iy = by; iy < iyEnd; ++iy) {
+                        for (int iz = bz; iz < izEnd; ++iz) {
+
+                            // Pre-compute in advance the pointer to the start of the current
+                            // start point of the processing.
+                            size_t offset = (size_t) iy * wnxnz + iz * wnx + bx;
+
+                            prev = curr_base + offset;
+                            den = den_base + offset;
+
+                            vel_x = particle_vel_x + offset;
+                            vel_z = particle_vel_z + offset;
+                            if constexpr (!IS_2D_) {
+                                vel_y = particle_vel_y + offset;
+                            }
 
 #pragma vector aligned
 #pragma vector vecremainder
 #pragma omp simd
 #pragma ivdep
-                    for (int ix = 0; ix < ixEnd; ++ix) {
-                        float value_x = 0;
-                        float value_z = 0;
-
-                        DERIVE_SEQ_AXIS(ix, 1, 0, -, prev, coefficients_x, value_x)
-                        DERIVE_JUMP_AXIS(ix, wnx, 1, 0, -, prev, coefficients_z, value_z)
-
-                        if constexpr (KERNEL_MODE_ != KERNEL_MODE::INVERSE) {
-                            // 3 floating point operations
-                            vel_x[ix] = vel_x[ix] - (den[ix] / dx) * value_x;
-                            // 3 floating point operations
-                            vel_z[ix] = vel_z[ix] - (den[ix] / dz) * value_z;
-                        } else {
-                            vel_x[ix] = vel_x[ix] + (den[ix] / dx) * value_x;
-
-                            vel_z[ix] = vel_z[ix] + (den[ix] / dz) * value_z;
+                            for (int ix = 0; ix < ixEnd; ++ix) {
+                                float value_x = 0;
+                                float value_z = 0;
+
+                                DERIVE_SEQ_AXIS(ix, 1, 0, -, prev, coefficients_x, value_x)
+                                DERIVE_JUMP_AXIS(ix, wnx, 1, 0, -, prev, coefficients_z, value_z)
+
+                                if constexpr (KERNEL_MODE_ != KERNEL_MODE::INVERSE) {
+                                    // 2 floating point operations
+                                    vel_x[ix] = vel_x[ix] - den[ix] * value_x;
+                                    // 2 floating point operations
+                                    vel_z[ix] = vel_z[ix] - den[ix] * value_z;
+                                } else {
+                                    vel_x[ix] = vel_x[ix] + den[ix] * value_x;
+
+                                    vel_z[ix] = vel_z[ix] + den[ix] * value_z;
+                                }
+                                if constexpr (!IS_2D_) {
+                                    float value_y = 0;
+                                    DERIVE_JUMP_AXIS(ix, wnxnz, 1, 0, -, prev, coefficients_y, value_y)
+                                    if constexpr (KERNEL_MODE_ != KERNEL_MODE::INVERSE) {
+                                        vel_y[ix] = vel_y[ix] - den[ix] * value_y;
+                                    } else {
+                                        vel_y[ix] = vel_y[ix] + den[ix] * value_y;
+                                    }
+                                }
+                            }
                         }
                     }
                 }
@@ -182,51 +209,70 @@ void StaggeredComputationKernel::ComputePressure() {
 
     float *particle_vel_x = this->mpGridBox->Get(WAVE | GB_PRTC | CURR | DIR_X)->GetNativePointer();
     float *particle_vel_z = this->mpGridBox->Get(WAVE | GB_PRTC | CURR | DIR_Z)->GetNativePointer();
+    float *particle_vel_y = nullptr;
+    if constexpr (!IS_2D_) {
+        particle_vel_y = this->mpGridBox->Get(WAVE | GB_PRTC | CURR | DIR_Y)->GetNativePointer();
+    }
 
     float *vel_base = this->mpGridBox->Get(PARM | WIND | GB_VEL)->GetNativePointer();
-    float *den_base = this->mpGridBox->Get(PARM | WIND | GB_DEN)->GetNativePointer();
 
     int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     int wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+    int wnxnz = wnx * wnz;
 
     float dx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetCellDimension();
+    float dy = this->mpGridBox->GetAfterSamplingAxis()->GetYAxis().GetCellDimension();
     float dz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetCellDimension();
 
-    float dt = this->mpGridBox->GetDT();
     float *coefficients = this->mpParameters->GetFirstDerivativeStaggeredFDCoefficient();
 
     int block_x = this->mpParameters->GetBlockX();
+    int block_y = this->mpParameters->GetBlockY();
     int block_z = this->mpParameters->GetBlockZ();
 
     int nx_end = this->mpGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - HALF_LENGTH_;
     int nz_end = this->mpGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - HALF_LENGTH_;
 
-    int nx = wnx;
-    int nz = wnz;
+    int y_start = 0;
+    int ny_end = 1;
     int size = (wnx - 2 * HALF_LENGTH_) * (wnz - 2 * HALF_LENGTH_);
+    if constexpr (!IS_2D_) {
+        y_start = HALF_LENGTH_;
+        ny_end = this->mpGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize() - HALF_LENGTH_;
+        size *= (wny - 2 * HALF_LENGTH_);
+    }
 
     /// General note: floating point operations for forward is the same as backward
     /// (calculated below are for forward). number of floating point operations for
     /// the pressure kernel in 2D for the half_length loop:6*k -2(for adding zeros)
-    /// =6*K-2 where K is the half_length 5 floating point operations outside the
-    /// half_length loop Total = 6*K-2+5 =6*K+3
-    int flops_per_pressure = 6 * HALF_LENGTH_ + 3;
+    /// =6*K-2 where K is the half_length 3 floating point operations outside the
+    /// half_length loop Total = 6*K-2+3 =6*K+1
+    int flops_per_pressure = 6 * HALF_LENGTH_ + 1;
 
     // vel,curr,next,vel_x,vel_z
     int num_of_arrays_pressure = 5;
 
+    if constexpr (!IS_2D_) {
+        /// The y-direction adds 3*K-1 in the half_length loop and 1 outside it.
+        flops_per_pressure += 3 * HALF_LENGTH_;
+        // vel_y
+        num_of_arrays_pressure += 1;
+    }
+
     /*
-     * Pre-compute the coefficients for each direction.
+     * Pre-compute the coefficients for each direction, scaled by the
+     * cell dimension so the sweep needs no division.
      */
 
     float coefficients_x[HALF_LENGTH_];
+    float coefficients_y[HALF_LENGTH_];
     float coefficients_z[HALF_LENGTH_];
 
-    int vertical[HALF_LENGTH_];
     for (int i = 0; i < HALF_LENGTH_; i++) {
-        coefficients_x[i] = coefficients[i + 1];
-        coefficients_z[i] = coefficients[i + 1];
-        vertical[i] = (i + 1) * wnx;
+        coefficients_x[i] = coefficients[i + 1] / dx;
+        coefficients_y[i] = coefficients[i + 1] / dy;
+        coefficients_z[i] = coefficients[i + 1] / dz;
     }
 
     // start the timers for the velocity kernel.
@@ -239,78 +285,263 @@ void StaggeredComputationKernel::ComputePressure() {
     timer.Start();
 #pragma omp parallel default(shared)
     {
-        float *curr, *next, *den, *vel, *vel_x, *vel_z;
+        float *curr, *next, *vel, *vel_x, *vel_y, *vel_z;
         // Pressure Calculation
-#pragma omp for schedule(static, 1) collapse(2)
-        for (int bz = HALF_LENGTH_; bz < nz_end; bz += block_z) {
+#pragma omp for schedule(static, 1) collapse(3)
+        for (int by = y_start; by < ny_end; by += block_y) {
+            for (int bz = HALF_LENGTH_; bz < nz_end; bz += block_z) {
+                for (int bx = HALF_LENGTH_; bx < nx_end; bx += block_x) {
+                    // Calculate the endings appropriately (Handle remainder of the cache
+                    // blocking loops).
+                    int ixEnd = min(block_x, nx_end - bx);
+                    int izEnd = min(bz + block_z, nz_end);
+                    int iyEnd = min(by + block_y, ny_end);
+                    // Loop on the elements in the block.
+                    for (int iy = by; iy < iyEnd; ++iy) {
+                        for (int iz = bz; iz < izEnd; ++iz) {
+                            // Pre-compute in advance the pointer to the start of the current
+                            // start point of the processing.
+                            size_t offset = (size_t) iy * wnxnz + iz * wnx + bx;
+                            curr = curr_base + offset;
+                            next = next_base + offset;
+                            vel = vel_base + offset;
+
+                            vel_x = particle_vel_x + offset;
+                            vel_z = particle_vel_z + offset;
+                            if constexpr (!IS_2D_) {
+                                vel_y = particle_vel_y + offset;
+                            }
+#pragma vector aligned
+#pragma vector vecremainder
+#pragma omp simd
+#pragma ivdep
+                            for (int ix = 0; ix < ixEnd; ++ix) {
+                                float value_x = 0;
+                                float value_z = 0;
+
+                                DERIVE_SEQ_AXIS(ix, 0, 1, -, vel_x, coefficients_x, value_x)
+                                DERIVE_JUMP_AXIS(ix, wnx, 0, 1, -, vel_z, coefficients_z, value_z)
+
+                                float divergence = value_x + value_z;
+                                if constexpr (!IS_2D_) {
+                                    float value_y = 0;
+                                    DERIVE_JUMP_AXIS(ix, wnxnz, 0, 1, -, vel_y, coefficients_y, value_y)
+                                    divergence += value_y;
+                                }
+
+                                if constexpr (KERNEL_MODE_ != KERNEL_MODE::INVERSE) {
+                                    // 5 floating point operations
+                                    next[ix] = curr[ix] - vel[ix] * divergence;
+                                } else {
+                                    next[ix] = curr[ix] + vel[ix] * divergence;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    timer.Stop();
+}
+
+template<KERNEL_MODE KERNEL_MODE_, bool IS_2D_, HALF_LENGTH HALF_LENGTH_>
+void StaggeredComputationKernel::ComputeFused() {
+    if constexpr (!IS_2D_) {
+        this->ComputeVelocity<KERNEL_MODE_, IS_2D_, HALF_LENGTH_>();
+        this->ComputePressure<KERNEL_MODE_, IS_2D_, HALF_LENGTH_>();
+        return;
+    }
+
+    /*
+     * Read parameters into local variables to be shared.
+     */
+
+    float *curr_base = this->mpGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer();
+    float *next_base = this->mpGridBox->Get(WAVE | GB_PRSS | NEXT | DIR_Z)->GetNativePointer();
+
+    float *particle_vel_x = this->mpGridBox->Get(WAVE | GB_PRTC | CURR | DIR_X)->GetNativePointer();
+    float *particle_vel_z = this->mpGridBox->Get(WAVE | GB_PRTC | CURR | DIR_Z)->GetNativePointer();
+
+    float *den_base = this->mpGridBox->Get(PARM | WIND | GB_DEN)->GetNativePointer();
+    float *vel_base = this->mpGridBox->Get(PARM | WIND | GB_VEL)->GetNativePointer();
+
+    int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    float dx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetCellDimension();
+    float dz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetCellDimension();
+
+    float *coefficients = this->mpParameters->GetFirstDerivativeStaggeredFDCoefficient();
+
+    int block_x = this->mpParameters->GetBlockX();
+    int block_z = this->mpParameters->GetBlockZ();
+
+    int nx_end = this->mpGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - HALF_LENGTH_;
+    int nz_end = this->mpGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - HALF_LENGTH_;
+
+    int size = (wnx - 2 * HALF_LENGTH_) * (wnz - 2 * HALF_LENGTH_);
+
+    /// Sum of the velocity and pressure kernels floating point operations.
+    int flops_per_cell = 12 * HALF_LENGTH_ + 3;
+
+    // curr,den,vel_x(load),vel_x(store),vel_z(load),vel_z(store),vel,next
+    int num_of_arrays = 8;
+
+    float coefficients_x[HALF_LENGTH_];
+    float coefficients_z[HALF_LENGTH_];
+
+    for (int i = 0; i < HALF_LENGTH_; i++) {
+        coefficients_x[i] = coefficients[i + 1] / dx;
+        coefficients_z[i] = coefficients[i + 1] / dz;
+    }
+
+    /// The rows are split into one chunk per thread. Inside a chunk, the pressure
+    /// of a row is computed as soon as the particle velocities of the rows it reads
+    /// are, lagging the velocity sweep by half a stencil, so they are still in cache.
+    /// The rows reading velocities of a neighbouring chunk are left to a second pass.
+    int rows = nz_end - HALF_LENGTH_;
+    int chunks = max(1, min(omp_get_max_threads(), rows / (2 * HALF_LENGTH_)));
+    int chunk_rows = (rows + chunks - 1) / chunks;
+
+    auto velocity_rows = [&](int aStartZ, int aEndZ) {
+        for (int iz = aStartZ; iz < aEndZ; ++iz) {
             for (int bx = HALF_LENGTH_; bx < nx_end; bx += block_x) {
-                // Calculate the endings appropriately (Handle remainder of the cache
-                // blocking loops).
                 int ixEnd = min(block_x, nx_end - bx);
-                int izEnd = min(bz + block_z, nz_end);
-                // Loop on the elements in the block.
-                for (int iz = bz; iz < izEnd; ++iz) {
-                    // Pre-compute in advance the pointer to the start of the current
-                    // start point of the processing.
-                    int offset = iz * wnx + bx;
-                    curr = curr_base + offset;
-                    next = next_base + offset;
-                    den = den_base + offset;
-                    vel = vel_base + offset;
-
-                    vel_x = particle_vel_x + offset;
-                    vel_z = particle_vel_z + offset;
+                int offset = iz * wnx + bx;
+
+                float *prev = curr_base + offset;
+                float *den = den_base + offset;
+                float *vel_x = particle_vel_x + offset;
+                float *vel_z = particle_vel_z + offset;
+
 #pragma vector aligned
 #pragma vector vecremainder
 #pragma omp simd
 #pragma ivdep
-                    for (int ix = 0; ix < ixEnd; ++ix) {
-                        float value_x = 0;
-                        float value_z = 0;
-
-                        DERIVE_SEQ_AXIS(ix, 0, 1, -, vel_x, coefficients_x, value_x)
-                        DERIVE_JUMP_AXIS(ix, nx, 0, 1, -, vel_z, coefficients_z, value_z)
-
-                        if constexpr (KERNEL_MODE_ != KERNEL_MODE::INVERSE) {
-                            // 5 floating point operations
-                            next[ix] =
-                                    curr[ix] - vel[ix] * ((value_x / dx) + (value_z / dz));
-                        } else {
-                            next[ix] =
-                                    curr[ix] + vel[ix] * ((value_x / dx) + (value_z / dz));
-                        }
+                for (int ix = 0; ix < ixEnd; ++ix) {
+                    float value_x = 0;
+                    float value_z = 0;
+
+                    DERIVE_SEQ_AXIS(ix, 1, 0, -, prev, coefficients_x, value_x)
+                    DERIVE_JUMP_AXIS(ix, wnx, 1, 0, -, prev, coefficients_z, value_z)
+
+                    if constexpr (KERNEL_MODE_ != KERNEL_MODE::INVERSE) {
+                        vel_x[ix] = vel_x[ix] - den[ix] * value_x;
+                        vel_z[ix] = vel_z[ix] - den[ix] * value_z;
+                    } else {
+                        vel_x[ix] = vel_x[ix] + den[ix] * value_x;
+                        vel_z[ix] = vel_z[ix] + den[ix] * value_z;
                     }
                 }
             }
         }
+    };
+
+    auto pressure_rows = [&](int aStartZ, int aEndZ) {
+        for (int iz = aStartZ; iz < aEndZ; ++iz) {
+            for (int bx = HALF_LENGTH_; bx < nx_end; bx += block_x) {
+                int ixEnd = min(block_x, nx_end - bx);
+                int offset = iz * wnx + bx;
+
+                float *curr = curr_base + offset;
+                float *next = next_base + offset;
+                float *vel = vel_base + offset;
+                float *vel_x = particle_vel_x + offset;
+                float *vel_z = particle_vel_z + offset;
+
+#pragma vector aligned
+#pragma vector vecremainder
+#pragma omp simd
+#pragma ivdep
+                for (int ix = 0; ix < ixEnd; ++ix) {
+                    float value_x = 0;
+                    float value_z = 0;
+
+                    DERIVE_SEQ_AXIS(ix, 0, 1, -, vel_x, coefficients_x, value_x)
+                    DERIVE_JUMP_AXIS(ix, wnx, 0, 1, -, vel_z, coefficients_z, value_z)
+
+                    if constexpr (KERNEL_MODE_ != KERNEL_MODE::INVERSE) {
+                        next[ix] = curr[ix] - vel[ix] * (value_x + value_z);
+                    } else {
+                        next[ix] = curr[ix] + vel[ix] * (value_x + value_z);
+                    }
+                }
+            }
+        }
+    };
+
+    ElasticTimer timer("ComputationKernel::ComputeFused",
+                       size,
+                       num_of_arrays,
+                       true,
+                       flops_per_cell);
+    timer.Start();
+
+#pragma omp parallel default(shared)
+    {
+#pragma omp for schedule(static, 1)
+        for (int chunk = 0; chunk < chunks; ++chunk) {
+            int chunk_start = HALF_LENGTH_ + chunk * chunk_rows;
+            int chunk_end = min(chunk_start + chunk_rows, nz_end);
+            /// Pressure rows only reading velocities of this chunk.
+            int inner_start = chunk_start == HALF_LENGTH_ ? chunk_start : chunk_start + HALF_LENGTH_;
+            int inner_end = chunk_end == nz_end ? chunk_end : chunk_end - HALF_LENGTH_ + 1;
+            int done = inner_start;
+            for (int bz = chunk_start; bz < chunk_end; bz += block_z) {
+                int izEnd = min(bz + block_z, chunk_end);
+                velocity_rows(bz, izEnd);
+                int ready = izEnd == nz_end ? izEnd : izEnd - HALF_LENGTH_ + 1;
+                ready = min(ready, inner_end);
+                if (ready > done) {
+                    pressure_rows(done, ready);
+                    done = ready;
+                }
+            }
+        }
+
+/// All the velocities are updated past the implicit barrier.
+#pragma omp for schedule(static, 1)
+        for (int chunk = 0; chunk < chunks; ++chunk) {
+            int chunk_start = HALF_LENGTH_ + chunk * chunk_rows;
+            int chunk_end = min(chunk_start + chunk_rows, nz_end);
+            int inner_start = chunk_start == HALF_LENGTH_ ? chunk_start : chunk_start + HALF_LENGTH_;
+            int inner_end = chunk_end == nz_end ? chunk_end : chunk_end - HALF_LENGTH_ + 1;
+            inner_start = min(inner_start, chunk_end);
+            pressure_rows(chunk_start, inner_start);
+            pressure_rows(max(inner_end, inner_start), chunk_end);
+        }
     }
     timer.Stop();
 }
 
 void StaggeredComputationKernel::PreprocessModel() {
     int nx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
+    int ny = this->mpGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
     int nz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
 
     float dt = this->mpGridBox->GetDT();
-    float dt2 = dt * dt;
 
     float *velocity_values = this->mpGridBox->Get(PARM | GB_VEL)->GetNativePointer();
 
     int full_nx = nx;
+    size_t full_nx_nz = (size_t) nx * nz;
     float *density_values = this->mpGridBox->Get(PARM | GB_DEN)->GetNativePointer();
     /// Preprocess the velocity model by calculating the
     /// dt * c2 * density component of the wave equation.
 #pragma omp parallel default(shared)
     {
-#pragma omp for schedule(static) collapse(2)
-        for (int z = 0; z < nz; ++z) {
-            for (int x = 0; x < nx; ++x) {
-                float value = velocity_values[z * full_nx + x];
-                int offset = z * full_nx + x;
-                velocity_values[offset] =
-                        value * value * dt * density_values[offset];
-                if (density_values[offset] != 0) {
-                    density_values[offset] = dt / density_values[offset];
+#pragma omp for schedule(static) collapse(3)
+        for (int y = 0; y < ny; ++y) {
+            for (int z = 0; z < nz; ++z) {
+                for (int x = 0; x < nx; ++x) {
+                    size_t offset = y * full_nx_nz + z * full_nx + x;
+                    float value = velocity_values[offset];
+                    velocity_values[offset] =
+                            value * value * dt * density_values[offset];
+                    if (density_values[offset] != 0) {
+                        density_values[offset] = dt / density_values[offset];
+                    }
                 }
             }
         }
@@ -17,6 +17,7 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <atomic>
 #include <cstring>
 
 #include <bs/base/memory/MemoryManager.hpp>
@@ -36,7 +37,12 @@ class operations::dataunits::FrameBuffer<int>;
 template
 class operations::dataunits::FrameBuffer<uint>;
 
-static uint MASK_ALLOC_FACTOR = 0;
+template
+class operations::dataunits::FrameBuffer<size_t>;
+
+/// Offset of the next allocation, shifting each buffer to a different cache line.
+/// Frame buffers may be allocated from several threads.
+static std::atomic<uint> MASK_ALLOC_FACTOR(0);
 
 template<typename T>
 FrameBuffer<T>::FrameBuffer() {
@@ -46,7 +52,7 @@ FrameBuffer<T>::FrameBuffer() {
 }
 
 template<typename T>
-FrameBuffer<T>::FrameBuffer(uint aSize) {
+FrameBuffer<T>::FrameBuffer(size_t aSize) {
     this->Allocate(aSize);
     this->mpHostDataPointer = nullptr;
 }
@@ -57,20 +63,19 @@ FrameBuffer<T>::~FrameBuffer() {
 }
 
 template<typename T>
-void FrameBuffer<T>::Allocate(uint aSize, const std::string &aName) {
+void FrameBuffer<T>::Allocate(size_t aSize, const std::string &aName) {
     this->mAllocatedBytes = sizeof(T) * aSize;
     this->mpDataPointer = (T *) mem_allocate(sizeof(T), aSize, aName);
 }
 
 template<typename T>
-void FrameBuffer<T>::Allocate(uint aSize, HALF_LENGTH aHalfLength, const std::string &aName) {
+void FrameBuffer<T>::Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName) {
     this->mAllocatedBytes = sizeof(T) * (aSize + 16);
     this->mpDataPointer = (T *) mem_allocate(sizeof(T),
                                              aSize,
                                              aName,
                                              aHalfLength,
-                                             MASK_ALLOC_FACTOR);
-    MASK_ALLOC_FACTOR += 16;
+                                             MASK_ALLOC_FACTOR.fetch_add(16));
 }
 
 template<typename T>
@@ -109,10 +114,10 @@ void FrameBuffer<T>::ReflectOnNative() {
     /* For omp native is the same as host, so no need to reflect. */
 }
 
-void Device::MemSet(void *apDst, int aVal, uint aSize) {
+void Device::MemSet(void *apDst, int aVal, size_t aSize) {
     memset(apDst, aVal, aSize);
 }
 
-void Device::MemCpy(void *apDst, const void *apSrc, uint aSize, CopyDirection aCopyDirection) {
+void Device::MemCpy(void *apDst, const void *apSrc, size_t aSize, CopyDirection aCopyDirection) {
     memcpy(apDst, apSrc, aSize);
 }
@@ -17,6 +17,8 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstring>
+
 #include <operations/components/independents/concrete/forward-collectors/boundary-saver/BoundarySaver.h>
 
 
@@ -24,150 +26,125 @@ using namespace operations::components::helpers;
 using namespace operations::common;
 using namespace operations::dataunits;
 
-void BoundarySaver::SaveBoundaries(uint aStep) {
-    uint index = 0;
-    uint size_of_boundaries = this->mBoundarySize;
-    uint time_step = aStep;
-    uint half_length = this->mpComputationParameters->GetHalfLength();
-    uint bound_length = this->mpComputationParameters->GetBoundaryLength();
-    uint offset = half_length + bound_length;
-
-    uint start_y = 0;
-    uint end_y = 1;
-
-    uint ny = this->mpMainGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
-
-    uint wnx = this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
-    uint wny = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
-    uint wnz = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
-    uint lnx = this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize();
-    uint lny = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize();
-    uint lnz = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize();
-
-    uint start_z = offset;
-    uint end_z = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - offset;
-    uint start_x = offset;
-    uint end_x = this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - offset;
-
-    uint wnznx = wnx * wnz;
+/**
+ * @brief
+ * Copies a contiguous run between the wave field and the saved boundaries.
+ */
+static inline void
+copy_run(float *apWaveField, float *apSaved, size_t aLength, bool aIsSave) {
+    if (aIsSave) {
+        memcpy(apSaved, apWaveField, aLength * sizeof(float));
+    } else {
+        memcpy(apWaveField, apSaved, aLength * sizeof(float));
+    }
+}
 
+/**
+ * @brief
+ * Copies the half length strips inside the boundaries of the wave field from/to
+ * a single time step of saved boundaries. Every strip row is kept as a contiguous
+ * run at a position known from its indices, so the rows are copied in parallel.
+ *
+ * Saved layout:
+ * - The left then right runs of each (y, z) row.
+ * - The top then bottom runs of each (y, z) row of the z strips.
+ * - The front then back runs of each (y, z) row of the y strips (3D only).
+ */
+static void
+copy_boundaries(float *apWaveField, float *apBoundaries,
+                GridBox *apGridBox, ComputationParameters *apParameters, bool aIsSave) {
+    int half_length = apParameters->GetHalfLength();
+    int bound_length = apParameters->GetBoundaryLength();
+    int offset = half_length + bound_length;
+
+    int ny = apGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
+
+    int wnx = apGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wnz = apGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+    int lnx = apGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize();
+    int lny = apGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize();
+    int lnz = apGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize();
+
+    int start_y = 0;
+    int end_y = 1;
     if (ny > 1) {
         start_y = offset;
-        end_y = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize() - offset;
-
+        end_y = lny - offset;
     }
-
-    float *current_pressure = this->mpMainGridBox->Get(this->mKey)->GetNativePointer();
-    float *backup_boundaries = this->mBackupBoundaries.GetNativePointer();
-    for (int iy = start_y; iy < end_y; iy++) {
-        for (int iz = start_z; iz < end_z; iz++) {
-            for (int ix = 0; ix < half_length; ix++) {
-                backup_boundaries[time_step * size_of_boundaries + index] =
-                        current_pressure[iy * wnznx + iz * wnx + bound_length + ix];
-                index++;
-                backup_boundaries[time_step * size_of_boundaries + index] =
-                        current_pressure[iy * wnznx + iz * wnx + (lnx - bound_length - 1) - ix];
-                index++;
+    int start_z = offset;
+    int end_z = lnz - offset;
+    int start_x = offset;
+    int end_x = lnx - offset;
+
+    size_t run_x = end_x - start_x;
+    size_t rows_y = end_y - start_y;
+    size_t rows_z = end_z - start_z;
+    size_t wnznx = (size_t) wnx * wnz;
+
+    float *x_strips = apBoundaries;
+    float *z_strips = x_strips + rows_y * rows_z * 2 * half_length;
+    float *y_strips = z_strips + rows_y * half_length * 2 * run_x;
+
+#pragma omp parallel default(shared)
+    {
+#pragma omp for collapse(2) schedule(static) nowait
+        for (int iy = start_y; iy < end_y; iy++) {
+            for (int iz = start_z; iz < end_z; iz++) {
+                float *row = apWaveField + iy * wnznx + iz * wnx;
+                float *saved = x_strips + ((iy - start_y) * rows_z + (iz - start_z)) * 2 * half_length;
+                copy_run(row + bound_length, saved, half_length, aIsSave);
+                copy_run(row + lnx - bound_length - half_length, saved + half_length, half_length, aIsSave);
             }
         }
-    }
-    for (int iy = start_y; iy < end_y; iy++) {
-        for (int iz = 0; iz < half_length; iz++) {
-            for (int ix = start_x; ix < end_x; ix++) {
-                backup_boundaries[time_step * size_of_boundaries + index] =
-                        current_pressure[iy * wnznx + (bound_length + iz) * wnx + ix];
-                index++;
-                backup_boundaries[time_step * size_of_boundaries + index] =
-                        current_pressure[iy * wnznx + (lnz - bound_length - 1 - iz) * wnx + ix];
-                index++;
+
+#pragma omp for collapse(2) schedule(static) nowait
+        for (int iy = start_y; iy < end_y; iy++) {
+            for (int iz = 0; iz < half_length; iz++) {
+                float *plane = apWaveField + iy * wnznx + start_x;
+                float *saved = z_strips + ((iy - start_y) * half_length + iz) * 2 * run_x;
+                copy_run(plane + (bound_length + iz) * wnx, saved, run_x, aIsSave);
+                copy_run(plane + (lnz - bound_length - 1 - iz) * wnx, saved + run_x, run_x, aIsSave);
             }
         }
-    }
-    if (ny > 1) {
-        for (int iy = 0; iy < half_length; iy++) {
-            for (int iz = start_z; iz < end_z; iz++) {
-                for (int ix = start_x; ix < end_x; ix++) {
-                    backup_boundaries[time_step * size_of_boundaries + index] =
-                            current_pressure[(bound_length + iy) * wnznx + iz * wnx + ix];
-                    index++;
-                    backup_boundaries[time_step * size_of_boundaries + index] =
-                            current_pressure[(lny - bound_length - 1 - iy) * wnznx + iz * wnx + ix];
-                    index++;
+
+        if (ny > 1) {
+#pragma omp for collapse(2) schedule(static) nowait
+            for (int iy = 0; iy < half_length; iy++) {
+                for (int iz = start_z; iz < end_z; iz++) {
+                    float *row = apWaveField + iz * wnx + start_x;
+                    float *saved = y_strips + (iy * rows_z + (iz - start_z)) * 2 * run_x;
+                    copy_run(row + (bound_length + iy) * wnznx, saved, run_x, aIsSave);
+                    copy_run(row + (lny - bound_length - 1 - iy) * wnznx, saved + run_x, run_x, aIsSave);
                 }
             }
         }
     }
 }
 
-void BoundarySaver::RestoreBoundaries(uint aStep) {
-    uint index = 0;
-    uint size_of_boundaries = this->mBoundarySize;
-    uint time_step = aStep;
-    uint half_length = this->mpComputationParameters->GetHalfLength();
-    uint bound_length = this->mpComputationParameters->GetBoundaryLength();
-    uint offset = half_length + bound_length;
-
-    uint start_y = 0;
-    uint end_y = 1;
-
-    ///WILL TEST
-    uint ny = mpMainGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
-
-    uint wnx = mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
-    uint wny = mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
-    uint wnz = mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
-    uint lnx = mpMainGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize();
-    uint lny = mpMainGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize();
-    uint lnz = mpMainGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize();
-
-    uint start_z = offset;
-    uint end_z = mpMainGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - offset;
-    uint start_x = offset;
-    uint end_x = mpMainGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - offset;
-    uint wnznx = wnx * wnz;
-    if (ny > 1) {
-        start_y = offset;
-        end_y = mpMainGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize() - offset;
+void BoundarySaver::SaveBoundaries(uint aStep) {
+    float *current_pressure = this->mpMainGridBox->Get(this->mKey)->GetNativePointer();
+    if (this->mIsCompressed) {
+        float *staging_boundaries = this->mStagingBoundaries.GetNativePointer();
+        copy_boundaries(current_pressure, staging_boundaries,
+                        this->mpMainGridBox, this->mpComputationParameters, true);
+        this->CompressStep(aStep, staging_boundaries);
+    } else {
+        float *backup_boundaries = this->mBackupBoundaries.GetNativePointer() + aStep * this->mBoundarySize;
+        copy_boundaries(current_pressure, backup_boundaries,
+                        this->mpMainGridBox, this->mpComputationParameters, true);
     }
+}
 
+void BoundarySaver::RestoreBoundaries(uint aStep) {
     float *current_pressure = this->mpInternalGridBox->Get(this->mKey)->GetNativePointer();
-    float *backup_boundaries = this->mBackupBoundaries.GetNativePointer();
-    for (int iy = start_y; iy < end_y; iy++) {
-        for (int iz = start_z; iz < end_z; iz++) {
-            for (int ix = 0; ix < half_length; ix++) {
-                current_pressure[iy * wnznx + iz * wnx + bound_length + ix] =
-                        backup_boundaries[time_step * size_of_boundaries + index];
-                index++;
-                current_pressure[iy * wnznx + iz * wnx + (lnx - bound_length - 1) - ix] =
-                        backup_boundaries[time_step * size_of_boundaries + index];
-                index++;
-            }
-        }
-    }
-    for (int iy = start_y; iy < end_y; iy++) {
-        for (int iz = 0; iz < half_length; iz++) {
-            for (int ix = start_x; ix < end_x; ix++) {
-                current_pressure[iy * wnznx + (bound_length + iz) * wnx + ix] =
-                        backup_boundaries[time_step * size_of_boundaries + index];
-                index++;
-                current_pressure[iy * wnznx + (lnz - bound_length - 1 - iz) * wnx + ix] =
-                        backup_boundaries[time_step * size_of_boundaries + index];
-                index++;
-            }
-        }
-    }
-    if (ny > 1) {
-        for (int iy = 0; iy < half_length; iy++) {
-            for (int iz = start_z; iz < end_z; iz++) {
-                for (int ix = start_x; ix < end_x; ix++) {
-                    current_pressure[(bound_length + iy) * wnznx + iz * wnx + ix] =
-                            backup_boundaries[time_step * size_of_boundaries + index];
-                    index++;
-                    current_pressure[(lny - bound_length - 1 - iy) * wnznx + iz * wnx + ix] =
-                            backup_boundaries[time_step * size_of_boundaries + index];
-                    index++;
-                }
-            }
-        }
+    if (this->mIsCompressed) {
+        float *staging_boundaries = this->mStagingBoundaries.GetNativePointer();
+        this->DecompressStep(aStep, staging_boundaries);
+        copy_boundaries(current_pressure, staging_boundaries,
+                        this->mpMainGridBox, this->mpComputationParameters, false);
+    } else {
+        float *backup_boundaries = this->mBackupBoundaries.GetNativePointer() + aStep * this->mBoundarySize;
+        copy_boundaries(current_pressure, backup_boundaries,
+                        this->mpMainGridBox, this->mpComputationParameters, false);
     }
 }
@@ -55,28 +55,33 @@ void CrossCorrelationKernel::Correlation(GridBox *apGridBox) {
     GridBox *receiver_gridbox = this->mpGridBox;
 
     int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     int wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
-    int nx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
-    int nz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
-
     float *source_base = source_gridbox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer();
     float *receiver_base = receiver_gridbox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer();
     float *corr_base = mpShotCorrelation->GetNativePointer();
     float *source_illumination_base = mpSourceIllumination->GetNativePointer();
     float *receiver_illumination_base = mpReceiverIllumination->GetNativePointer();
 
-    float *src_ptr;
-    float *rec_ptr;
-    float *source_i;
-    float *receive_i;
-    float *correlation_output;
-
     uint offset = mpParameters->GetHalfLength();
     int nxEnd = this->mpGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - offset;
     int nzEnd = this->mpGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - offset;
 
+    int y_start;
+    int nyEnd;
+    if (!_IS_2D) {
+        y_start = offset;
+        nyEnd = this->mpGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize() - offset;
+    } else {
+        y_start = 0;
+        nyEnd = 1;
+    }
+
     int size = (wnx - 2 * offset) * (wnz - 2 * offset);
+    if (!_IS_2D) {
+        size *= (wny - 2 * offset);
+    }
     int flops_per_second = 3 * offset;
 
     if (_COMPENSATION_TYPE == COMBINED_COMPENSATION) {
@@ -91,33 +96,39 @@ void CrossCorrelationKernel::Correlation(GridBox *apGridBox) {
 #pragma omp parallel default(shared)
     {
         const uint block_x = mpParameters->GetBlockX();
+        const uint block_y = mpParameters->GetBlockY();
         const uint block_z = mpParameters->GetBlockZ();
 
-#pragma omp for schedule(static, 1) collapse(2)
-        for (int bz = offset; bz < nzEnd; bz += block_z) {
-            for (int bx = offset; bx < nxEnd; bx += block_x) {
+#pragma omp for schedule(static, 1) collapse(3)
+        for (int by = y_start; by < nyEnd; by += block_y) {
+            for (int bz = offset; bz < nzEnd; bz += block_z) {
+                for (int bx = offset; bx < nxEnd; bx += block_x) {
 
-                int izEnd = fmin(bz + block_z, nzEnd);
-                int ixEnd = fmin(block_x, nxEnd - bx);
+                    int iyEnd = fmin(by + block_y, nyEnd);
+                    int izEnd = fmin(bz + block_z, nzEnd);
+                    int ixEnd = fmin(block_x, nxEnd - bx);
 
-                for (int iz = bz; iz < izEnd; ++iz) {
-                    uint b_offset = iz * wnx + bx;
-                    src_ptr = source_base + b_offset;
-                    rec_ptr = receiver_base + b_offset;
-                    correlation_output = corr_base + b_offset;
-                    source_i = source_illumination_base + b_offset;
-                    receive_i = receiver_illumination_base + b_offset;
+                    for (int iy = by; iy < iyEnd; ++iy) {
+                        for (int iz = bz; iz < izEnd; ++iz) {
+                            size_t b_offset = (size_t) iy * wnx * wnz + iz * wnx + bx;
+                            float *src_ptr = source_base + b_offset;
+                            float *rec_ptr = receiver_base + b_offset;
+                            float *correlation_output = corr_base + b_offset;
+                            float *source_i = source_illumination_base + b_offset;
+                            float *receive_i = receiver_illumination_base + b_offset;
 
 #pragma vector aligned
 #pragma ivdep
-                    for (int ix = 0; ix < ixEnd; ix++) {
-                        float value;
-
-                        value = src_ptr[ix] * rec_ptr[ix];
-                        correlation_output[ix] += value;
-                        if (_COMPENSATION_TYPE == COMBINED_COMPENSATION) {
-                            source_i[ix] += src_ptr[ix] * src_ptr[ix];
-                            receive_i[ix] += rec_ptr[ix] * rec_ptr[ix];
+                            for (int ix = 0; ix < ixEnd; ix++) {
+                                float value;
+
+                                value = src_ptr[ix] * rec_ptr[ix];
+                                correlation_output[ix] += value;
+                                if (_COMPENSATION_TYPE == COMBINED_COMPENSATION) {
+                                    source_i[ix] += src_ptr[ix] * src_ptr[ix];
+                                    receive_i[ix] += rec_ptr[ix] * rec_ptr[ix];
+                                }
+                            }
                         }
                     }
                 }
@@ -131,13 +142,15 @@ template<bool _IS_2D, COMPENSATION_TYPE _COMPENSATION_TYPE>
 void CrossCorrelationKernel::Stack() {
 
     int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     int wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
     int nx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
     int nz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
 
     int constant = this->mpGridBox->GetWindowStart(X_AXIS) +
-                   this->mpGridBox->GetWindowStart(Z_AXIS) * nx;
+                   this->mpGridBox->GetWindowStart(Z_AXIS) * nx +
+                   this->mpGridBox->GetWindowStart(Y_AXIS) * nx * nz;
 
     float *in = this->mpShotCorrelation->GetNativePointer();
     float *out = this->mpTotalCorrelation->GetNativePointer() + constant;
@@ -146,6 +159,7 @@ void CrossCorrelationKernel::Stack() {
     float *in_rcv = this->mpReceiverIllumination->GetNativePointer();
 
     uint block_x = this->mpParameters->GetBlockX();
+    uint block_y = this->mpParameters->GetBlockY();
     uint block_z = this->mpParameters->GetBlockZ();
 
     uint offset = this->mpParameters->GetHalfLength() +
@@ -154,43 +168,58 @@ void CrossCorrelationKernel::Stack() {
     int x_end = this->mpGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - offset;
     int z_end = this->mpGridBox->GetWindowAxis()->GetZAxis().GetLogicalAxisSize() - offset;
 
+    int y_start;
+    int y_end;
+    if (!_IS_2D) {
+        y_start = offset;
+        y_end = this->mpGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize() - offset;
+    } else {
+        y_start = 0;
+        y_end = 1;
+    }
+
     int size = (wnx - 2 * offset) * (wnz - 2 * offset);
+    if (!_IS_2D) {
+        size *= (wny - 2 * offset);
+    }
     int flops_per_second = 2 * offset;
     if (_COMPENSATION_TYPE == COMBINED_COMPENSATION) {
         flops_per_second = 6 * offset;
     }
 
-    float *input, *output, *input_src, *input_rcv;
-
     ElasticTimer timer("Correlation::Stack::Kernel",
                        size, 4, true,
                        flops_per_second);
     timer.Start();
-#pragma omp parallel for schedule(static, 1) collapse(2)
-
-    for (int bz = offset; bz < z_end; bz += block_z) {
-        for (int bx = offset; bx < x_end; bx += block_x) {
+#pragma omp parallel for schedule(static, 1) collapse(3)
+    for (int by = y_start; by < y_end; by += block_y) {
+        for (int bz = offset; bz < z_end; bz += block_z) {
+            for (int bx = offset; bx < x_end; bx += block_x) {
 
-            int izEnd = fmin(bz + block_z, z_end);
-            int ixEnd = fmin(bx + block_x, x_end);
+                int iyEnd = fmin(by + block_y, y_end);
+                int izEnd = fmin(bz + block_z, z_end);
+                int ixEnd = fmin(bx + block_x, x_end);
 
-            for (int iz = bz; iz < izEnd; iz++) {
-                uint offset_window = iz * wnx;
-                uint offset = iz * nx;
+                for (int iy = by; iy < iyEnd; iy++) {
+                    for (int iz = bz; iz < izEnd; iz++) {
+                        size_t offset_window = (size_t) iy * wnx * wnz + iz * wnx;
+                        size_t offset_full = (size_t) iy * nx * nz + iz * nx;
 
-                input = in + offset_window;
-                output = out + offset;
+                        float *input = in + offset_window;
+                        float *output = out + offset_full;
 
-                input_src = in_src + offset_window;
+                        float *input_src = in_src + offset_window;
 
-                input_rcv = in_rcv + offset_window;
+                        float *input_rcv = in_rcv + offset_window;
 #pragma ivdep
 #pragma vector aligned
-                for (int ix = bx; ix < ixEnd; ix++) {
-                    if constexpr (_COMPENSATION_TYPE == COMBINED_COMPENSATION) {
-                        output[ix] += (input[ix] / (sqrtf(input_src[ix] * input_rcv[ix]) + EPSILON));
-                    } else {
-                        output[ix] += input[ix];
+                        for (int ix = bx; ix < ixEnd; ix++) {
+                            if constexpr (_COMPENSATION_TYPE == COMBINED_COMPENSATION) {
+                                output[ix] += (input[ix] / (sqrtf(input_src[ix] * input_rcv[ix]) + EPSILON));
+                            } else {
+                                output[ix] += input[ix];
+                            }
+                        }
                     }
                 }
             }
@@ -17,6 +17,10 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include <bs/base/memory/MemoryManager.hpp>
 
 #include <operations/components/independents/concrete/trace-managers/SeismicTraceManager.hpp>
@@ -28,26 +32,147 @@ using namespace operations::components;
 using namespace operations::dataunits;
 using namespace operations::common;
 
+/// Half width of the sinc injection, in cells.
+#define SINC_RADIUS             4
+/// Kaiser window shape for the sinc radius (Hicks, 2002).
+#define SINC_KAISER_BETA        4.14f
+/// Receivers count below which the injection stays serial.
+#define PARALLEL_RECEIVERS      1024
 
-void SeismicTraceManager::ApplyTraces(int time_step) {
+
+/**
+ * @brief Zero order modified Bessel function of the first kind.
+ */
+static float bessel_i0(float aX) {
+    float sum = 1.0f;
+    float term = 1.0f;
+    for (int k = 1; k < 32 && term > 1e-8f * sum; k++) {
+        term *= (aX * aX) / (4.0f * k * k);
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * @brief Kaiser windowed sinc weight of a tap at the given distance
+ * (in cells) from the receiver.
+ */
+static float kaiser_sinc(float aDistance, int aRadius) {
+    if (aRadius == 0) {
+        return 1.0f;
+    }
+    float ratio = aDistance / aRadius;
+    if (fabsf(ratio) >= 1.0f) {
+        return 0.0f;
+    }
+    float sinc = 1.0f;
+    if (aDistance != 0.0f) {
+        sinc = sinf(M_PI * aDistance) / (M_PI * aDistance);
+    }
+    return sinc * bessel_i0(SINC_KAISER_BETA * sqrtf(1.0f - ratio * ratio))
+           / bessel_i0(SINC_KAISER_BETA);
+}
+
+void SeismicTraceManager::PrepareInjection() {
     int trace_size = this->mpTracesHolder->TraceSizePerTimeStep;
 
     int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
-    int wnz_wnx = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize() * wnx;
+    int wny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
+    size_t wnz_wnx = (size_t) this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize() * wnx;
+
+    int offset = mpParameters->GetBoundaryLength() + mpParameters->GetHalfLength();
+    int std_offset = offset * wnx;
+
+    /* Taps never leave the window, as receivers lie at least the offset inside it. */
+    int radius = 0;
+    if (this->mInjection == SINC_INJECTION) {
+        radius = min(SINC_RADIUS, offset);
+    }
+    int taps_x = 2 * radius + 1;
+    int taps_y = wny > 1 ? taps_x : 1;
+    int radius_y = wny > 1 ? radius : 0;
+    this->mInjectionTaps = taps_x * taps_y;
+
+    this->mpDInjectionOffsets.Free();
+    this->mpDInjectionWeights.Free();
+    this->mpDInjectionOffsets.Allocate(this->mInjectionTaps * trace_size, "injection offsets");
+    this->mpDInjectionWeights.Allocate(this->mInjectionTaps * trace_size, "injection weights");
+
+    size_t *offsets = this->mpDInjectionOffsets.GetNativePointer();
+    float *weights = this->mpDInjectionWeights.GetNativePointer();
+    uint *pos_x = this->mpTracesHolder->PositionsX;
+    uint *pos_y = this->mpTracesHolder->PositionsY;
+    float *shift_x = this->mpTracesHolder->ShiftsX;
+    float *shift_y = this->mpTracesHolder->ShiftsY;
+
+    vector<size_t> receivers(trace_size);
+    for (int i = 0; i < trace_size; i++) {
+        receivers[i] = (size_t) pos_y[i] * wnz_wnx + std_offset + pos_x[i];
+        float sx = shift_x != nullptr ? shift_x[i] : 0.0f;
+        float sy = shift_y != nullptr ? shift_y[i] : 0.0f;
+        for (int ky = 0; ky < taps_y; ky++) {
+            int dy = ky - radius_y;
+            float weight_y = radius_y > 0 ? kaiser_sinc(dy - sy, radius_y) : 1.0f;
+            for (int kx = 0; kx < taps_x; kx++) {
+                int dx = kx - radius;
+                size_t index = (size_t) (ky * taps_x + kx) * trace_size + i;
+                offsets[index] = receivers[i] + dy * wnz_wnx + dx;
+                weights[index] = weight_y * kaiser_sinc(dx - sx, radius);
+            }
+        }
+    }
+
+    sort(receivers.begin(), receivers.end());
+    this->mUniqueReceivers =
+            adjacent_find(receivers.begin(), receivers.end()) == receivers.end();
+    this->mInjectionScaled = false;
+}
+
+void SeismicTraceManager::ApplyTraces(int time_step) {
+    int trace_size = this->mpTracesHolder->TraceSizePerTimeStep;
+    int taps = this->mInjectionTaps;
 
-    int std_offset = (mpParameters->GetBoundaryLength() + mpParameters->GetHalfLength()) * wnx;
     float current_time = (time_step - 1) * this->mpGridBox->GetDT();
-    float dt = this->mpGridBox->GetDT();
 
     uint trace_step = uint(current_time / this->mpTracesHolder->SampleDT);
     trace_step = min(trace_step, this->mpTracesHolder->SampleNT - 1);
-    auto traces = this->mpTracesHolder->Traces->GetNativePointer();
-    for (int i = 0; i < trace_size; i++) {
-        int offset = this->mpTracesHolder->PositionsY[i] * wnz_wnx + std_offset + this->mpTracesHolder->PositionsX[i];
-        float *pressure = this->mpGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer();
-        float *velocity = this->mpGridBox->Get(PARM | WIND | GB_VEL)->GetNativePointer();
-        pressure[offset] +=
-                traces[(trace_step) * trace_size + i] *
-                velocity[offset];
+
+    const size_t *offsets = this->mpDInjectionOffsets.GetNativePointer();
+    float *weights = this->mpDInjectionWeights.GetNativePointer();
+    float *pressure = this->mpGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer();
+
+    if (!this->mInjectionScaled) {
+        const float *velocity = this->mpGridBox->Get(PARM | WIND | GB_VEL)->GetNativePointer();
+        size_t entries = (size_t) taps * trace_size;
+#pragma omp parallel for simd schedule(static)
+        for (size_t index = 0; index < entries; index++) {
+            weights[index] *= velocity[offsets[index]];
+        }
+        this->mInjectionScaled = true;
+    }
+
+    /* Samples of a time step are contiguous. */
+    const float *samples = this->mpTracesHolder->Traces->GetNativePointer()
+                           + (size_t) trace_step * trace_size;
+
+    if (this->mUniqueReceivers) {
+        /* Receivers hit distinct points within a tap, taps run one after the other. */
+#pragma omp parallel if(trace_size >= PARALLEL_RECEIVERS)
+        for (int tap = 0; tap < taps; tap++) {
+            const size_t *tap_offsets = offsets + (size_t) tap * trace_size;
+            const float *tap_weights = weights + (size_t) tap * trace_size;
+#pragma omp for simd schedule(static)
+            for (int i = 0; i < trace_size; i++) {
+                pressure[tap_offsets[i]] += samples[i] * tap_weights[i];
+            }
+        }
+    } else {
+        for (int tap = 0; tap < taps; tap++) {
+            const size_t *tap_offsets = offsets + (size_t) tap * trace_size;
+            const float *tap_weights = weights + (size_t) tap * trace_size;
+            for (int i = 0; i < trace_size; i++) {
+                pressure[tap_offsets[i]] += samples[i] * tap_weights[i];
+            }
+        }
     }
 }
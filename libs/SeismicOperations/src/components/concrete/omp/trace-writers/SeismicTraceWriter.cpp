@@ -29,7 +29,7 @@ void SeismicTraceWriter::RecordTrace(uint time_step) {
     int trace_size = mTraceNumber;
 
     int wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
-    int wnz_wnx = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize() * wnx;
+    size_t wnz_wnx = (size_t) this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize() * wnx;
 
     int std_offset = (mpParameters->GetBoundaryLength() + mpParameters->GetHalfLength()) * wnx;
     float current_time = (time_step - 1) * this->mpGridBox->GetDT();
@@ -47,7 +47,7 @@ void SeismicTraceWriter::RecordTrace(uint time_step) {
     auto values = this->mpDTraces.GetNativePointer();
     float *pressure = this->mpGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer();
     for (int i = 0; i < trace_size; i++) {
-        int offset = positions_y[i] * wnz_wnx + std_offset + positions_x[i];
-        values[(trace_step) * trace_size + i] = pressure[offset];
+        size_t offset = positions_y[i] * wnz_wnx + std_offset + positions_x[i];
+        values[(size_t) trace_step * trace_size + i] = pressure[offset];
     }
 }
@@ -357,6 +357,24 @@ void SecondOrderComputationKernel::Compute() {
     double elapsed_time_ms = std::chrono::duration<double, std::milli>(t_end - t_start).count();
 }
 
+bool SecondOrderComputationKernel::FuseCorrelation(GridBox *apForwardGridBox,
+                                                   float *apCorrelation,
+                                                   float *apSourceIllumination,
+                                                   float *apReceiverIllumination) {
+    /// The fused correlation is not supported by this backend, the correlation stays a separate pass.
+    return false;
+}
+
+FORWARD_DECLARE_TEMPORAL_BLOCK_TEMPLATE(SecondOrderComputationKernel, ComputeTemporalBlock)
+
+template<HALF_LENGTH HALF_LENGTH_>
+void SecondOrderComputationKernel::ComputeTemporalBlock(uint aTimeSteps) {
+    /// Temporal blocking is not supported by this backend, step one time step at a time.
+    for (uint it = 0; it < aTimeSteps; it++) {
+        this->Step();
+    }
+}
+
 void SecondOrderComputationKernel::PreprocessModel() {
 
     int nx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
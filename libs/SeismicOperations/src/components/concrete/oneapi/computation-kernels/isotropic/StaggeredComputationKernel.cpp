@@ -39,6 +39,15 @@ FORWARD_DECLARE_COMPUTE_TEMPLATE(StaggeredComputationKernel, ComputePressure)
 
 FORWARD_DECLARE_COMPUTE_TEMPLATE(StaggeredComputationKernel, ComputeVelocity)
 
+FORWARD_DECLARE_COMPUTE_TEMPLATE(StaggeredComputationKernel, ComputeFused)
+
+template<KERNEL_MODE KERNEL_MODE_, bool IS_2D_, HALF_LENGTH HALF_LENGTH_>
+void StaggeredComputationKernel::ComputeFused() {
+    /* No fused sweep yet, the velocity boundary is a no-op when this is called. */
+    this->ComputeVelocity<KERNEL_MODE_, IS_2D_, HALF_LENGTH_>();
+    this->ComputePressure<KERNEL_MODE_, IS_2D_, HALF_LENGTH_>();
+}
+
 
 template<KERNEL_MODE KERNEL_MODE_, bool IS_2D_, HALF_LENGTH HALF_LENGTH_>
 void StaggeredComputationKernel::ComputePressure() {
@@ -34,15 +34,18 @@ class operations::dataunits::FrameBuffer<int>;
 template
 class operations::dataunits::FrameBuffer<uint>;
 
+template
+class operations::dataunits::FrameBuffer<size_t>;
+
 template FrameBuffer<float>::FrameBuffer();
 
-template FrameBuffer<float>::FrameBuffer(uint aSize);
+template FrameBuffer<float>::FrameBuffer(size_t aSize);
 
 template FrameBuffer<float>::~FrameBuffer();
 
-template void FrameBuffer<float>::Allocate(uint size, const std::string &aName);
+template void FrameBuffer<float>::Allocate(size_t size, const std::string &aName);
 
-template void FrameBuffer<float>::Allocate(uint aSize, HALF_LENGTH aHalfLength, const std::string &aName);
+template void FrameBuffer<float>::Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName);
 
 template void FrameBuffer<float>::Free();
 
@@ -58,13 +61,13 @@ template void FrameBuffer<float>::ReflectOnNative();
 
 template FrameBuffer<int>::FrameBuffer();
 
-template FrameBuffer<int>::FrameBuffer(uint aSize);
+template FrameBuffer<int>::FrameBuffer(size_t aSize);
 
 template FrameBuffer<int>::~FrameBuffer();
 
-template void FrameBuffer<int>::Allocate(uint size, const std::string &aName);
+template void FrameBuffer<int>::Allocate(size_t size, const std::string &aName);
 
-template void FrameBuffer<int>::Allocate(uint aSize, HALF_LENGTH aHalfLength, const std::string &aName);
+template void FrameBuffer<int>::Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName);
 
 template void FrameBuffer<int>::Free();
 
@@ -80,13 +83,13 @@ template void FrameBuffer<int>::ReflectOnNative();
 
 template FrameBuffer<uint>::FrameBuffer();
 
-template FrameBuffer<uint>::FrameBuffer(uint aSize);
+template FrameBuffer<uint>::FrameBuffer(size_t aSize);
 
 template FrameBuffer<uint>::~FrameBuffer();
 
-template void FrameBuffer<uint>::Allocate(uint size, const std::string &aName);
+template void FrameBuffer<uint>::Allocate(size_t size, const std::string &aName);
 
-template void FrameBuffer<uint>::Allocate(uint aSize, HALF_LENGTH aHalfLength, const std::string &aName);
+template void FrameBuffer<uint>::Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName);
 
 template void FrameBuffer<uint>::Free();
 
@@ -100,6 +103,28 @@ template void FrameBuffer<uint>::SetNativePointer(uint *ptr);
 
 template void FrameBuffer<uint>::ReflectOnNative();
 
+template FrameBuffer<size_t>::FrameBuffer();
+
+template FrameBuffer<size_t>::FrameBuffer(size_t aSize);
+
+template FrameBuffer<size_t>::~FrameBuffer();
+
+template void FrameBuffer<size_t>::Allocate(size_t size, const std::string &aName);
+
+template void FrameBuffer<size_t>::Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName);
+
+template void FrameBuffer<size_t>::Free();
+
+template size_t *FrameBuffer<size_t>::GetNativePointer();
+
+template size_t *FrameBuffer<size_t>::GetHostPointer();
+
+template size_t *FrameBuffer<size_t>::GetDiskFlushPointer();
+
+template void FrameBuffer<size_t>::SetNativePointer(size_t *ptr);
+
+template void FrameBuffer<size_t>::ReflectOnNative();
+
 template<typename T>
 FrameBuffer<T>::FrameBuffer() {
     mpDataPointer = nullptr;
@@ -108,7 +133,7 @@ FrameBuffer<T>::FrameBuffer() {
 }
 
 template<typename T>
-FrameBuffer<T>::FrameBuffer(uint aSize) {
+FrameBuffer<T>::FrameBuffer(size_t aSize) {
     Allocate(aSize);
     mpHostDataPointer = nullptr;
 }
@@ -119,7 +144,7 @@ FrameBuffer<T>::~FrameBuffer() {
 }
 
 template<typename T>
-void FrameBuffer<T>::Allocate(uint aSize, const std::string &aName) {
+void FrameBuffer<T>::Allocate(size_t aSize, const std::string &aName) {
     mAllocatedBytes = sizeof(T) * aSize;
     auto dev = Backend::GetInstance()->GetDeviceQueue()->get_device();
     auto ctxt = Backend::GetInstance()->GetDeviceQueue()->get_context();
@@ -128,7 +153,7 @@ void FrameBuffer<T>::Allocate(uint aSize, const std::string &aName) {
 }
 
 template<typename T>
-void FrameBuffer<T>::Allocate(uint aSize, HALF_LENGTH aHalfLength, const std::string &aName) {
+void FrameBuffer<T>::Allocate(size_t aSize, HALF_LENGTH aHalfLength, const std::string &aName) {
     mAllocatedBytes = sizeof(T) * aSize;
     auto dev = Backend::GetInstance()->GetDeviceQueue()->get_device();
     auto ctxt = Backend::GetInstance()->GetDeviceQueue()->get_context();
@@ -183,14 +208,14 @@ void FrameBuffer<T>::ReflectOnNative() {
 }
 
 
-void Device::MemSet(void *apDst, int aVal, uint aSize) {
+void Device::MemSet(void *apDst, int aVal, size_t aSize) {
     Backend::GetInstance()->GetDeviceQueue()->submit([&](sycl::handler &cgh) {
         cgh.memset(apDst, aVal, aSize);
     });
     Backend::GetInstance()->GetDeviceQueue()->wait();
 }
 
-void Device::MemCpy(void *apDst, const void *apSrc, uint aSize, CopyDirection aCopyDirection) {
+void Device::MemCpy(void *apDst, const void *apSrc, size_t aSize, CopyDirection aCopyDirection) {
     Backend::GetInstance()->GetDeviceQueue()->submit([&](sycl::handler &cgh) {
         cgh.memcpy(apDst, apSrc, aSize);
     });
@@ -17,6 +17,8 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <bs/base/exceptions/Exceptions.hpp>
+
 #include <operations/components/independents/concrete/forward-collectors/boundary-saver/BoundarySaver.h>
 
 using namespace operations::components::helpers;
@@ -24,9 +26,13 @@ using namespace operations::common;
 using namespace operations::dataunits;
 
 void BoundarySaver::SaveBoundaries(uint aStep) {
-    uint index = 0;
-    uint size_of_boundaries = this->mBoundarySize;
-    uint time_step = aStep;
+    if (this->mIsCompressed) {
+        throw bs::base::exceptions::UNSUPPORTED_FEATURE_EXCEPTION();
+    }
+
+    size_t index = 0;
+    size_t size_of_boundaries = this->mBoundarySize;
+    size_t time_step = aStep;
     uint half_length = this->mpComputationParameters->GetHalfLength();
     uint bound_length = this->mpComputationParameters->GetBoundaryLength();
     uint offset = half_length + bound_length;
@@ -99,9 +105,13 @@ void BoundarySaver::SaveBoundaries(uint aStep) {
 }
 
 void BoundarySaver::RestoreBoundaries(uint aStep) {
-    uint index = 0;
-    uint size_of_boundaries = this->mBoundarySize;
-    uint time_step = aStep;
+    if (this->mIsCompressed) {
+        throw bs::base::exceptions::UNSUPPORTED_FEATURE_EXCEPTION();
+    }
+
+    size_t index = 0;
+    size_t size_of_boundaries = this->mBoundarySize;
+    size_t time_step = aStep;
     uint half_length = this->mpComputationParameters->GetHalfLength();
     uint bound_length = this->mpComputationParameters->GetBoundaryLength();
     uint offset = half_length + bound_length;
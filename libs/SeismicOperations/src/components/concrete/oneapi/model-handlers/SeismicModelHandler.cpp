@@ -79,8 +79,8 @@ void SeismicModelHandler::SetupWindow() {
                     int x = it.get_global_id(0) + start_x;
                     int y = it.get_global_id(1) + start_y;
                     int z = it.get_global_id(2) + start_z;
-                    uint offset_window = y * wnx * wnz + z * wnx + x;
-                    uint offset_full = (y + sy) * nx * nz + (z + sz) * nx + x + sx;
+                    size_t offset_window = (size_t) y * wnx * wnz + z * wnx + x;
+                    size_t offset_full = (size_t) (y + sy) * nx * nz + (z + sz) * nx + x + sx;
                     w_vel[offset_window] = vel[offset_full];
                 });
             });
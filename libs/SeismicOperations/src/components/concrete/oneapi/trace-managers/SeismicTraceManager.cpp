@@ -28,6 +28,16 @@ using namespace operations::components;
 using namespace operations::dataunits;
 using namespace operations::common;
 
+void SeismicTraceManager::PrepareInjection() {
+    if (this->mInjection == SINC_INJECTION) {
+        bs::base::logger::LoggerSystem::GetInstance()->Error()
+                << "Sinc receiver injection is not supported by this backend, "
+                   "using point injection..." << '\n';
+        this->mInjection = POINT_INJECTION;
+    }
+    this->mInjectionTaps = 1;
+}
+
 void SeismicTraceManager::ApplyTraces(int time_step) {
     int trace_size = mpTracesHolder->TraceSizePerTimeStep;
 
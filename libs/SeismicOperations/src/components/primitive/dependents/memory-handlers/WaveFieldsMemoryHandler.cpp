@@ -44,7 +44,7 @@ void WaveFieldsMemoryHandler::CloneWaveFields(GridBox *_src, GridBox *_dst) {
     uint wny = _src->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     uint wnz = _src->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
-    uint const window_size = wnx * wny * wnz;
+    size_t const window_size = (size_t) wnx * wny * wnz;
 
     /// Allocating and zeroing wave fields.
     for (auto wave_field : _src->GetWaveFields()) {
@@ -85,7 +85,7 @@ void WaveFieldsMemoryHandler::CopyWaveFields(GridBox *_src, GridBox *_dst) {
     uint wny = _src->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     uint wnz = _src->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
-    uint const window_size = wnx * wny * wnz;
+    size_t const window_size = (size_t) wnx * wny * wnz;
 
     for (auto wave_field : _src->GetWaveFields()) {
         auto src = _src->Get(wave_field.first)->GetNativePointer();
@@ -44,6 +44,7 @@ CPMLBoundaryManager::CPMLBoundaryManager(ConfigurationMap *apConfigurationMap) {
     this->mShiftRatio = 0.1;
     this->mRelaxCoefficient = 0.1;
     this->mUseTopLayer = true;
+    this->mFusedSweep = true;
     this->mpExtension = nullptr;
     this->mpCoeffax = nullptr;
     this->mpCoeffbx = nullptr;
@@ -110,6 +111,13 @@ void CPMLBoundaryManager::AcquireConfiguration() {
                 OP_K_RELAX_COEFFICIENT,
                 this->mRelaxCoefficient);
     }
+    this->mFusedSweep = this->mpConfigurationMap->GetValue(
+            OP_K_PROPRIETIES,
+            OP_K_FUSED_SWEEP, this->mFusedSweep);
+    if (this->mFusedSweep) {
+        Logger->Info() << "Applying CPML inside the computation kernel sweep when supported."
+                          " To disable it set <boundary-manager.fused-sweep=false>" << '\n';
+    }
 
     this->mpExtension = new HomogenousExtension(this->mUseTopLayer);
     this->mpExtension->SetHalfLength(
@@ -174,11 +182,37 @@ void CPMLBoundaryManager::ApplyAllCPML() {
     CalculateFirstAuxiliary<Z_AXIS, true, HALF_LENGTH_>();
     CalculateFirstAuxiliary<X_AXIS, false, HALF_LENGTH_>();
     CalculateFirstAuxiliary<Z_AXIS, false, HALF_LENGTH_>();
+    if (ny > 1) {
+        CalculateFirstAuxiliary<Y_AXIS, true, HALF_LENGTH_>();
+        CalculateFirstAuxiliary<Y_AXIS, false, HALF_LENGTH_>();
+    }
 
     CalculateCPMLValue<X_AXIS, true, HALF_LENGTH_>();
     CalculateCPMLValue<Z_AXIS, true, HALF_LENGTH_>();
     CalculateCPMLValue<X_AXIS, false, HALF_LENGTH_>();
     CalculateCPMLValue<Z_AXIS, false, HALF_LENGTH_>();
+    if (ny > 1) {
+        CalculateCPMLValue<Y_AXIS, true, HALF_LENGTH_>();
+        CalculateCPMLValue<Y_AXIS, false, HALF_LENGTH_>();
+    }
+}
+
+template<int HALF_LENGTH_>
+void CPMLBoundaryManager::UpdateAllTileCPML(float *apCurrent, int aStartX, int aEndX,
+                                            int aStartZ, int aEndZ) {
+    CalculateTileAuxiliary<X_AXIS, true, HALF_LENGTH_>(apCurrent, aStartX, aEndX, aStartZ, aEndZ);
+    CalculateTileAuxiliary<Z_AXIS, true, HALF_LENGTH_>(apCurrent, aStartX, aEndX, aStartZ, aEndZ);
+    CalculateTileAuxiliary<X_AXIS, false, HALF_LENGTH_>(apCurrent, aStartX, aEndX, aStartZ, aEndZ);
+    CalculateTileAuxiliary<Z_AXIS, false, HALF_LENGTH_>(apCurrent, aStartX, aEndX, aStartZ, aEndZ);
+}
+
+template<int HALF_LENGTH_>
+void CPMLBoundaryManager::ApplyAllTileCPML(float *apNext, int aStartX, int aEndX,
+                                           int aStartZ, int aEndZ) {
+    CalculateTileCPMLValue<X_AXIS, true, HALF_LENGTH_>(apNext, aStartX, aEndX, aStartZ, aEndZ);
+    CalculateTileCPMLValue<Z_AXIS, true, HALF_LENGTH_>(apNext, aStartX, aEndX, aStartZ, aEndZ);
+    CalculateTileCPMLValue<X_AXIS, false, HALF_LENGTH_>(apNext, aStartX, aEndX, aStartZ, aEndZ);
+    CalculateTileCPMLValue<Z_AXIS, false, HALF_LENGTH_>(apNext, aStartX, aEndX, aStartZ, aEndZ);
 }
 
 void CPMLBoundaryManager::InitializeVariables() {
@@ -226,9 +260,9 @@ void CPMLBoundaryManager::InitializeVariables() {
     this->mpCoeffbz = new FrameBuffer<float>(bound_length);
 
     int width = bound_length + (2 * this->mpParameters->GetHalfLength());
-    int y_size = width * wnx * wnz;
-    int x_size = width * wny * wnz;
-    int z_size = width * wnx * wny;
+    size_t y_size = (size_t) width * wnx * wnz;
+    size_t x_size = (size_t) width * wny * wnz;
+    size_t z_size = (size_t) width * wnx * wny;
 
     this->mpAux1xup = new FrameBuffer<float>(x_size);
     this->mpAux1xdown = new FrameBuffer<float>(x_size);
@@ -355,9 +389,9 @@ void CPMLBoundaryManager::ResetVariables() {
             this->mpParameters->GetBoundaryLength()
             + (2 * this->mpParameters->GetHalfLength());
 
-    int y_size = width * wnx * wnz;
-    int x_size = width * wny * wnz;
-    int z_size = width * wnx * wny;
+    size_t y_size = (size_t) width * wnx * wnz;
+    size_t x_size = (size_t) width * wny * wnz;
+    size_t z_size = (size_t) width * wnx * wny;
 
     Device::MemSet(mpAux1xup->GetNativePointer(), 0.0,
                    sizeof(float) * x_size);
@@ -486,6 +520,52 @@ void CPMLBoundaryManager::ApplyBoundary(uint kernel_id) {
     }
 }
 
+bool CPMLBoundaryManager::IsFusedInKernel() {
+    return this->mFusedSweep;
+}
+
+void CPMLBoundaryManager::UpdateTile(float *apCurrent, int aStartX, int aEndX,
+                                     int aStartZ, int aEndZ) {
+    switch (this->mpParameters->GetHalfLength()) {
+        case O_2:
+            UpdateAllTileCPML<O_2>(apCurrent, aStartX, aEndX, aStartZ, aEndZ);
+            break;
+        case O_4:
+            UpdateAllTileCPML<O_4>(apCurrent, aStartX, aEndX, aStartZ, aEndZ);
+            break;
+        case O_8:
+            UpdateAllTileCPML<O_8>(apCurrent, aStartX, aEndX, aStartZ, aEndZ);
+            break;
+        case O_12:
+            UpdateAllTileCPML<O_12>(apCurrent, aStartX, aEndX, aStartZ, aEndZ);
+            break;
+        case O_16:
+            UpdateAllTileCPML<O_16>(apCurrent, aStartX, aEndX, aStartZ, aEndZ);
+            break;
+    }
+}
+
+void CPMLBoundaryManager::ApplyTile(float *apNext, int aStartX, int aEndX,
+                                    int aStartZ, int aEndZ) {
+    switch (this->mpParameters->GetHalfLength()) {
+        case O_2:
+            ApplyAllTileCPML<O_2>(apNext, aStartX, aEndX, aStartZ, aEndZ);
+            break;
+        case O_4:
+            ApplyAllTileCPML<O_4>(apNext, aStartX, aEndX, aStartZ, aEndZ);
+            break;
+        case O_8:
+            ApplyAllTileCPML<O_8>(apNext, aStartX, aEndX, aStartZ, aEndZ);
+            break;
+        case O_12:
+            ApplyAllTileCPML<O_12>(apNext, aStartX, aEndX, aStartZ, aEndZ);
+            break;
+        case O_16:
+            ApplyAllTileCPML<O_16>(apNext, aStartX, aEndX, aStartZ, aEndZ);
+            break;
+    }
+}
+
 void CPMLBoundaryManager::AdjustModelForBackward() {
     this->mpExtension->AdjustPropertyForBackward();
     this->ResetVariables();
@@ -58,6 +58,14 @@ void NoBoundaryManager::ApplyBoundary(uint kernel_id) {
     // Do nothing for perfect reflection.
 }
 
+bool NoBoundaryManager::IsAppliedEachStep() {
+    return false;
+}
+
+bool NoBoundaryManager::IsAppliedOnVelocity() {
+    return false;
+}
+
 void NoBoundaryManager::SetComputationParameters(ComputationParameters *apParameters) {
     LoggerSystem *Logger = LoggerSystem::GetInstance();
     this->mpParameters = (ComputationParameters *) apParameters;
@@ -18,7 +18,6 @@
  */
 
 #include <cstdlib>
-#include <ctime>
 
 #include <bs/base/api/cpp/BSBase.hpp>
 
@@ -35,9 +34,10 @@ using namespace bs::base::logger;
 
 
 RandomBoundaryManager::RandomBoundaryManager(bs::base::configurations::ConfigurationMap *apConfigurationMap) {
-    srand(time(NULL));
     this->mpConfigurationMap = apConfigurationMap;
     this->mGrainSideLength = 0;
+    this->mRandomSeed = 0;
+    this->mShotId = 0;
 }
 
 void RandomBoundaryManager::AcquireConfiguration() {
@@ -54,6 +54,10 @@ void RandomBoundaryManager::AcquireConfiguration() {
                        << " meters." << '\n';
     }
 
+    this->mRandomSeed = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_RANDOM_SEED,
+                                                           (int) this->mRandomSeed);
+    Logger->Info() << "Random Boundary manager will use the seed " << this->mRandomSeed << '\n';
+    srand(this->mRandomSeed);
 
 }
 
@@ -66,6 +70,7 @@ RandomBoundaryManager::~RandomBoundaryManager() {
 
 void
 RandomBoundaryManager::ExtendModel() {
+    this->SeedExtension(this->mShotId);
     for (auto const &extension : this->mvExtensions) {
         extension->ExtendProperty();
     }
@@ -73,17 +78,39 @@ RandomBoundaryManager::ExtendModel() {
 
 void
 RandomBoundaryManager::ReExtendModel() {
+    this->SeedExtension(this->mShotId);
     for (auto const &extension : this->mvExtensions) {
         extension->ExtendProperty();
         extension->ReExtendProperty();
     }
 }
 
+void
+RandomBoundaryManager::SetShotId(uint aShotId) {
+    this->mShotId = aShotId;
+}
+
 void
 RandomBoundaryManager::ApplyBoundary(uint kernel_id) {
     // Do nothing for random boundaries.
 }
 
+bool
+RandomBoundaryManager::IsAppliedEachStep() {
+    return false;
+}
+
+bool
+RandomBoundaryManager::IsAppliedOnVelocity() {
+    return false;
+}
+
+bool
+RandomBoundaryManager::IsReExtendingFullModel() {
+    // Each shot draws a new random extension of the full model.
+    return true;
+}
+
 void
 RandomBoundaryManager::SetComputationParameters(ComputationParameters *apParameters) {
     auto logger = LoggerSystem::GetInstance();
@@ -127,6 +154,13 @@ RandomBoundaryManager::InitializeExtensions() {
     }
 }
 
+void
+RandomBoundaryManager::SeedExtension(uint aShotId) {
+    /* Golden ratio increment, so that neighbouring shot ids get unrelated seeds. */
+    auto extension = (RandomExtension *) this->mvExtensions[0];
+    extension->SetShotSeed(this->mRandomSeed + (uint64_t) aShotId * 0x9E3779B97F4A7C15ULL);
+}
+
 void
 RandomBoundaryManager::AdjustModelForBackward() {
     for (auto const &extension : this->mvExtensions) {
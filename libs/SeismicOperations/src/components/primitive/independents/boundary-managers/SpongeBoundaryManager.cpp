@@ -69,6 +69,10 @@ void SpongeBoundaryManager::ApplyBoundary(uint kernel_id) {
     }
 }
 
+bool SpongeBoundaryManager::IsAppliedOnVelocity() {
+    return false;
+}
+
 void SpongeBoundaryManager::ExtendModel() {
     for (auto const &extension : this->mvExtensions) {
         extension->ExtendProperty();
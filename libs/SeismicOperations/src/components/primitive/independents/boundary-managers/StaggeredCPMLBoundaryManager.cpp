@@ -156,7 +156,7 @@ StaggeredCPMLBoundaryManager::SetGridBox(GridBox *apGridBox) {
     HALF_LENGTH h_l = mpParameters->GetHalfLength();
 
     // get the size of grid
-    int grid_total_size = wnx * wnz * wny;
+    size_t grid_total_size = (size_t) wnx * wnz * wny;
     // the size of the boundary in x without half_length is x=b_l and z=nz-2*h_l
     int bound_size_x = b_l * (wnz - 2 * h_l);
     // the size of the boundary in z without half_length is x=nx-2*h_l and z=b_l
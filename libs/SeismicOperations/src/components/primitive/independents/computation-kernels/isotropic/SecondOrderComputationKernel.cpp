@@ -119,13 +119,44 @@ void SecondOrderComputationKernel::Step() {
     }
 
     {
-        ScopeTimer t("BoundaryManager::ApplyBoundary");
-        if (this->mpBoundaryManager != nullptr) {
+        HandleTimer t(this->mApplyBoundaryTimer);
+        if (this->mpBoundaryManager != nullptr && !this->mBoundaryInSweep) {
             this->mpBoundaryManager->ApplyBoundary();
         }
     }
 }
 
+void SecondOrderComputationKernel::AdvanceSteps(uint aTimeSteps) {
+    int logical_ny = this->mpGridBox->GetAfterSamplingAxis()->GetYAxis().GetLogicalAxisSize();
+    bool boundary_each_step = this->mpBoundaryManager != nullptr &&
+                              this->mpBoundaryManager->IsAppliedEachStep();
+    // Temporal blocking only covers the 2D kernel with no boundary work in between.
+    if (aTimeSteps < 2 || logical_ny != 1 || boundary_each_step) {
+        ComputationKernel::AdvanceSteps(aTimeSteps);
+        return;
+    }
+    if (mpCoeffX == nullptr) {
+        InitializeVariables();
+    }
+    switch (mpParameters->GetHalfLength()) {
+        case O_2:
+            ComputeTemporalBlock<O_2>(aTimeSteps);
+            break;
+        case O_4:
+            ComputeTemporalBlock<O_4>(aTimeSteps);
+            break;
+        case O_8:
+            ComputeTemporalBlock<O_8>(aTimeSteps);
+            break;
+        case O_12:
+            ComputeTemporalBlock<O_12>(aTimeSteps);
+            break;
+        case O_16:
+            ComputeTemporalBlock<O_16>(aTimeSteps);
+            break;
+    }
+}
+
 void SecondOrderComputationKernel::SetComputationParameters(ComputationParameters *apParameters) {
     LoggerSystem *Logger = LoggerSystem::GetInstance();
     this->mpParameters = (ComputationParameters *) apParameters;
@@ -27,6 +27,7 @@
 #include <operations/components/independents/concrete/computation-kernels/isotropic/StaggeredComputationKernel.hpp>
 
 #include <operations/components/dependents/concrete/memory-handlers/WaveFieldsMemoryHandler.hpp>
+#include <operations/configurations/MapKeys.h>
 
 using namespace std;
 using namespace bs::base::logger;
@@ -45,6 +46,7 @@ StaggeredComputationKernel::StaggeredComputationKernel(
 
 StaggeredComputationKernel::StaggeredComputationKernel(const StaggeredComputationKernel &aStaggeredComputationKernel) {
     this->mpConfigurationMap = aStaggeredComputationKernel.mpConfigurationMap;
+    this->mFusedSweep = aStaggeredComputationKernel.mFusedSweep;
     this->mpMemoryHandler = new WaveFieldsMemoryHandler(this->mpConfigurationMap);
     this->mpBoundaryManager = nullptr;
     this->mpCoeff = nullptr;
@@ -54,7 +56,10 @@ StaggeredComputationKernel::~StaggeredComputationKernel() {
     delete this->mpCoeff;
 }
 
-void StaggeredComputationKernel::AcquireConfiguration() {}
+void StaggeredComputationKernel::AcquireConfiguration() {
+    this->mFusedSweep = this->mpConfigurationMap->GetValue(
+            OP_K_PROPRIETIES, OP_K_FUSED_SWEEP, this->mFusedSweep);
+}
 
 ComputationKernel *StaggeredComputationKernel::Clone() {
     return new StaggeredComputationKernel(*this);
@@ -94,14 +99,19 @@ void StaggeredComputationKernel::ComputeAll() {
 
 template<KERNEL_MODE KERNEL_MODE_, bool IS_2D_, HALF_LENGTH HALF_LENGTH_>
 void StaggeredComputationKernel::ComputeAll() {
+    if (this->mFusedSweep &&
+        (this->mpBoundaryManager == nullptr || !this->mpBoundaryManager->IsAppliedOnVelocity())) {
+        this->ComputeFused<KERNEL_MODE_, IS_2D_, HALF_LENGTH_>();
+        return;
+    }
     this->ComputeVelocity<KERNEL_MODE_, IS_2D_, HALF_LENGTH_>();
 
-    ElasticTimer timer("BoundaryManager::ApplyBoundary(Velocity)");
-    timer.Start();
-    if (this->mpBoundaryManager != nullptr) {
-        this->mpBoundaryManager->ApplyBoundary(1);
+    {
+        HandleTimer t(this->mApplyVelocityBoundaryTimer);
+        if (this->mpBoundaryManager != nullptr) {
+            this->mpBoundaryManager->ApplyBoundary(1);
+        }
     }
-    timer.Stop();
     this->ComputePressure<KERNEL_MODE_, IS_2D_, HALF_LENGTH_>();
 
 }
@@ -123,7 +133,7 @@ void StaggeredComputationKernel::Step() {
     this->mpGridBox->Swap(WAVE | GB_PRSS | NEXT | DIR_Z, WAVE | GB_PRSS | CURR | DIR_Z);
 
     {
-        ScopeTimer t("BoundaryManager::ApplyBoundary(Pressure)");
+        HandleTimer t(this->mApplyPressureBoundaryTimer);
         if (this->mpBoundaryManager != nullptr) {
             this->mpBoundaryManager->ApplyBoundary(0);
         }
@@ -0,0 +1,403 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include <bs/base/api/cpp/BSBase.hpp>
+#include <bs/timer/api/cpp/BSTimer.hpp>
+
+#include <operations/components/independents/concrete/forward-collectors/CheckpointPropagation.hpp>
+#include <operations/configurations/MapKeys.h>
+
+using namespace std;
+using namespace bs::timer;
+using namespace bs::base::logger;
+using namespace bs::base::memory;
+using namespace operations::components;
+using namespace operations::helpers;
+using namespace operations::common;
+using namespace operations::dataunits;
+
+/// Minimum number of checkpoints, the first and the last forward states.
+#define MIN_CHECKPOINTS 2
+
+/// Saturation value of the binomial coefficients, way above any number of time steps.
+#define MAX_BINOMIAL 0xFFFFFFFFULL
+
+/**
+ * @brief
+ * Number of time steps reversible using the given number of checkpoints,
+ * with each step repeated at most the given number of times, i.e. (s + r)! / (s! r!).
+ */
+static unsigned long long binomial(uint aCheckpoints, uint aRepetitions) {
+    unsigned long long result = 1;
+    for (uint i = 1; i <= aCheckpoints; i++) {
+        result = result * (aRepetitions + i) / i;
+        if (result >= MAX_BINOMIAL) {
+            return MAX_BINOMIAL;
+        }
+    }
+    return result;
+}
+
+
+CheckpointPropagation::CheckpointPropagation(bs::base::configurations::ConfigurationMap *apConfigurationMap) {
+    this->mpConfigurationMap = apConfigurationMap;
+    this->mpInternalGridBox = new GridBox();
+    this->mMemoryBudget = 1024;
+    this->mCheckpointsCount = 0;
+    this->mTimeStep = 0;
+    this->mNextCheckpoint = 0;
+    this->mRecomputedSteps = 0;
+}
+
+CheckpointPropagation::~CheckpointPropagation() {
+    if (this->mpCheckpointsHostMemory != nullptr) {
+        mem_free(this->mpCheckpointsHostMemory);
+    }
+    if (!this->mpInternalGridBox->GetWaveFields().empty()) {
+        this->mpWaveFieldsMemoryHandler->FreeWaveFields(this->mpInternalGridBox);
+    }
+    for (auto parameter : this->mForwardParameters) {
+        delete parameter;
+    }
+    delete this->mpInternalGridBox;
+    delete this->mpComputationKernel;
+}
+
+void CheckpointPropagation::AcquireConfiguration() {
+    LoggerSystem *Logger = LoggerSystem::GetInstance();
+    this->mMemoryBudget = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_MEMORY_BUDGET,
+                                                             this->mMemoryBudget);
+    if (this->mMemoryBudget <= 0) {
+        Logger->Error() << "Checkpoints memory budget must be positive... Terminating..." << '\n';
+        exit(EXIT_FAILURE);
+    }
+    // The boundary manager works on the main grid box only, so the recomputation
+    // can't apply any boundary at each time step.
+    auto boundary_manager = (BoundaryManager *) (this->mpComponentsMap->Get(BOUNDARY_MANAGER));
+    if (boundary_manager->IsAppliedEachStep()) {
+        Logger->Error() << "Checkpoint forward collector only supports the none and random "
+                        << "boundaries... Terminating..." << '\n';
+        exit(EXIT_FAILURE);
+    }
+    auto computation_kernel = (ComputationKernel *) (this->mpComponentsMap->Get(COMPUTATION_KERNEL));
+    this->mpSourceInjector = (SourceInjector *) (this->mpComponentsMap->Get(SOURCE_INJECTOR));
+
+    this->mpComputationKernel = (ComputationKernel *) computation_kernel->Clone();
+    this->mpComputationKernel->SetDependentComponents(this->GetDependentComponentsMap());
+    this->mpComputationKernel->SetMode(KERNEL_MODE::FORWARD);
+    this->mpComputationKernel->SetComputationParameters(this->mpParameters);
+    this->mpComputationKernel->SetGridBox(this->mpInternalGridBox);
+}
+
+void CheckpointPropagation::ResetGrid(bool aIsForwardRun) {
+    uint wnx = this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    uint wny = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
+    uint wnz = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    size_t const window_size = (size_t) wnx * wny * wnz;
+
+    if (aIsForwardRun) {
+        if (this->mpCheckpointsHostMemory == nullptr) {
+            this->InitializeCheckpoints();
+        }
+        this->mCheckpoints.clear();
+        this->mFreeSlots.clear();
+        for (uint slot = this->mCheckpointsCount; slot > 0; slot--) {
+            this->mFreeSlots.push_back(slot - 1);
+        }
+        this->mTimeStep = 0;
+        this->mNextCheckpoint = 0;
+    } else {
+        this->mpMainGridBox->CloneMetaData(this->mpInternalGridBox);
+
+        /*
+         * Keep the window parameters of the forward propagation for the
+         * recomputation, the model is adjusted right after for the backward.
+         */
+
+        uint index = 0;
+        for (auto const &parameter : this->mpMainGridBox->GetParameters()) {
+            if (index == this->mForwardParameters.size()) {
+                auto frame_buffer = new FrameBuffer<float>();
+                frame_buffer->Allocate(window_size, this->mpParameters->GetHalfLength(),
+                                       "forward " + GridBox::Stringify(parameter.first));
+                this->mForwardParameters.push_back(frame_buffer);
+            }
+            Device::MemCpy(this->mForwardParameters[index]->GetNativePointer(),
+                           this->mpMainGridBox->Get(WIND | parameter.first)->GetNativePointer(),
+                           window_size * sizeof(float),
+                           Device::COPY_DEVICE_TO_DEVICE);
+            this->mpInternalGridBox->RegisterParameter(parameter.first,
+                                                       parameter.second,
+                                                       this->mForwardParameters[index]);
+            index++;
+        }
+
+        if (this->mpInternalGridBox->GetWaveFields().empty()) {
+            this->mpWaveFieldsMemoryHandler->CloneWaveFields(this->mpMainGridBox,
+                                                             this->mpInternalGridBox);
+        }
+
+        // Fetch forward is called before each backward step, the first call
+        // decrements to the state the last forward step started from (nt - 2).
+        this->mTimeStep = this->mpMainGridBox->GetNT() - 1;
+        this->mRecomputedSteps = 0;
+    }
+
+    for (auto const &wave_field : this->mpMainGridBox->GetWaveFields()) {
+        Device::MemSet(wave_field.second->GetNativePointer(), 0.0f, window_size * sizeof(float));
+    }
+}
+
+void CheckpointPropagation::SaveForward() {
+    uint last_step = this->mpMainGridBox->GetNT() - 2;
+
+    if (this->mTimeStep == this->mNextCheckpoint || this->mTimeStep == last_step) {
+        ScopeTimer t("ForwardCollector::Checkpoint");
+        this->PushCheckpoint(this->mpMainGridBox, this->mTimeStep);
+        if (this->mTimeStep < last_step) {
+            // One checkpoint is always kept free for the last state.
+            this->mNextCheckpoint = this->GetNextCheckpoint(this->mTimeStep, last_step,
+                                                            this->mFreeSlots.size() - 1);
+        }
+    }
+    this->mTimeStep++;
+}
+
+uint CheckpointPropagation::GetSkippableSteps() {
+    uint last_step = this->mpMainGridBox->GetNT() - 2;
+    uint next_checkpoint = min(this->mNextCheckpoint, last_step);
+    if (next_checkpoint <= this->mTimeStep) {
+        return 0;
+    }
+    return next_checkpoint - this->mTimeStep;
+}
+
+void CheckpointPropagation::SkipForward(uint aTimeSteps) {
+    this->mTimeStep += aTimeSteps;
+}
+
+void CheckpointPropagation::FetchForward() {
+    this->mTimeStep--;
+
+    // Checkpoints after the requested state are not needed anymore.
+    while (this->mCheckpoints.back().first > this->mTimeStep) {
+        this->mFreeSlots.push_back(this->mCheckpoints.back().second);
+        this->mCheckpoints.pop_back();
+    }
+
+    uint time_step = this->mCheckpoints.back().first;
+    this->RestoreCheckpoint();
+
+    if (time_step == this->mTimeStep) {
+        this->mFreeSlots.push_back(this->mCheckpoints.back().second);
+        this->mCheckpoints.pop_back();
+    } else {
+        /*
+         * Advance from the nearest checkpoint to the requested state,
+         * taking new checkpoints on the way while there are free ones.
+         */
+
+        uint next_checkpoint = this->GetNextCheckpoint(time_step, this->mTimeStep,
+                                                       this->mFreeSlots.size());
+        int cut_off = this->mpSourceInjector->GetCutOffTimeStep();
+        this->mpSourceInjector->SetGridBox(this->mpInternalGridBox);
+        for (uint it = time_step + 1; it <= this->mTimeStep; it++) {
+            {
+                ScopeTimer t("ForwardCollector::Recompute");
+                // Once the source is done, advance up to the next checkpoint at once.
+                uint steps = 1;
+                if ((int) it >= cut_off) {
+                    steps = min(this->mpParameters->GetBlockT(), this->mTimeStep - it + 1);
+                    if (next_checkpoint >= it) {
+                        steps = min(steps, next_checkpoint - it + 1);
+                    }
+                }
+                if (steps > 1) {
+                    this->mpComputationKernel->AdvanceSteps(steps);
+                    it += steps - 1;
+                } else {
+                    this->mpSourceInjector->ApplySource(it);
+                    this->mpComputationKernel->Step();
+                }
+            }
+            if (it == next_checkpoint && it < this->mTimeStep) {
+                ScopeTimer t("ForwardCollector::Checkpoint");
+                this->PushCheckpoint(this->mpInternalGridBox, it);
+                next_checkpoint = this->GetNextCheckpoint(it, this->mTimeStep,
+                                                          this->mFreeSlots.size());
+            }
+        }
+        this->mpSourceInjector->SetGridBox(this->mpMainGridBox);
+        this->mRecomputedSteps += this->mTimeStep - time_step;
+    }
+
+    if (this->mTimeStep == 0) {
+        LoggerSystem *Logger = LoggerSystem::GetInstance();
+        Logger->Info() << "Checkpointing recomputed " << this->mRecomputedSteps << " steps using "
+                       << this->mCheckpointsCount << " checkpoints (recompute ratio "
+                       << (float) this->mRecomputedSteps / (this->mpMainGridBox->GetNT() - 1)
+                       << ")" << '\n';
+    }
+}
+
+void CheckpointPropagation::InitializeCheckpoints() {
+    LoggerSystem *Logger = LoggerSystem::GetInstance();
+
+    size_t window_size = (size_t) this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    this->mStateKeys.clear();
+    for (auto const &wave_field : this->mpMainGridBox->GetWaveFields()) {
+        if (!GridBox::Includes(wave_field.first, NEXT)) {
+            this->mStateKeys.push_back(wave_field.first);
+        }
+    }
+    size_t checkpoint_size = this->mStateKeys.size() * window_size;
+
+    unsigned long long max_checkpoints = this->mpMainGridBox->GetNT() - 1;
+    unsigned long long checkpoints = (this->mMemoryBudget * 1024 * 1024) /
+                                     (checkpoint_size * sizeof(float));
+    if (checkpoints < MIN_CHECKPOINTS) {
+        Logger->Info() << "Checkpoints memory budget is too small, using "
+                       << MIN_CHECKPOINTS << " checkpoints" << '\n';
+        checkpoints = MIN_CHECKPOINTS;
+    }
+    this->mCheckpointsCount = min(checkpoints, max(max_checkpoints, (unsigned long long) MIN_CHECKPOINTS));
+
+    this->mpCheckpointsHostMemory = (float *) mem_allocate(
+            (sizeof(float)), this->mCheckpointsCount * checkpoint_size, "checkpoints");
+    while (this->mpCheckpointsHostMemory == nullptr && this->mCheckpointsCount > MIN_CHECKPOINTS) {
+        this->mCheckpointsCount = max(this->mCheckpointsCount / 2, (uint) MIN_CHECKPOINTS);
+        this->mpCheckpointsHostMemory = (float *) mem_allocate(
+                (sizeof(float)), this->mCheckpointsCount * checkpoint_size, "checkpoints");
+    }
+    if (this->mpCheckpointsHostMemory == nullptr) {
+        Logger->Error() << "Couldn't allocate the checkpoints... Terminating..." << '\n';
+        exit(EXIT_FAILURE);
+    }
+    Logger->Info() << "Using " << this->mCheckpointsCount << " checkpoints for "
+                   << max_checkpoints << " forward states" << '\n';
+}
+
+void CheckpointPropagation::PushCheckpoint(GridBox *apGridBox, uint aTimeStep) {
+    size_t window_size = (size_t) this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    uint slot = this->mFreeSlots.back();
+    this->mFreeSlots.pop_back();
+
+    float *checkpoint = this->mpCheckpointsHostMemory + slot * this->mStateKeys.size() * window_size;
+    for (auto const &key : this->mStateKeys) {
+        Device::MemCpy(checkpoint, apGridBox->Get(key)->GetNativePointer(),
+                       window_size * sizeof(float),
+                       Device::COPY_DEVICE_TO_HOST);
+        checkpoint += window_size;
+    }
+    this->mCheckpoints.emplace_back(aTimeStep, slot);
+}
+
+void CheckpointPropagation::RestoreCheckpoint() {
+    size_t window_size = (size_t) this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    uint slot = this->mCheckpoints.back().second;
+
+    float *checkpoint = this->mpCheckpointsHostMemory + slot * this->mStateKeys.size() * window_size;
+    for (auto const &key : this->mStateKeys) {
+        Device::MemCpy(this->mpInternalGridBox->Get(key)->GetNativePointer(), checkpoint,
+                       window_size * sizeof(float),
+                       Device::COPY_HOST_TO_DEVICE);
+        checkpoint += window_size;
+    }
+}
+
+uint CheckpointPropagation::GetNextCheckpoint(uint aTimeStep, uint aTargetTimeStep, uint aFreeCheckpoints) {
+    // States from the current one to the target one, both included.
+    uint states = aTargetTimeStep - aTimeStep + 1;
+    if (aFreeCheckpoints == 0 || states < 3) {
+        return aTargetTimeStep + 1;
+    }
+
+    /*
+     * With c checkpoints (counting the current one) and r the minimum number of
+     * repetitions such that binomial(c, r) covers all the states, the states after
+     * the next checkpoint are reversed using c - 1 checkpoints and r repetitions,
+     * and the ones before it using c checkpoints and r - 1 repetitions.
+     */
+
+    uint checkpoints = aFreeCheckpoints + 1;
+    uint repetitions = 0;
+    while (binomial(checkpoints, repetitions) < states) {
+        repetitions++;
+    }
+    unsigned long long right_states = binomial(checkpoints - 1, repetitions);
+    uint offset = states > right_states ? states - right_states : 1;
+    return aTimeStep + offset;
+}
+
+void CheckpointPropagation::SetComputationParameters(ComputationParameters *apParameters) {
+    LoggerSystem *Logger = LoggerSystem::GetInstance();
+    this->mpParameters = (ComputationParameters *) apParameters;
+    if (this->mpParameters == nullptr) {
+        Logger->Error() << "No computation parameters provided... Terminating..." << '\n';
+        exit(EXIT_FAILURE);
+    }
+}
+
+void CheckpointPropagation::SetGridBox(GridBox *apGridBox) {
+    LoggerSystem *Logger = LoggerSystem::GetInstance();
+    this->mpMainGridBox = apGridBox;
+    if (this->mpMainGridBox == nullptr) {
+        Logger->Error() << "Not a compatible GridBox... Terminating..." << '\n';
+        exit(EXIT_FAILURE);
+    }
+}
+
+void CheckpointPropagation::SetDependentComponents(
+        ComponentsMap<DependentComponent> *apDependentComponentsMap) {
+    LoggerSystem *Logger = LoggerSystem::GetInstance();
+    HasDependents::SetDependentComponents(apDependentComponentsMap);
+
+    this->mpWaveFieldsMemoryHandler =
+            (WaveFieldsMemoryHandler *)
+                    this->GetDependentComponentsMap()->Get(MEMORY_HANDLER);
+    if (this->mpWaveFieldsMemoryHandler == nullptr) {
+        Logger->Error() << "No Wave Fields Memory Handler provided... "
+                        << "Terminating..." << '\n';
+        exit(EXIT_FAILURE);
+    }
+}
+
+GridBox *CheckpointPropagation::GetForwardGrid() {
+    return this->mpInternalGridBox;
+}
+
+uint CheckpointPropagation::GetCheckpointsCount() const {
+    return this->mCheckpointsCount;
+}
+
+uint CheckpointPropagation::GetRecomputedSteps() const {
+    return this->mRecomputedSteps;
+}
@@ -36,6 +36,7 @@ ReversePropagation::ReversePropagation(bs::base::configurations::ConfigurationMa
     this->mpInternalGridBox = new GridBox();
     this->mpComputationKernel = nullptr;
     this->mInjectionEnabled = false;
+    this->mBoundaryCompression = false;
     this->mTimeStep = 0;
 }
 
@@ -51,6 +52,8 @@ ReversePropagation::~ReversePropagation() {
 void ReversePropagation::AcquireConfiguration() {
     this->mInjectionEnabled = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_BOUNDARY_SAVING,
                                                                  this->mInjectionEnabled);
+    this->mBoundaryCompression = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_BOUNDARY_COMPRESSION,
+                                                                    this->mBoundaryCompression);
     auto computation_kernel = (ComputationKernel *) (this->mpComponentsMap->Get(COMPUTATION_KERNEL));
 
     this->mpComputationKernel = (ComputationKernel *) computation_kernel->Clone();
@@ -78,7 +81,7 @@ void ReversePropagation::ResetGrid(bool is_forward_run) {
     uint wny = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     uint wnz = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
-    uint const window_size = wnx * wny * wnz;
+    size_t const window_size = (size_t) wnx * wny * wnz;
 
     if (!is_forward_run) {
 
@@ -136,6 +139,14 @@ void ReversePropagation::SaveForward() {
     }
 }
 
+uint ReversePropagation::GetSkippableSteps() {
+    // Without boundaries injection no time step is observed in the forward.
+    if (this->mInjectionEnabled) {
+        return 0;
+    }
+    return this->mpMainGridBox->GetNT();
+}
+
 void ReversePropagation::Inject() {
     this->mTimeStep = 0;
     if (this->mBoundarySavers.empty()) {
@@ -143,7 +154,7 @@ void ReversePropagation::Inject() {
         boundary_saver->Initialize(
                 WAVE | GB_PRSS | CURR | DIR_Z,
                 this->mpInternalGridBox,
-                this->mpMainGridBox, this->mpParameters);
+                this->mpMainGridBox, this->mpParameters, this->mBoundaryCompression);
         this->mBoundarySavers.push_back(boundary_saver);
         if (this->mpParameters->GetApproximation() == ISOTROPIC) {
             if (this->mpParameters->GetEquationOrder() == FIRST) {
@@ -151,13 +162,13 @@ void ReversePropagation::Inject() {
                 boundary_saver_particle_x->Initialize(
                         WAVE | GB_PRTC | CURR | DIR_X,
                         this->mpInternalGridBox,
-                        this->mpMainGridBox, this->mpParameters);
+                        this->mpMainGridBox, this->mpParameters, this->mBoundaryCompression);
                 this->mBoundarySavers.push_back(boundary_saver_particle_x);
                 auto boundary_saver_particle_z = new BoundarySaver();
                 boundary_saver_particle_z->Initialize(
                         WAVE | GB_PRTC | CURR | DIR_Z,
                         this->mpInternalGridBox,
-                        this->mpMainGridBox, this->mpParameters);
+                        this->mpMainGridBox, this->mpParameters, this->mBoundaryCompression);
                 this->mBoundarySavers.push_back(boundary_saver_particle_z);
                 uint wny = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
                 if (wny > 1) {
@@ -165,7 +176,7 @@ void ReversePropagation::Inject() {
                     boundary_saver_particle_y->Initialize(
                             WAVE | GB_PRTC | CURR | DIR_Y,
                             this->mpInternalGridBox,
-                            this->mpMainGridBox, this->mpParameters);
+                            this->mpMainGridBox, this->mpParameters, this->mBoundaryCompression);
                     this->mBoundarySavers.push_back(boundary_saver_particle_y);
                 }
             }
@@ -17,6 +17,7 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <sys/stat.h>
 
 #include <bs/base/api/cpp/BSBase.hpp>
@@ -37,7 +38,8 @@ using namespace operations::common;
 using namespace operations::dataunits;
 using namespace operations::utils::compressors;
 
-static float *initial_internalGridbox_curr = nullptr;
+/// Number of host staging slots used when the snapshots are spilled to disk.
+#define HOST_STAGING_SLOTS 2
 
 TwoPropagation::TwoPropagation(bs::base::configurations::ConfigurationMap *apConfigurationMap) {
     this->mpConfigurationMap = apConfigurationMap;
@@ -49,15 +51,20 @@ TwoPropagation::TwoPropagation(bs::base::configurations::ConfigurationMap *apCon
     this->mZFP_Tolerance = 0.01f;
     this->mZFP_Parallel = true;
     this->mZFP_IsRelative = false;
+    this->mCodecType = Compressor::ZFP_SNAPSHOTS;
     this->mMaxNT = 0;
+    this->mHostSlots = 1;
+    this->mMemoryBudget = 0;
 }
 
 TwoPropagation::~TwoPropagation() {
+    /* Drain any in-flight spill before releasing its staging slot. */
+    delete this->mpFileHandler;
     if (this->mpForwardPressureHostMemory != nullptr) {
         mem_free(this->mpForwardPressureHostMemory);
     }
     delete this->mpForwardPressure;
-    this->mpInternalGridBox->Set(WAVE | GB_PRSS | CURR | DIR_Z, initial_internalGridbox_curr);
+    this->mpInternalGridBox->Set(WAVE | GB_PRSS | CURR | DIR_Z, this->mpInternalCurr);
     this->mpWaveFieldsMemoryHandler->FreeWaveFields(this->mpInternalGridBox);
     delete this->mpInternalGridBox;
 }
@@ -86,6 +93,22 @@ void TwoPropagation::AcquireConfiguration() {
         this->mZFP_IsRelative = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_ZFP_RELATIVE,
                                                                    this->mZFP_IsRelative);
     }
+    if (this->mpConfigurationMap->Contains(OP_K_PROPRIETIES, OP_K_MEMORY_BUDGET)) {
+        this->mMemoryBudget = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_MEMORY_BUDGET,
+                                                                 this->mMemoryBudget);
+    }
+    std::string compression_type = OP_K_ZFP;
+    compression_type = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_COMPRESSION_TYPE,
+                                                          compression_type);
+    if (compression_type == OP_K_BFP) {
+        this->mCodecType = Compressor::BLOCK_FLOATING_POINT;
+    } else if (compression_type == OP_K_ZFP) {
+        this->mCodecType = this->mZFP_Parallel ? Compressor::ZFP_SLABS : Compressor::ZFP_SNAPSHOTS;
+    } else {
+        LoggerSystem::GetInstance()->Error() << "Invalid value for compression-type key : "
+                                                "supported values [ zfp | bfp ]" << '\n';
+        exit(EXIT_FAILURE);
+    }
 }
 
 void TwoPropagation::FetchForward() {
@@ -95,27 +118,10 @@ void TwoPropagation::FetchForward() {
     uint wnz = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
 
-    uint const window_size = wnx * wny * wnz;
-    // Retrieve data from files to host buffer
-    if ((this->mTimeCounter + 1) % this->mMaxNT == 0) {
-        if (this->mIsCompression) { ;
-            string str = this->mWritePath + "/temp_" + to_string(this->mTimeCounter / this->mMaxNT);
-            {
-                ScopeTimer t("ForwardCollector::Decompression");
-                Compressor::Decompress(this->mpForwardPressureHostMemory, wnx, wny, wnz,
-                                       this->mMaxNT,
-                                       (double) this->mZFP_Tolerance,
-                                       this->mZFP_Parallel,
-                                       str.c_str(),
-                                       this->mZFP_IsRelative);
-            }
-        } else {
-            string str = this->mWritePath + "/temp_" + to_string(this->mTimeCounter / this->mMaxNT);
-            {
-                ScopeTimer t("IO::ReadForward");
-                bin_file_load(str.c_str(), this->mpForwardPressureHostMemory, this->mMaxNT * window_size);
-            }
-        }
+    size_t const window_size = (size_t) wnx * wny * wnz;
+    // Make sure the block is in its host staging slot, and prefetch the one before it.
+    if (!this->mIsMemoryFit && (this->mTimeCounter + 1) % this->mMaxNT == 0) {
+        this->FetchBlock(this->mTimeCounter / this->mMaxNT);
     }
     // Retrieve data from host buffer
     if ((this->mTimeCounter + 1) % this->mMaxDeviceNT == 0) {
@@ -123,7 +129,7 @@ void TwoPropagation::FetchForward() {
         int host_index = (this->mTimeCounter + 1) / this->mMaxDeviceNT - 1;
 
         Device::MemCpy(this->mpForwardPressure->GetNativePointer(),
-                       this->mpForwardPressureHostMemory +
+                       this->GetHostBlock(host_index / this->mpMaxNTRatio) +
                        (host_index % this->mpMaxNTRatio) * (this->mMaxDeviceNT * window_size),
                        this->mMaxDeviceNT * window_size * sizeof(float),
                        Device::COPY_HOST_TO_DEVICE);
@@ -141,7 +147,7 @@ void TwoPropagation::ResetGrid(bool aIsForwardRun) {
     uint wny = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     uint wnz = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
-    uint const window_size = wnx * wny * wnz;
+    size_t const window_size = (size_t) wnx * wny * wnz;
 
     if (aIsForwardRun) {
         this->mpMainGridBox->CloneMetaData(this->mpInternalGridBox);
@@ -152,7 +158,7 @@ void TwoPropagation::ResetGrid(bool aIsForwardRun) {
                                                              this->mpInternalGridBox);
 
             // save the pressure pointer for deletion afterwards
-            initial_internalGridbox_curr = mpInternalGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer();
+            this->mpInternalCurr = this->mpInternalGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer();
 
         } else {
             this->mpWaveFieldsMemoryHandler->CopyWaveFields(this->mpMainGridBox,
@@ -161,6 +167,11 @@ void TwoPropagation::ResetGrid(bool aIsForwardRun) {
 
 
         this->mTimeCounter = 0;
+        if (this->mpFileHandler != nullptr) {
+            // Previous shot blocks may still be in flight.
+            ScopeTimer t("IO::WaitForward");
+            this->mpFileHandler->WaitAll();
+        }
         if (this->mpForwardPressureHostMemory == nullptr) {
             /// Add one for empty timeframe at the start of the simulation
             /// (The first previous) since SaveForward is called before each step.
@@ -169,33 +180,45 @@ void TwoPropagation::ResetGrid(bool aIsForwardRun) {
 
             this->mMaxDeviceNT = 100; // save 100 frames in the Device memory, then reflect to host memory
 
-            this->mpForwardPressureHostMemory = (float *) mem_allocate(
-                    (sizeof(float)), this->mMaxNT * window_size, "forward_pressure");
-
-            this->mpForwardPressure = new FrameBuffer<float>();
-            this->mpForwardPressure->Allocate(window_size * this->mMaxDeviceNT);
+            this->mpForwardPressureHostMemory = this->AllocateHostMemory(this->mMaxNT);
 
             if (this->mpForwardPressureHostMemory != nullptr) {
                 this->mIsMemoryFit = true;
+                this->mHostSlots = 1;
             } else {
                 this->mIsMemoryFit = false;
-                while (this->mpForwardPressureHostMemory == nullptr) {
+                while (this->mpForwardPressureHostMemory == nullptr && this->mMaxNT > 1) {
                     this->mMaxNT = this->mMaxNT / 2;
-                    this->mpForwardPressureHostMemory = (float *) mem_allocate(
-                            (sizeof(float)), this->mMaxNT * window_size, "forward_pressure");
+                    this->mpForwardPressureHostMemory = this->AllocateHostMemory(this->mMaxNT);
                 }
 
-                mem_free(this->mpForwardPressureHostMemory);
+                if (this->mpForwardPressureHostMemory != nullptr) {
+                    mem_free(this->mpForwardPressureHostMemory);
+                }
 
                 // another iteration as a safety measure
                 this->mMaxNT = this->mMaxNT / 2;
+
+                // Split the budget into a ring of staging slots, so that a block
+                // is spilled (or prefetched) while the next one is being used.
+                // Blocks are also kept as whole multiples of the device frames.
+                this->mHostSlots = HOST_STAGING_SLOTS;
+                this->mMaxNT = std::max(this->mMaxNT / this->mHostSlots, 1ULL);
+                this->mMaxDeviceNT = std::min(this->mMaxDeviceNT, this->mMaxNT);
+                this->mMaxNT = (this->mMaxNT / this->mMaxDeviceNT) * this->mMaxDeviceNT;
+
                 this->mpForwardPressureHostMemory = (float *) mem_allocate(
-                        (sizeof(float)), this->mMaxNT * window_size, "forward_pressure");
+                        (sizeof(float)), this->mHostSlots * this->mMaxNT * window_size, "forward_pressure");
+                this->mpFileHandler = new AsyncFileHandler(this->mHostSlots);
             }
 
+            this->mpForwardPressure = new FrameBuffer<float>();
+            this->mpForwardPressure->Allocate(window_size * this->mMaxDeviceNT);
+
             mpMaxNTRatio = mMaxNT / this->mMaxDeviceNT;
 
         }
+        this->mResidentBlocks.assign(this->mHostSlots, -1);
 
         this->mpTempCurr = this->mpMainGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer();
         this->mpTempNext = this->mpMainGridBox->Get(WAVE | GB_PRSS | NEXT | DIR_Z)->GetNativePointer();
@@ -228,19 +251,17 @@ void TwoPropagation::ResetGrid(bool aIsForwardRun) {
                                      this->mpForwardPressure->GetNativePointer() + window_size);
         }
     } else {
+        if ((this->mTimeCounter + 1) % this->mMaxDeviceNT == 0) {
+            this->CommitFrame(this->mTimeCounter);
+        }
+
         Device::MemSet(this->mpTempCurr, 0.0f, window_size * sizeof(float));
         if (this->mpParameters->GetEquationOrder() == SECOND) {
             Device::MemSet(this->mpTempPrev, 0.0f, window_size * sizeof(float));
         }
 
-        for (auto const &wave_field : this->mpMainGridBox->GetWaveFields()) {
-            if (GridBox::Includes(wave_field.first, GB_PRTC)) {
-                Device::MemSet(wave_field.second->GetNativePointer(), 0.0f, window_size * sizeof(float));
-            }
-        }
-
+        // The counter is left at the last saved frame, which is the first one fetched.
         if (!this->mIsMemoryFit) {
-            this->mTimeCounter++;
             this->mpInternalGridBox->Set(WAVE | GB_PRSS | CURR | DIR_Z,
                                          this->mpMainGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer());
         } else {
@@ -250,11 +271,19 @@ void TwoPropagation::ResetGrid(bool aIsForwardRun) {
                                          window_size);
         }
 
+        // Restore the main pressure before clearing the wave fields,
+        // as it still points into the saved device frames.
         if (this->mpParameters->GetEquationOrder() == SECOND) {
             this->mpMainGridBox->Set(WAVE | GB_PRSS | PREV | DIR_Z, this->mpTempPrev);
         }
         this->mpMainGridBox->Set(WAVE | GB_PRSS | CURR | DIR_Z, this->mpTempCurr);
         this->mpMainGridBox->Set(WAVE | GB_PRSS | NEXT | DIR_Z, this->mpTempNext);
+
+        for (auto const &wave_field : this->mpMainGridBox->GetWaveFields()) {
+            if (GridBox::Includes(wave_field.first, GB_PRTC)) {
+                Device::MemSet(wave_field.second->GetNativePointer(), 0.0f, window_size * sizeof(float));
+            }
+        }
     }
 }
 
@@ -265,44 +294,39 @@ void TwoPropagation::SaveForward() {
     uint wny = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     uint wnz = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
-    uint const window_size = wnx * wny * wnz;
+    size_t const window_size = (size_t) wnx * wny * wnz;
 
     this->mTimeCounter++;
 
+    // The previous frame was transferred before its source injection.
+    if (this->mTimeCounter % this->mMaxDeviceNT == 0) {
+        this->CommitFrame(this->mTimeCounter - 1);
+    }
+
     // Transfer from Device memory to host memory
     if ((this->mTimeCounter + 1) % this->mMaxDeviceNT == 0) {
 
         int host_index = (this->mTimeCounter + 1) / this->mMaxDeviceNT - 1;
+        uint block = host_index / this->mpMaxNTRatio;
 
+        if (this->mpFileHandler != nullptr && host_index % this->mpMaxNTRatio == 0) {
+            // First frames of a new block, its slot may still be spilling an older one.
+            ScopeTimer t("IO::WaitForward");
+            this->mpFileHandler->Wait(block % this->mHostSlots);
+        }
         Device::MemCpy(
-                this->mpForwardPressureHostMemory +
+                this->GetHostBlock(block) +
                 (host_index % this->mpMaxNTRatio) * (this->mMaxDeviceNT * window_size),
                 this->mpForwardPressure->GetNativePointer(),
                 this->mMaxDeviceNT * window_size * sizeof(float),
                 Device::COPY_DEVICE_TO_HOST);
+        this->mResidentBlocks[block % this->mHostSlots] = block;
     }
 
-    // Save host memory to file
-    if ((this->mTimeCounter + 1) % this->mMaxNT == 0) {
-        if (this->mIsCompression) {
-            string str = this->mWritePath + "/temp_" + to_string(this->mTimeCounter / this->mMaxNT);
-            {
-                ScopeTimer t("ForwardCollector::Compression");;
-                Compressor::Compress(this->mpForwardPressureHostMemory, wnx, wny, wnz,
-                                     this->mMaxNT,
-                                     (double) this->mZFP_Tolerance,
-                                     this->mZFP_Parallel,
-                                     str.c_str(),
-                                     this->mZFP_IsRelative);
-            }
-        } else {
-            string str =
-                    this->mWritePath + "/temp_" + to_string(this->mTimeCounter / this->mMaxNT);
-            {
-                ScopeTimer t("IO::WriteForward");
-                bin_file_save(str.c_str(), this->mpForwardPressureHostMemory, this->mMaxNT * window_size);
-            }
-        }
+    // Spill the completed host block to file in the background,
+    // the last block stays resident for the backward propagation.
+    if (!this->mIsMemoryFit && this->mTimeCounter % this->mMaxNT == 0) {
+        this->SpillBlock((this->mTimeCounter - 1) / this->mMaxNT);
     }
 
     this->mpMainGridBox->Set(WAVE | GB_PRSS | CURR | DIR_Z,
@@ -344,7 +368,7 @@ void TwoPropagation::SetGridBox(GridBox *apGridBox) {
 
 
     framebuffer->Allocate(
-            this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize() *
+            (size_t) this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize() *
             this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize() *
             this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize(),
             mpParameters->GetHalfLength(),
@@ -368,3 +392,103 @@ void TwoPropagation::SetDependentComponents(
 GridBox *TwoPropagation::GetForwardGrid() {
     return this->mpInternalGridBox;
 }
+
+float *TwoPropagation::AllocateHostMemory(unsigned long long aSnapshots) {
+    size_t window_size = (size_t) this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+    if (this->mMemoryBudget > 0 &&
+        aSnapshots * window_size * sizeof(float) > this->mMemoryBudget * 1024 * 1024) {
+        return nullptr;
+    }
+    return (float *) mem_allocate((sizeof(float)), aSnapshots * window_size, "forward_pressure");
+}
+
+float *TwoPropagation::GetHostBlock(uint aBlock) {
+    size_t window_size = (size_t) this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+    return this->mpForwardPressureHostMemory +
+           (aBlock % this->mHostSlots) * this->mMaxNT * window_size;
+}
+
+void TwoPropagation::CommitFrame(uint aFrame) {
+    size_t window_size = (size_t) this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize() *
+                         this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+    Device::MemCpy(
+            this->GetHostBlock(aFrame / this->mMaxNT) + (aFrame % this->mMaxNT) * window_size,
+            this->mpForwardPressure->GetNativePointer() + (aFrame % this->mMaxDeviceNT) * window_size,
+            window_size * sizeof(float),
+            Device::COPY_DEVICE_TO_HOST);
+}
+
+void TwoPropagation::SpillBlock(uint aBlock) {
+    uint wnx = this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    uint wny = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
+    uint wnz = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    float *host_block = this->GetHostBlock(aBlock);
+    string path = this->mWritePath + "/temp_" + to_string(aBlock);
+    auto nt = this->mMaxNT;
+    auto is_compression = this->mIsCompression;
+    auto tolerance = (double) this->mZFP_Tolerance;
+    auto codec = this->mCodecType;
+    auto is_relative = this->mZFP_IsRelative;
+
+    this->mpFileHandler->Submit(aBlock % this->mHostSlots, [=]() {
+        if (is_compression) {
+            ScopeTimer t("ForwardCollector::Compression");
+            Compressor::Compress(host_block, wnx, wny, wnz, nt,
+                                 tolerance, codec, path.c_str(), is_relative);
+        } else {
+            ScopeTimer t("IO::WriteForward");
+            bin_file_save(path.c_str(), host_block, nt * wnx * wny * wnz);
+        }
+    });
+}
+
+void TwoPropagation::LoadBlock(uint aBlock) {
+    uint wnx = this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    uint wny = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
+    uint wnz = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    float *host_block = this->GetHostBlock(aBlock);
+    string path = this->mWritePath + "/temp_" + to_string(aBlock);
+    auto nt = this->mMaxNT;
+    auto is_compression = this->mIsCompression;
+    auto tolerance = (double) this->mZFP_Tolerance;
+    auto codec = this->mCodecType;
+    auto is_relative = this->mZFP_IsRelative;
+
+    this->mResidentBlocks[aBlock % this->mHostSlots] = aBlock;
+    this->mpFileHandler->Submit(aBlock % this->mHostSlots, [=]() {
+        if (is_compression) {
+            ScopeTimer t("ForwardCollector::Decompression");
+            Compressor::Decompress(host_block, wnx, wny, wnz, nt,
+                                   tolerance, codec, path.c_str(), is_relative);
+        } else {
+            ScopeTimer t("IO::ReadForward");
+            bin_file_load(path.c_str(), host_block, nt * wnx * wny * wnz);
+        }
+    });
+}
+
+void TwoPropagation::FetchBlock(uint aBlock) {
+    uint slot = aBlock % this->mHostSlots;
+    if (this->mResidentBlocks[slot] != aBlock) {
+        // Not prefetched, only expected if the block was evicted by a newer one.
+        this->LoadBlock(aBlock);
+    }
+    {
+        ScopeTimer t("IO::WaitForward");
+        this->mpFileHandler->Wait(slot);
+    }
+    // The slot of the block preceding this one held the block just consumed.
+    if (aBlock > 0) {
+        uint previous_block = aBlock - 1;
+        if (this->mResidentBlocks[previous_block % this->mHostSlots] != previous_block) {
+            this->LoadBlock(previous_block);
+        }
+    }
+}
@@ -17,13 +17,16 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cmath>
+
 #include <operations/components/independents/concrete/forward-collectors/boundary-saver/BoundarySaver.h>
 
 using namespace operations::components::helpers;
 using namespace operations::common;
 using namespace operations::dataunits;
 
-BoundarySaver::BoundarySaver() : mKey(0), mBoundarySize(0),
+BoundarySaver::BoundarySaver() : mKey(0), mBoundarySize(0), mIsCompressed(false),
                                  mpMainGridBox(nullptr),
                                  mpInternalGridBox(nullptr),
                                  mpComputationParameters(nullptr) {
@@ -33,27 +36,69 @@ BoundarySaver::BoundarySaver() : mKey(0), mBoundarySize(0),
 void BoundarySaver::Initialize(dataunits::GridBox::Key aActiveKey,
                                dataunits::GridBox *apInternalGridBox,
                                dataunits::GridBox *apMainGridBox,
-                               common::ComputationParameters *apParameters) {
+                               common::ComputationParameters *apParameters,
+                               bool aIsCompressed) {
     this->mKey = aActiveKey;
     this->mpInternalGridBox = apInternalGridBox;
     this->mpComputationParameters = apParameters;
     this->mpMainGridBox = apMainGridBox;
-    uint half_length = this->mpComputationParameters->GetHalfLength();
+    size_t half_length = this->mpComputationParameters->GetHalfLength();
 
-    uint nxi = this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetAxisSize();
-    uint nyi = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetAxisSize();
-    uint nzi = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetAxisSize();
+    size_t nxi = this->mpMainGridBox->GetWindowAxis()->GetXAxis().GetAxisSize();
+    size_t nyi = this->mpMainGridBox->GetWindowAxis()->GetYAxis().GetAxisSize();
+    size_t nzi = this->mpMainGridBox->GetWindowAxis()->GetZAxis().GetAxisSize();
 
     this->mBoundarySize =
             nxi * nyi * half_length * 2 + nzi * nyi * half_length * 2;
     if (nyi != 1) {
         this->mBoundarySize += nxi * nzi * half_length * 2;
     }
-    this->mBackupBoundaries.Allocate(
-            this->mBoundarySize * (this->mpMainGridBox->GetNT() + 1),
-            "Backup Boundaries");
+    size_t steps = this->mpMainGridBox->GetNT() + 1;
+    this->mIsCompressed = aIsCompressed;
+    if (this->mIsCompressed) {
+        this->mStagingBoundaries.Allocate(this->mBoundarySize, "Staging Boundaries");
+        Device::MemSet(this->mStagingBoundaries.GetNativePointer(), 0,
+                       this->mBoundarySize * sizeof(float));
+        this->mCompressedBoundaries.resize(this->mBoundarySize * steps);
+        this->mScales.resize(steps);
+    } else {
+        this->mBackupBoundaries.Allocate(this->mBoundarySize * steps, "Backup Boundaries");
+    }
 }
 
 BoundarySaver::~BoundarySaver() {
     this->mBackupBoundaries.Free();
+    this->mStagingBoundaries.Free();
+}
+
+void BoundarySaver::CompressStep(uint aStep, const float *apBoundaries) {
+    size_t size = this->mBoundarySize;
+    int16_t *compressed = this->mCompressedBoundaries.data() + aStep * size;
+
+    float peak = 0;
+#pragma omp parallel for simd reduction(max:peak)
+    for (size_t i = 0; i < size; i++) {
+        peak = std::max(peak, std::fabs(apBoundaries[i]));
+    }
+    float scale = peak / INT16_MAX;
+    float inverse = scale > 0 ? 1.0f / scale : 0.0f;
+    this->mScales[aStep] = scale;
+
+    /// Rounds to the nearest level, the peak maps to INT16_MAX so it never overflows.
+#pragma omp parallel for simd
+    for (size_t i = 0; i < size; i++) {
+        float level = apBoundaries[i] * inverse;
+        compressed[i] = (int16_t) (level + std::copysign(0.5f, level));
+    }
+}
+
+void BoundarySaver::DecompressStep(uint aStep, float *apBoundaries) {
+    size_t size = this->mBoundarySize;
+    const int16_t *compressed = this->mCompressedBoundaries.data() + aStep * size;
+    float scale = this->mScales[aStep];
+
+#pragma omp parallel for simd
+    for (size_t i = 0; i < size; i++) {
+        apBoundaries[i] = compressed[i] * scale;
+    }
 }
@@ -0,0 +1,117 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <operations/components/independents/concrete/forward-collectors/file-handler/AsyncFileHandler.hpp>
+
+using namespace std;
+using namespace operations::components::helpers;
+
+
+AsyncFileHandler::AsyncFileHandler(unsigned int aSlotCount)
+        : mPending(aSlotCount, 0),
+          mErrors(aSlotCount),
+          mTerminate(false) {
+    this->mWorker = thread(&AsyncFileHandler::Run, this);
+}
+
+AsyncFileHandler::~AsyncFileHandler() {
+    {
+        unique_lock<mutex> lock(this->mMutex);
+        this->mTerminate = true;
+    }
+    this->mTaskQueued.notify_all();
+    this->mWorker.join();
+}
+
+void AsyncFileHandler::Submit(unsigned int aSlot, function<void()> aTask) {
+    {
+        unique_lock<mutex> lock(this->mMutex);
+        this->mPending[aSlot]++;
+        this->mTasks.emplace_back(aSlot, std::move(aTask));
+    }
+    this->mTaskQueued.notify_one();
+}
+
+void AsyncFileHandler::Wait(unsigned int aSlot) {
+    unique_lock<mutex> lock(this->mMutex);
+    this->mTaskDone.wait(lock, [this, aSlot] {
+        return this->mPending[aSlot] == 0;
+    });
+    this->RethrowError(aSlot);
+}
+
+void AsyncFileHandler::WaitAll() {
+    unique_lock<mutex> lock(this->mMutex);
+    this->mTaskDone.wait(lock, [this] {
+        for (auto pending : this->mPending) {
+            if (pending != 0) {
+                return false;
+            }
+        }
+        return true;
+    });
+    for (unsigned int slot = 0; slot < this->mErrors.size(); slot++) {
+        this->RethrowError(slot);
+    }
+}
+
+bool AsyncFileHandler::IsPending(unsigned int aSlot) {
+    unique_lock<mutex> lock(this->mMutex);
+    return this->mPending[aSlot] != 0;
+}
+
+void AsyncFileHandler::Run() {
+    while (true) {
+        pair<unsigned int, function<void()>> task;
+        {
+            unique_lock<mutex> lock(this->mMutex);
+            this->mTaskQueued.wait(lock, [this] {
+                return this->mTerminate || !this->mTasks.empty();
+            });
+            /* Pending tasks are always drained before termination. */
+            if (this->mTasks.empty()) {
+                return;
+            }
+            task = std::move(this->mTasks.front());
+            this->mTasks.pop_front();
+        }
+        exception_ptr error;
+        try {
+            task.second();
+        } catch (...) {
+            error = current_exception();
+        }
+        {
+            unique_lock<mutex> lock(this->mMutex);
+            if (error && !this->mErrors[task.first]) {
+                this->mErrors[task.first] = error;
+            }
+            this->mPending[task.first]--;
+        }
+        this->mTaskDone.notify_all();
+    }
+}
+
+void AsyncFileHandler::RethrowError(unsigned int aSlot) {
+    if (this->mErrors[aSlot]) {
+        exception_ptr error = this->mErrors[aSlot];
+        this->mErrors[aSlot] = nullptr;
+        rethrow_exception(error);
+    }
+}
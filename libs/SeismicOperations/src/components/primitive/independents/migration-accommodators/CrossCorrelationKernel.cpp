@@ -41,6 +41,7 @@ using namespace operations::utils::sampling;
 CrossCorrelationKernel::CrossCorrelationKernel(bs::base::configurations::ConfigurationMap *apConfigurationMap) {
     this->mpConfigurationMap = apConfigurationMap;
     this->mCompensationType = NO_COMPENSATION;
+    this->mFused = false;
 }
 
 CrossCorrelationKernel::~CrossCorrelationKernel() {
@@ -74,6 +75,11 @@ void CrossCorrelationKernel::AcquireConfiguration() {
         Logger->Info() << "Terminating..." << '\n';
         exit(EXIT_FAILURE);
     }
+
+    this->mFused = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_FUSED_CORRELATION, this->mFused);
+    if (this->mFused) {
+        Logger->Info() << "Correlating inside the backward computation kernel when supported" << '\n';
+    }
 }
 
 void CrossCorrelationKernel::Correlate(dataunits::DataUnit *apDataUnit) {
@@ -103,6 +109,23 @@ void CrossCorrelationKernel::Correlate(dataunits::DataUnit *apDataUnit) {
     }
 }
 
+bool CrossCorrelationKernel::FuseInto(ComputationKernel *apComputationKernel,
+                                      dataunits::DataUnit *apDataUnit) {
+    if (!this->mFused) {
+        return false;
+    }
+    float *source_illumination = nullptr;
+    float *receiver_illumination = nullptr;
+    if (this->mCompensationType == COMBINED_COMPENSATION) {
+        source_illumination = this->mpSourceIllumination->GetNativePointer();
+        receiver_illumination = this->mpReceiverIllumination->GetNativePointer();
+    }
+    return apComputationKernel->FuseCorrelation((GridBox *) apDataUnit,
+                                                this->mpShotCorrelation->GetNativePointer(),
+                                                source_illumination,
+                                                receiver_illumination);
+}
+
 void CrossCorrelationKernel::Stack() {
     if (this->mpGridBox->GetAfterSamplingAxis()->GetYAxis().GetLogicalAxisSize() == 1) {
         switch (this->mCompensationType) {
@@ -155,8 +178,8 @@ void CrossCorrelationKernel::InitializeInternalElements() {
     uint ny = this->mpGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
     uint nz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
 
-    uint grid_size = nx * ny * nz;
-    uint grid_bytes = grid_size * sizeof(float);
+    size_t grid_size = (size_t) nx * ny * nz;
+    size_t grid_bytes = grid_size * sizeof(float);
 
     /* Window initialization. */
 
@@ -164,8 +187,8 @@ void CrossCorrelationKernel::InitializeInternalElements() {
     uint wny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     uint wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
-    uint window_size = wnx * wny * wnz;
-    uint window_bytes = window_size * sizeof(float);
+    size_t window_size = (size_t) wnx * wny * wnz;
+    size_t window_bytes = window_size * sizeof(float);
 
 
     mpShotCorrelation = new FrameBuffer<float>();
@@ -187,7 +210,7 @@ void CrossCorrelationKernel::InitializeInternalElements() {
 
 void CrossCorrelationKernel::ResetShotCorrelation() {
 
-    uint window_bytes = sizeof(float) *
+    size_t window_bytes = sizeof(float) *
                         this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize() *
                         this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize() *
                         this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
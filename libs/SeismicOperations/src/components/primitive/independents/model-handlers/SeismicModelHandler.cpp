@@ -118,9 +118,9 @@ GridBox *SeismicModelHandler::ReadModel(map<string, string> file_names) {
     int logical_ny = this->mpGridBox->GetAfterSamplingAxis()->GetYAxis().GetLogicalAxisSize();
     int logical_nz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetLogicalAxisSize();
 
-    int model_size = actual_nx * actual_ny * actual_nz;
-    int logical_size = logical_nx * logical_ny * logical_nz;
-    int initial_size = initial_nx * initial_ny * initial_nz;
+    size_t model_size = (size_t) actual_nx * actual_ny * actual_nz;
+    size_t logical_size = (size_t) logical_nx * logical_ny * logical_nz;
+    size_t initial_size = (size_t) initial_nx * initial_ny * initial_nz;
 
     int offset = this->mpParameters->GetBoundaryLength() + this->mpParameters->GetHalfLength();
     int offset_y = actual_ny > 1 ? this->mpParameters->GetBoundaryLength() + this->mpParameters->GetHalfLength() : 0;
@@ -164,7 +164,7 @@ GridBox *SeismicModelHandler::ReadModel(map<string, string> file_names) {
         memset(resized_host_buffer, 0, model_size * sizeof(float));
         memset(logical_host_buffer, 0, logical_size * sizeof(float));
 
-        uint index = 0;
+        size_t index = 0;
 
         if (gathers.empty()) {
             Logger->Info() << "Please provide " << param_name << " model file..." << '\n';
@@ -178,7 +178,7 @@ GridBox *SeismicModelHandler::ReadModel(map<string, string> file_names) {
             for (unsigned int k = offset_y; k < initial_ny - offset_y; k++) {
                 for (unsigned int i = offset; i < initial_nx - offset; i++) {
                     for (unsigned int j = offset; j < initial_nz - offset; j++) {
-                        index = k * initial_nx * initial_nz + j * initial_nx + i;
+                        index = (size_t) k * initial_nx * initial_nz + j * initial_nx + i;
                         parameter_host_buffer[index] = default_value;
                     }
                 }
@@ -197,8 +197,8 @@ GridBox *SeismicModelHandler::ReadModel(map<string, string> file_names) {
             for (unsigned int k = offset_y; k < initial_ny - offset_y; k++) {
                 for (unsigned int i = offset; i < initial_nx - offset; i++) {
                     for (unsigned int j = offset; j < initial_nz - offset; j++) {
-                        uint index = k * initial_nx * initial_nz + j * initial_nx + i;
-                        uint trace_index = (k - offset_y) * (initial_nx - 2 * offset) + (i - offset);
+                        size_t index = (size_t) k * initial_nx * initial_nz + j * initial_nx + i;
+                        size_t trace_index = (size_t) (k - offset_y) * (initial_nx - 2 * offset) + (i - offset);
                         float temp =
                                 parameter_host_buffer[index] =
                                         gather->GetTrace(trace_index)->GetTraceData()[j - offset];
@@ -220,8 +220,8 @@ GridBox *SeismicModelHandler::ReadModel(map<string, string> file_names) {
         for (unsigned int k = offset_y; k < logical_ny - offset_y; k++) {
             for (unsigned int j = offset; j < logical_nz - offset; j++) {
                 for (unsigned int i = offset; i < logical_nx - offset; i++) {
-                    uint actual_index = k * actual_nx * actual_nz + j * actual_nx + i;
-                    uint logical_index = k * logical_nx * logical_nz + j * logical_nx + i;
+                    size_t actual_index = (size_t) k * actual_nx * actual_nz + j * actual_nx + i;
+                    size_t logical_index = (size_t) k * logical_nx * logical_nz + j * logical_nx + i;
                     resized_host_buffer[actual_index] = logical_host_buffer[logical_index];
                 }
             }
@@ -243,6 +243,61 @@ GridBox *SeismicModelHandler::ReadModel(map<string, string> file_names) {
     return this->mpGridBox;
 }
 
+GridBox *SeismicModelHandler::ShareModel(GridBox *apModelGridBox, bool aIsSharingParameters) {
+    this->mpGridBox->SetDT(apModelGridBox->GetDT());
+    this->mpGridBox->SetInitialAxis(new Axis3D<unsigned int>(*apModelGridBox->GetInitialAxis()));
+    this->mpGridBox->SetAfterSamplingAxis(new Axis3D<unsigned int>(*apModelGridBox->GetAfterSamplingAxis()));
+    this->mpGridBox->SetWindowAxis(new Axis3D<unsigned int>(*apModelGridBox->GetWindowAxis()));
+    *this->mpGridBox->GetWindowProperties() = *apModelGridBox->GetWindowProperties();
+    this->mpGridBox->SetParameterGatherHeader(apModelGridBox->GetParameterGatherHeader());
+
+    uint initial_logical_x = this->mpGridBox->GetInitialAxis()->GetXAxis().GetLogicalAxisSize();
+    uint initial_logical_y = this->mpGridBox->GetInitialAxis()->GetYAxis().GetLogicalAxisSize();
+    uint initial_logical_z = this->mpGridBox->GetInitialAxis()->GetZAxis().GetLogicalAxisSize();
+
+    this->RegisterWaveFields(initial_logical_x, initial_logical_y, initial_logical_z);
+    this->RegisterParameters(initial_logical_x, initial_logical_y, initial_logical_z);
+
+    this->AllocateWaveFields();
+
+    uint nx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
+    uint ny = this->mpGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
+    uint nz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
+    size_t grid_size = (size_t) nx * nz * ny;
+    uint wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    uint wny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
+    uint wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+    size_t window_size = (size_t) wnx * wnz * wny;
+
+    for (auto const &parameter : this->PARAMS_NAMES) {
+        GridBox::Key param_key = parameter.first;
+        string param_name = parameter.second;
+        auto frame_buffer = apModelGridBox->Get(param_key);
+        if (!aIsSharingParameters) {
+            frame_buffer = new FrameBuffer<float>();
+            frame_buffer->Allocate(grid_size,
+                                   mpParameters->GetHalfLength(),
+                                   param_name);
+            this->mpWaveFieldsMemoryHandler->FirstTouch(frame_buffer->GetNativePointer(), this->mpGridBox);
+            Device::MemCpy(frame_buffer->GetNativePointer(),
+                           apModelGridBox->Get(param_key)->GetNativePointer(),
+                           grid_size * sizeof(float),
+                           Device::COPY_DEVICE_TO_DEVICE);
+        }
+        if (this->mpParameters->IsUsingWindow()) {
+            auto frame_buffer_window = new FrameBuffer<float>();
+            frame_buffer_window->Allocate(window_size,
+                                          mpParameters->GetHalfLength(),
+                                          param_name);
+            this->mpWaveFieldsMemoryHandler->FirstTouch(frame_buffer_window->GetNativePointer(), this->mpGridBox, true);
+            this->mpGridBox->RegisterParameter(param_key, frame_buffer, frame_buffer_window);
+        } else {
+            this->mpGridBox->RegisterParameter(param_key, frame_buffer);
+        }
+    }
+    return this->mpGridBox;
+}
+
 void SeismicModelHandler::Initialize(map<string, string> file_names) {
 
     LoggerSystem *Logger = LoggerSystem::GetInstance();
@@ -479,7 +534,7 @@ void SeismicModelHandler::AllocateWaveFields() {
     uint wny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     uint wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
-    uint window_size = wnx * wny * wnz;
+    size_t window_size = (size_t) wnx * wny * wnz;
     /// Allocating and zeroing wave fields.
     for (auto wave_field : this->WAVE_FIELDS_NAMES) {
         if (!GridBox::Includes(wave_field, NEXT)) {
@@ -506,11 +561,11 @@ void SeismicModelHandler::AllocateParameters() {
     uint nx = this->mpGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
     uint ny = this->mpGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
     uint nz = this->mpGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
-    uint grid_size = nx * nz * ny;
+    size_t grid_size = (size_t) nx * nz * ny;
     uint wnx = this->mpGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
     uint wny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     uint wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
-    uint window_size = wnx * wnz * wny;
+    size_t window_size = (size_t) wnx * wnz * wny;
 
 
     if (this->mpParameters->IsUsingWindow()) {
@@ -41,20 +41,48 @@ using namespace operations::dataunits;
 using namespace operations::utils::interpolation;
 
 
+/**
+ * @brief Frees the traces and receivers positions of the given holder.
+ */
+static void free_traces(TracesHolder *apTraces) {
+    if (apTraces->Traces != nullptr) {
+        delete apTraces->Traces;
+        mem_free(apTraces->PositionsX);
+        mem_free(apTraces->PositionsY);
+        mem_free(apTraces->ShiftsX);
+        mem_free(apTraces->ShiftsY);
+
+        apTraces->Traces = nullptr;
+        apTraces->PositionsX = nullptr;
+        apTraces->PositionsY = nullptr;
+        apTraces->ShiftsX = nullptr;
+        apTraces->ShiftsY = nullptr;
+    }
+}
+
 SeismicTraceManager::SeismicTraceManager(
         bs::base::configurations::ConfigurationMap *apConfigurationMap) {
     this->mpConfigurationMap = apConfigurationMap;
     this->mInterpolation = NONE;
+    this->mInjection = POINT_INJECTION;
+    this->mInjectionTaps = 0;
+    this->mInjectionScaled = false;
+    this->mUniqueReceivers = true;
     this->mpTracesHolder = new TracesHolder();
     this->mShotStride = 1;
+    this->mShotPrefetch = false;
+    this->mPrefetchedTotalTime = 0;
+    this->mPrefetchedShot = 0;
+    this->mPrefetchPending = false;
+    this->mPrefetchFound = false;
 }
 
 SeismicTraceManager::~SeismicTraceManager() {
-    if (this->mpTracesHolder->Traces != nullptr) {
-        delete this->mpTracesHolder->Traces;
-        mem_free(this->mpTracesHolder->PositionsX);
-        mem_free(this->mpTracesHolder->PositionsY);
-    }
+    this->DiscardPrefetch();
+    delete this->mpPrefetcher;
+    delete this->mpPrefetchedTraces;
+    delete this->mpPrefetchGridBox;
+    free_traces(this->mpTracesHolder);
     delete this->mpSeismicReader;
     delete this->mpTracesHolder;
 }
@@ -67,17 +95,42 @@ void SeismicTraceManager::AcquireConfiguration() {
                                                            interpolation);
         if (interpolation == OP_K_NONE) {
             this->mInterpolation = NONE;
+        } else if (interpolation == OP_K_LINEAR) {
+            this->mInterpolation = LINEAR;
         } else if (interpolation == OP_K_SPLINE) {
             this->mInterpolation = SPLINE;
+        } else if (interpolation == OP_K_SINC) {
+            this->mInterpolation = SINC;
+        } else {
+            Logger->Error() << "Invalid value for trace-manager->interpolation key : "
+                               "supported values [ none | linear | spline | sinc ]" << '\n';
+            Logger->Info() << "Using default trace-manager->interpolation value: none..." << '\n';
         }
     } else {
         Logger->Error() << "Invalid value for trace-manager->interpolation key : "
-                           "supported values [ none | spline ]" << '\n';
+                           "supported values [ none | linear | spline | sinc ]" << '\n';
         Logger->Info() << "Using default trace-manager->interpolation value: none..." << '\n';
     }
 
+    string injection = OP_K_POINT;
+    injection = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_RECEIVER_INJECTION,
+                                                   injection);
+    if (injection == OP_K_SINC) {
+        this->mInjection = SINC_INJECTION;
+        Logger->Info() << "Using sinc receiver injection for trace-manager" << '\n';
+    } else if (injection == OP_K_POINT) {
+        this->mInjection = POINT_INJECTION;
+    } else {
+        Logger->Error() << "Invalid value for trace-manager->receiver-injection key : "
+                           "supported values [ point | sinc ]" << '\n';
+        Logger->Info() << "Using default trace-manager->receiver-injection value: point..." << '\n';
+        this->mInjection = POINT_INJECTION;
+    }
+
     this->mShotStride = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_SHOT_STRIDE, this->mShotStride);
     Logger->Info() << "Using Shot Stride = " << this->mShotStride << " for trace-manager" << '\n';
+    this->mShotPrefetch = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_SHOT_PREFETCH,
+                                                             this->mShotPrefetch);
     // Initialize reader.
     bool header_only = false;
     header_only = this->mpConfigurationMap->GetValue(OP_K_PROPRIETIES, OP_K_HEADER_ONLY,
@@ -118,21 +171,38 @@ void SeismicTraceManager::SetGridBox(GridBox *apGridBox) {
         Logger->Error() << "No GridBox provided... Terminating..." << '\n';
         exit(EXIT_FAILURE);
     }
+    this->DiscardPrefetch();
+    delete this->mpPrefetchGridBox;
+    this->mpPrefetchGridBox = nullptr;
 }
 
 void SeismicTraceManager::ReadShot(vector<string> file_names,
                                    uint shot_number,
                                    string sort_key) {
     LoggerSystem *Logger = LoggerSystem::GetInstance();
-    if (this->mpTracesHolder->Traces != nullptr) {
-        delete this->mpTracesHolder->Traces;
-        mem_free(this->mpTracesHolder->PositionsX);
-        mem_free(this->mpTracesHolder->PositionsY);
-
-        this->mpTracesHolder->Traces = nullptr;
-        this->mpTracesHolder->PositionsX = nullptr;
-        this->mpTracesHolder->PositionsY = nullptr;
+    free_traces(this->mpTracesHolder);
+    if (this->mPrefetchPending && this->mPrefetchedShot == shot_number) {
+        {
+            ScopeTimer t("IO::WaitPrefetchedShot");
+            this->mpPrefetcher->Wait(0);
+        }
+        this->mPrefetchPending = false;
+        if (!this->mPrefetchFound) {
+            Logger->Error() << "Didn't find a suitable file to read shot ID "
+                            << shot_number
+                            << " from..." << '\n';
+            exit(EXIT_FAILURE);
+        }
+        Logger->Info() << "Using prefetched trace for shot ID "
+                       << shot_number << '\n';
+        std::swap(*this->mpTracesHolder, *this->mpPrefetchedTraces);
+        this->mpSourcePoint = this->mPrefetchedSourcePoint;
+        this->mTotalTime = this->mPrefetchedTotalTime;
+        *this->mpGridBox->GetWindowStart() = *this->mpPrefetchGridBox->GetWindowStart();
+        this->mpGridBox->SetNT(this->mpPrefetchGridBox->GetNT());
+        return;
     }
+    this->DiscardPrefetch();
     Gather *gather;
     {
         ScopeTimer t("IO::ReadSelectedShotFromSegyFile");
@@ -159,6 +229,51 @@ void SeismicTraceManager::ReadShot(vector<string> file_names,
     delete gather;
 }
 
+void SeismicTraceManager::PrefetchShot(vector<string> file_names,
+                                       uint shot_number,
+                                       string sort_key) {
+    if (!this->mShotPrefetch) {
+        return;
+    }
+    this->DiscardPrefetch();
+    if (this->mpPrefetcher == nullptr) {
+        this->mpPrefetcher = new helpers::AsyncFileHandler(1);
+        this->mpPrefetchedTraces = new TracesHolder();
+    }
+    if (this->mpPrefetchGridBox == nullptr) {
+        this->mpPrefetchGridBox = new GridBox();
+        this->mpGridBox->CloneMetaData(this->mpPrefetchGridBox);
+    }
+    this->mPrefetchedShot = shot_number;
+    this->mPrefetchPending = true;
+    /* Only touches the prefetch members, the reader is otherwise idle during the migration. */
+    this->mpPrefetcher->Submit(0, [this, shot_number]() {
+        Gather *gather = this->mpSeismicReader->Read({std::to_string(shot_number)});
+        this->mPrefetchFound = gather != nullptr;
+        if (gather != nullptr) {
+            utils::io::ParseGatherToTraces(gather,
+                                           &this->mPrefetchedSourcePoint,
+                                           this->mpPrefetchedTraces,
+                                           &this->mpPrefetchedTraces->PositionsX,
+                                           &this->mpPrefetchedTraces->PositionsY,
+                                           this->mpPrefetchGridBox,
+                                           this->mpParameters,
+                                           &this->mPrefetchedTotalTime);
+            delete gather;
+        }
+    });
+}
+
+void SeismicTraceManager::DiscardPrefetch() {
+    if (this->mPrefetchPending) {
+        this->mpPrefetcher->Wait(0);
+        this->mPrefetchPending = false;
+    }
+    if (this->mpPrefetchedTraces != nullptr) {
+        free_traces(this->mpPrefetchedTraces);
+    }
+}
+
 void SeismicTraceManager::PreprocessShot() {
     Interpolator::Interpolate(this->mpTracesHolder,
                               this->mpGridBox->GetNT(),
@@ -180,6 +295,7 @@ void SeismicTraceManager::PreprocessShot() {
     Device::MemCpy(mpDPositionsY.GetNativePointer(), this->mpTracesHolder->PositionsY,
                    this->mpTracesHolder->TraceSizePerTimeStep * sizeof(uint),
                    Device::COPY_HOST_TO_DEVICE);
+    this->PrepareInjection();
 }
 
 void SeismicTraceManager::ApplyIsotropicField() {
@@ -102,7 +102,7 @@ void SeismicTraceWriter::StartRecordingInstance(TracesHolder &aTracesHolder) {
     uint wny = this->mpGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
     uint wnz = this->mpGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
 
-    uint const window_size = wnx * wny * wnz;
+    size_t const window_size = (size_t) wnx * wny * wnz;
     for (auto const &wave_field : this->mpGridBox->GetWaveFields()) {
         Device::MemSet(wave_field.second->GetNativePointer(), 0.0f, window_size * sizeof(float));
     }
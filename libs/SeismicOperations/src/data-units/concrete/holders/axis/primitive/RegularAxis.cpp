@@ -87,6 +87,15 @@ template int
 RegularAxis<unsigned long int>::AddComputationalPadding(int aDirection,
                                                         unsigned long int aComputationalPadding);
 
+template int
+RegularAxis<unsigned short int>::ResizeAxis(unsigned short int aAxisSize);
+
+template int
+RegularAxis<unsigned int>::ResizeAxis(unsigned int aAxisSize);
+
+template int
+RegularAxis<unsigned long int>::ResizeAxis(unsigned long int aAxisSize);
+
 template unsigned short int
 RegularAxis<unsigned short int>::GetLogicalAxisSize();
 
@@ -208,6 +217,17 @@ int RegularAxis<T>::AddComputationalPadding(int aDirection, T aComputationalPadd
     return 1;
 }
 
+template<typename T>
+int RegularAxis<T>::ResizeAxis(T aAxisSize) {
+    T capacity = this->GetAxisCapacity();
+    if (aAxisSize > capacity) {
+        aAxisSize = capacity;
+    }
+    this->mAxisSize = aAxisSize;
+    this->mRearComputationalPadding = capacity - aAxisSize;
+    return 1;
+}
+
 template<typename T>
 T RegularAxis<T>::GetLogicalAxisSize() {
     return this->mAxisSize +
@@ -0,0 +1,137 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#if defined(USING_OMP)
+#include <omp.h>
+#endif
+
+#include <bs/base/logger/concrete/LoggerSystem.hpp>
+#include <bs/timer/api/cpp/BSTimer.hpp>
+
+#include <operations/engines/concrete/ConcurrentRTMEngine.hpp>
+
+using namespace std;
+using namespace bs::base::logger;
+using namespace bs::timer;
+using namespace operations::engines;
+using namespace operations::dataunits;
+
+
+ConcurrentRTMEngine::ConcurrentRTMEngine(vector<RTMEngine *> aWorkers)
+        : mWorkers(std::move(aWorkers)) {
+    this->mpCallbacks = nullptr;
+    this->mpParameters = nullptr;
+    int threads = 1;
+#if defined(USING_OMP)
+    threads = omp_get_max_threads();
+#endif
+    this->mThreadsPerWorker = max(1, threads / (int) this->mWorkers.size());
+}
+
+ConcurrentRTMEngine::~ConcurrentRTMEngine() {
+    for (auto worker : this->mWorkers) {
+        delete worker;
+    }
+}
+
+vector<uint>
+ConcurrentRTMEngine::GetValidShots() {
+    /* Every worker indexes the traces its own trace manager reads. */
+    for (size_t worker = 1; worker < this->mWorkers.size(); worker++) {
+        this->mWorkers[worker]->GetValidShots();
+    }
+    return this->mWorkers.front()->GetValidShots();
+}
+
+GridBox *
+ConcurrentRTMEngine::Initialize() {
+    LoggerSystem *Logger = LoggerSystem::GetInstance();
+    Logger->Info() << "Concurrent shots per node\t: " << this->mWorkers.size()
+                   << " (" << this->mThreadsPerWorker << " threads each)" << '\n';
+    this->mGridBoxes.clear();
+    this->mGridBoxes.push_back(this->mWorkers.front()->Initialize());
+    for (size_t worker = 1; worker < this->mWorkers.size(); worker++) {
+        this->mGridBoxes.push_back(this->mWorkers[worker]->Initialize(this->mWorkers.front(),
+                                                                      this->mGridBoxes.front()));
+    }
+    return this->mGridBoxes.front();
+}
+
+void
+ConcurrentRTMEngine::MigrateShots(vector<uint> shot_numbers, GridBox *apGridBox) {
+    this->mGridBoxes.front() = apGridBox;
+#if defined(USING_OMP)
+    int threads_count = omp_get_max_threads();
+#endif
+    atomic<size_t> next_shot(0);
+    auto worker_loop = [&](size_t aWorker) {
+#if defined(USING_OMP)
+        omp_set_num_threads(this->mThreadsPerWorker);
+#endif
+        size_t index;
+        while ((index = next_shot.fetch_add(1)) < shot_numbers.size()) {
+            this->mWorkers[aWorker]->MigrateShots(shot_numbers[index],
+                                                  this->mGridBoxes[aWorker]);
+        }
+    };
+
+    size_t workers_count = min(this->mWorkers.size(), shot_numbers.size());
+    vector<thread> workers;
+    for (size_t worker = 1; worker < workers_count; worker++) {
+        workers.emplace_back(worker_loop, worker);
+    }
+    worker_loop(0);
+    for (auto &t : workers) {
+        t.join();
+    }
+#if defined(USING_OMP)
+    omp_set_num_threads(threads_count);
+#endif
+}
+
+MigrationData *
+ConcurrentRTMEngine::Finalize(GridBox *apGridBox) {
+    ScopeTimer t("Engine::ReduceWorkers");
+    this->mGridBoxes.front() = apGridBox;
+    MigrationData *md = this->mWorkers.front()->Finalize(apGridBox);
+    size_t size = (size_t) md->GetGridSize(X_AXIS) *
+                  md->GetGridSize(Y_AXIS) *
+                  md->GetGridSize(Z_AXIS) *
+                  md->GetGatherDimension();
+    for (size_t worker = 1; worker < this->mWorkers.size(); worker++) {
+        MigrationData *worker_md = this->mWorkers[worker]->Finalize(this->mGridBoxes[worker]);
+        auto results = md->GetResults();
+        auto worker_results = worker_md->GetResults();
+        for (size_t ir = 0; ir < results.size(); ir++) {
+            float *data = results[ir]->GetData();
+            const float *worker_data = worker_results[ir]->GetData();
+            for (size_t i = 0; i < size; i++) {
+                data[i] += worker_data[i];
+            }
+            delete[] worker_data;
+        }
+        delete worker_md;
+    }
+    this->mGridBoxes.clear();
+    return md;
+}
@@ -257,6 +257,7 @@ void ModellingEngine::MigrateShots(uint shot_id, GridBox *apGridBox) {
     }
     {
         ScopeTimer timer("BoundaryManager::ReExtendModel");
+        this->mpConfiguration->GetBoundaryManager()->SetShotId(shot_id);
         this->mpConfiguration->GetBoundaryManager()->ReExtendModel();
     }
 #ifndef NDEBUG
@@ -292,12 +293,12 @@ void ModellingEngine::Forward(GridBox *apGridBox, uint shot_id) {
     // Do prequel source injection before main forward propagation.
     for (int it = -timesteps; it < 1; it++) {
         {
-            ScopeTimer timer("SourceInjector::ApplySource");
+            HandleTimer timer(this->mApplySourceTimer);
             this->mpConfiguration->GetSourceInjector()->ApplySource(it);
         }
 
         {
-            ScopeTimer timer("Forward::ComputationKernel::Step");
+            HandleTimer timer(this->mForwardStepTimer);
             this->mpConfiguration->GetComputationKernel()->Step();
         }
 #ifndef NDEBUG
@@ -307,11 +308,11 @@ void ModellingEngine::Forward(GridBox *apGridBox, uint shot_id) {
     uint onePercent = apGridBox->GetNT() / 100 + 1;
     for (uint t = 1; t < apGridBox->GetNT(); t++) {
         {
-            ScopeTimer timer("SourceInjector::ApplySource");
+            HandleTimer timer(this->mApplySourceTimer);
             this->mpConfiguration->GetSourceInjector()->ApplySource(t);
         }
         {
-            ScopeTimer timer("Forward::ComputationKernel::Step");
+            HandleTimer timer(this->mForwardStepTimer);
             this->mpConfiguration->GetComputationKernel()->Step();
         }
 
@@ -322,7 +323,7 @@ void ModellingEngine::Forward(GridBox *apGridBox, uint shot_id) {
 #endif
         /// If not in the debug mode (release mode) we use call the RecordTrace()
         {
-            ScopeTimer timer("TraceWriter::RecordTrace");
+            HandleTimer timer(this->mRecordTraceTimer);
             this->mpConfiguration->GetTraceWriter()->RecordTrace(t);
         }
         /**
@@ -17,6 +17,8 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+
 #include <bs/base/logger/concrete/LoggerSystem.hpp>
 #include <bs/base/memory/MemoryManager.hpp>
 #include <bs/timer/api/cpp/BSTimer.hpp>
@@ -96,7 +98,86 @@ RTMEngine::Initialize() {
 #ifndef NDEBUG
     this->mpCallbacks->BeforeInitialization(this->mpParameters);
 #endif
+    this->SetupComponents();
+
+    GridBox *gb;
+    {
+        ScopeTimer timer("ModelHandler::ReadModel");
+        gb = this->mpConfiguration->GetModelHandler()->ReadModel(this->mpConfiguration->GetModelFiles());
+    }
+    /// Set the GridBox with the parameters given to the constructor for
+    /// all needed functions.
+    for (auto const &component :
+            this->mpConfiguration->GetComponents()->ExtractValues()) {
+        component->SetGridBox(gb);
+    }
+    {
+        ScopeTimer timer("ModelHandler::PreprocessModel");
+        this->mpConfiguration->GetComputationKernel()->PreprocessModel();
+    }
+    {
+        ScopeTimer timer("BoundaryManager::ExtendModel");
+        this->mpConfiguration->GetBoundaryManager()->ExtendModel();
+    }
 
+#ifndef NDEBUG
+    this->mpCallbacks->AfterInitialization(gb);
+#endif
+    this->mpConfiguration->GetComputationKernel()->SetBoundaryManager(
+            this->mpConfiguration->GetBoundaryManager());
+
+    gb->Report(VERBOSE);
+    return gb;
+}
+
+GridBox *
+RTMEngine::Initialize(RTMEngine *apModelEngine, GridBox *apModelGridBox) {
+    ScopeTimer t("Engine::Initialization");
+#ifndef NDEBUG
+    this->mpCallbacks->BeforeInitialization(this->mpParameters);
+#endif
+    this->SetupComponents();
+
+    /// The window and blocks may have been adapted to the model while reading it.
+    auto model_parameters = apModelEngine->mpParameters;
+    this->mpParameters->SetBlockX(model_parameters->GetBlockX());
+    this->mpParameters->SetBlockZ(model_parameters->GetBlockZ());
+    this->mpParameters->SetLeftWindow(model_parameters->GetLeftWindow());
+    this->mpParameters->SetRightWindow(model_parameters->GetRightWindow());
+    this->mpParameters->SetFrontWindow(model_parameters->GetFrontWindow());
+    this->mpParameters->SetBackWindow(model_parameters->GetBackWindow());
+    this->mpParameters->SetDepthWindow(model_parameters->GetDepthWindow());
+
+    /// The full model is only read by the shots when they are migrated
+    /// inside a window that is not extended randomly.
+    bool is_sharing_parameters = this->mpParameters->IsUsingWindow() &&
+                                 !this->mpConfiguration->GetBoundaryManager()->IsReExtendingFullModel();
+    GridBox *gb;
+    {
+        ScopeTimer timer("ModelHandler::ShareModel");
+        gb = this->mpConfiguration->GetModelHandler()->ShareModel(apModelGridBox, is_sharing_parameters);
+    }
+    for (auto const &component :
+            this->mpConfiguration->GetComponents()->ExtractValues()) {
+        component->SetGridBox(gb);
+    }
+    /// The shared model is already preprocessed, extending it again only
+    /// sets up the boundary state of this engine.
+    {
+        ScopeTimer timer("BoundaryManager::ExtendModel");
+        this->mpConfiguration->GetBoundaryManager()->ExtendModel();
+    }
+
+#ifndef NDEBUG
+    this->mpCallbacks->AfterInitialization(gb);
+#endif
+    this->mpConfiguration->GetComputationKernel()->SetBoundaryManager(
+            this->mpConfiguration->GetBoundaryManager());
+    return gb;
+}
+
+void
+RTMEngine::SetupComponents() {
     /// Set computation parameters to all components with
     /// parameters given to the constructor for all needed functions.
     for (auto const &component :
@@ -134,52 +215,33 @@ RTMEngine::Initialize() {
 
     this->mpParameters->SetMaxPropagationFrequency(
             this->mpConfiguration->GetSourceInjector()->GetMaxFrequency());
-    GridBox *gb;
-    {
-        ScopeTimer timer("ModelHandler::ReadModel");
-        gb = this->mpConfiguration->GetModelHandler()->ReadModel(this->mpConfiguration->GetModelFiles());
-    }
-    /// Set the GridBox with the parameters given to the constructor for
-    /// all needed functions.
-    for (auto const &component :
-            this->mpConfiguration->GetComponents()->ExtractValues()) {
-        component->SetGridBox(gb);
-    }
-    {
-        ScopeTimer timer("ModelHandler::PreprocessModel");
-        this->mpConfiguration->GetComputationKernel()->PreprocessModel();
-    }
-    {
-        ScopeTimer timer("BoundaryManager::ExtendModel");
-        this->mpConfiguration->GetBoundaryManager()->ExtendModel();
-    }
-
-#ifndef NDEBUG
-    this->mpCallbacks->AfterInitialization(gb);
-#endif
-    this->mpConfiguration->GetComputationKernel()->SetBoundaryManager(
-            this->mpConfiguration->GetBoundaryManager());
-
-    gb->Report(VERBOSE);
-    return gb;
 }
 
 void
 RTMEngine::MigrateShots(vector<uint> shot_numbers, GridBox *apGridBox) {
-    for (auto shot_number : shot_numbers) {
-        this->MigrateShots(shot_number, apGridBox);
+    for (size_t index = 0; index < shot_numbers.size(); index++) {
+        const uint *next_shot_id = nullptr;
+        if (index + 1 < shot_numbers.size()) {
+            next_shot_id = &shot_numbers[index + 1];
+        }
+        this->MigrateShot(shot_numbers[index], next_shot_id, apGridBox);
     }
 }
 
 void
 RTMEngine::MigrateShots(uint shot_id, GridBox *apGridBox) {
+    this->MigrateShot(shot_id, nullptr, apGridBox);
+}
+
+void
+RTMEngine::MigrateShot(uint aShotId, const uint *apNextShotId, GridBox *apGridBox) {
     ScopeTimer t("Engine::MigrateShot");
 
     this->mpConfiguration->GetMigrationAccommodator()->ResetShotCorrelation();
     {
         ScopeTimer timer("TraceManager::ReadShot");
         this->mpConfiguration->GetTraceManager()->ReadShot(
-                this->mpConfiguration->GetTraceFiles(), shot_id, this->mpConfiguration->GetSortKey());
+                this->mpConfiguration->GetTraceFiles(), aShotId, this->mpConfiguration->GetSortKey());
     }
 
 #ifndef NDEBUG
@@ -198,6 +260,11 @@ RTMEngine::MigrateShots(uint shot_id, GridBox *apGridBox) {
             this->mpConfiguration->GetTraceManager()->GetTracesHolder());
 #endif
 
+    if (apNextShotId != nullptr) {
+        this->mpConfiguration->GetTraceManager()->PrefetchShot(
+                this->mpConfiguration->GetTraceFiles(), *apNextShotId, this->mpConfiguration->GetSortKey());
+    }
+
     this->mpConfiguration->GetSourceInjector()->SetSourcePoint(
             this->mpConfiguration->GetTraceManager()->GetSourcePoint());
 
@@ -207,6 +274,7 @@ RTMEngine::MigrateShots(uint shot_id, GridBox *apGridBox) {
     }
     {
         ScopeTimer timer("BoundaryManager::ReExtendModel");
+        this->mpConfiguration->GetBoundaryManager()->SetShotId(aShotId);
         this->mpConfiguration->GetBoundaryManager()->ReExtendModel();
     }
     {
@@ -285,11 +353,11 @@ RTMEngine::Forward(GridBox *apGridBox) {
     // Do prequel source injection before main forward propagation.
     for (int it = -time_steps; it < 1; it++) {
         {
-            ScopeTimer timer("SourceInjector::ApplySource");
+            HandleTimer timer(this->mApplySourceTimer);
             this->mpConfiguration->GetSourceInjector()->ApplySource(it);
         }
         {
-            ScopeTimer timer("Forward::ComputationKernel::Step");
+            HandleTimer timer(this->mForwardStepTimer);
             this->mpConfiguration->GetComputationKernel()->Step();
         }
 #ifndef NDEBUG
@@ -297,23 +365,41 @@ RTMEngine::Forward(GridBox *apGridBox) {
 #endif
     }
     uint one_percent = apGridBox->GetNT() / 100 + 1;
+    int block_t = this->mpParameters->GetBlockT();
+    int cut_off = this->mpConfiguration->GetSourceInjector()->GetCutOffTimeStep();
     for (int it = 1; it < apGridBox->GetNT(); it++) {
-        {
-            ScopeTimer timer("ForwardCollector::SaveForward");
-            this->mpConfiguration->GetForwardCollector()->SaveForward();
-        }
-        {
-            ScopeTimer timer("SourceInjector::ApplySource");
-            this->mpConfiguration->GetSourceInjector()->ApplySource(it);
+        // Once the source is done, time steps not observed by the
+        // forward collector are advanced at once.
+        int steps = 1;
+        if (block_t > 1 && it >= cut_off) {
+            steps = min({block_t, (int) apGridBox->GetNT() - it,
+                         (int) this->mpConfiguration->GetForwardCollector()->GetSkippableSteps()});
         }
-        {
-            ScopeTimer timer("Forward::ComputationKernel::Step");
-            this->mpConfiguration->GetComputationKernel()->Step();
+        if (steps > 1) {
+            this->mpConfiguration->GetForwardCollector()->SkipForward(steps);
+            {
+                HandleTimer timer(this->mForwardStepTimer);
+                this->mpConfiguration->GetComputationKernel()->AdvanceSteps(steps);
+            }
+            it += steps - 1;
+        } else {
+            {
+                HandleTimer timer(this->mSaveForwardTimer);
+                this->mpConfiguration->GetForwardCollector()->SaveForward();
+            }
+            {
+                HandleTimer timer(this->mApplySourceTimer);
+                this->mpConfiguration->GetSourceInjector()->ApplySource(it);
+            }
+            {
+                HandleTimer timer(this->mForwardStepTimer);
+                this->mpConfiguration->GetComputationKernel()->Step();
+            }
         }
 #ifndef NDEBUG
         this->mpCallbacks->AfterForwardStep(apGridBox, it);
 #endif
-        if ((it % one_percent) == 0) {
+        if ((it % one_percent) < steps) {
             print_progress(((float) it) / apGridBox->GetNT(), "Forward Propagation");
         }
     }
@@ -328,34 +414,46 @@ RTMEngine::Backward(GridBox *apGridBox) {
     this->mpConfiguration->GetComputationKernel()->SetMode(
             components::KERNEL_MODE::ADJOINT);
 
+    /*
+     * The forward state is fetched before the backward step, so that a kernel
+     * taking the imaging condition over correlates each computed pressure
+     * against it while still in cache.
+     */
+    auto computation_kernel = this->mpConfiguration->GetComputationKernel();
+    auto forward_collector = this->mpConfiguration->GetForwardCollector();
+    bool fused = this->mpConfiguration->GetMigrationAccommodator()->FuseInto(
+            computation_kernel, forward_collector->GetForwardGrid());
+
     uint onePercent = apGridBox->GetNT() / 100 + 1;
     for (uint it = apGridBox->GetNT() - 1; it > 0; it--) {
         {
-            ScopeTimer timer("TraceManager::ApplyTraces");
+            HandleTimer timer(this->mApplyTracesTimer);
             this->mpConfiguration->GetTraceManager()->ApplyTraces(it);
         }
         {
-            ScopeTimer timer("Backward::ComputationKernel::Step");
-            this->mpConfiguration->GetComputationKernel()->Step();
+            HandleTimer timer(this->mFetchForwardTimer);
+            forward_collector->FetchForward();
         }
         {
-            ScopeTimer timer("ForwardCollector::FetchForward");
-            this->mpConfiguration->GetForwardCollector()->FetchForward();
+            HandleTimer timer(this->mBackwardStepTimer);
+            computation_kernel->Step();
         }
 #ifndef NDEBUG
-        this->mpCallbacks->AfterFetchStep(
-                this->mpConfiguration->GetForwardCollector()->GetForwardGrid(), it);
+        this->mpCallbacks->AfterFetchStep(forward_collector->GetForwardGrid(), it);
         this->mpCallbacks->AfterBackwardStep(apGridBox, it);
 #endif
-        {
-            ScopeTimer timer("Correlation::Correlate");
+        if (!fused) {
+            HandleTimer timer(this->mCorrelateTimer);
             this->mpConfiguration->GetMigrationAccommodator()->Correlate(
-                    this->mpConfiguration->GetForwardCollector()->GetForwardGrid());
+                    forward_collector->GetForwardGrid());
         }
         if ((it % onePercent) == 0) {
             print_progress(((float) (apGridBox->GetNT() - it)) / apGridBox->GetNT(), "Backward Propagation");
         }
     }
+    if (fused) {
+        computation_kernel->FuseCorrelation(nullptr, nullptr, nullptr, nullptr);
+    }
     print_progress(1, "Backward Propagation");
     logger->Info() << " ... Done" << '\n';
 }
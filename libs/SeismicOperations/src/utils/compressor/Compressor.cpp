@@ -17,8 +17,14 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <vector>
 
 #include <bs/base/logger/concrete/LoggerSystem.hpp>
 #include <bs/timer/api/cpp/BSTimer.hpp>
@@ -31,514 +37,543 @@
 
 #endif
 
-#define ZFP_MAX_PAR_BLOCKS 512
 #define MIN_BLOCK_SIZE 4
-
+/// Marks the beginning of a compressed snapshots container.
+#define CONTAINER_MAGIC 0x43535342u
+/// Number of values sharing a step in the block floating point codec.
+#define BFP_BLOCK_SIZE 32
+/// Number of values of a snapshot compressed as one unit by the block floating point codec.
+#define BFP_UNIT_SIZE 16384
+/// Bound of the quantized values, keeping their deltas and zigzag codes within 32 bits.
+#define BFP_MAX_LEVEL 536870912.0f
+/// Width marking a block stored as raw floats.
+#define BFP_RAW_WIDTH 0xFF
+
+using namespace std;
 using namespace bs::timer;
 using namespace bs::base::logger;
 using namespace operations::utils::compressors;
 
-void apply_zfp(float *array, int nx, int ny, int nz, int nt,
-               FILE *file, int decompress, bool zfp_is_relative, double tolerance);
+/**
+ * @brief
+ * Header of a compressed snapshots container. It is followed by the offsets
+ * table, holding the start of each unit payload (and the end of the last one)
+ * relative to the end of the table, then by the payloads themselves.
+ * <br>
+ * A unit is a whole snapshot for the first codec, a slab of the slowest
+ * dimension of a snapshot for the second one and a run of BFP_UNIT_SIZE values
+ * of a snapshot for the block floating point one, so any snapshot can be read
+ * and decompressed on its own.
+ */
+struct ContainerHeader {
+    uint32_t magic;
+    uint32_t codec;
+    uint32_t nt;
+    uint32_t units;
+};
 
 /**
- * @brief Compresses multidimensional array using ZFP algorithm.
+ * @brief Header of a block floating point block, followed by its bit packed
+ * zigzag coded deltas, or by its raw values for BFP_RAW_WIDTH.
  */
-void compress_zfp(float *array, int nx, int ny, int nz, int nt,
-                  double tolerance, FILE *file, bool zfp_is_relative);
+struct BlockHeader {
+    int16_t exponent;
+    uint8_t width;
+} __attribute__((packed));
 
 /**
- * @brief Decompresses multidimensional array using ZFP algorithm.
+ * @brief Number of units a snapshot is split into for the given codec.
  */
-void decompress_zfp(float *array, int nx, int ny, int nz, int nt,
-                    double tolerance, FILE *file, bool zfp_is_relative);
+static uint32_t get_units_count(unsigned int codecType, int nx, int ny, int nz) {
+    if (codecType == Compressor::BLOCK_FLOATING_POINT) {
+        size_t size = (size_t) nx * ny * nz;
+        return (size + BFP_UNIT_SIZE - 1) / BFP_UNIT_SIZE;
+    }
+    if (codecType == Compressor::ZFP_SNAPSHOTS) {
+        return 1;
+    }
+    int slowest = ny > 1 ? ny : nz;
+    return (slowest + MIN_BLOCK_SIZE - 1) / MIN_BLOCK_SIZE;
+}
 
 /**
- * @brief Compresses multidimensional array.
+ * @brief Step exponent of a block floating point block with the given maximum
+ * magnitude, or INT16_MIN if the block should be stored as raw floats.
  */
-void compress_normal(FILE *file, const float *data, int nx, int ny, int nz, int nt);
+static int get_block_exponent(float aMaxMagnitude, double tolerance, bool aIsRelative) {
+    if (!(aMaxMagnitude <= FLT_MAX)) {
+        return INT16_MIN;
+    }
+    int exponent;
+    if (aIsRelative) {
+        if (tolerance < 1 || tolerance > 28) {
+            return INT16_MIN;
+        }
+        if (aMaxMagnitude == 0) {
+            return 0;
+        }
+        exponent = ilogbf(aMaxMagnitude) + 1 - (int) tolerance;
+    } else {
+        if (!(tolerance > 0)) {
+            return INT16_MIN;
+        }
+        // Rounding to a step no larger than twice the tolerance bounds the error by it.
+        exponent = (int) floor(log2(2 * tolerance));
+    }
+    exponent = min(max(exponent, -149), 127);
+    if (ldexpf(aMaxMagnitude, -exponent) >= BFP_MAX_LEVEL) {
+        return INT16_MIN;
+    }
+    return exponent;
+}
 
 /**
- * @brief Decompresses multidimensional array.
+ * @brief Encodes the given block into the output, returning the number of bytes written.
  */
-void decompress_normal(FILE *file, float *data, int nx, int ny, int nz, int nt);
+static size_t encode_block(const float *apValues, int aCount, double tolerance,
+                           bool aIsRelative, unsigned char *apOutput) {
+    float max_magnitude = 0;
+    int invalid = 0;
+#pragma omp simd reduction(max:max_magnitude) reduction(|:invalid)
+    for (int i = 0; i < aCount; i++) {
+        float magnitude = fabsf(apValues[i]);
+        invalid |= !(magnitude <= FLT_MAX);
+        max_magnitude = max(max_magnitude, magnitude);
+    }
+    int exponent = get_block_exponent(invalid ? INFINITY : max_magnitude, tolerance, aIsRelative);
+
+    BlockHeader header{};
+    unsigned char *payload = apOutput + sizeof(BlockHeader);
+    if (exponent == INT16_MIN) {
+        header.exponent = 0;
+        header.width = BFP_RAW_WIDTH;
+        memcpy(apOutput, &header, sizeof(BlockHeader));
+        memcpy(payload, apValues, aCount * sizeof(float));
+        return sizeof(BlockHeader) + aCount * sizeof(float);
+    }
 
+    int32_t levels[BFP_BLOCK_SIZE];
+    uint32_t codes[BFP_BLOCK_SIZE];
+    // The values are scaled directly, as 2^-exponent overflows for steps below 2^-127.
+#pragma omp simd
+    for (int i = 0; i < aCount; i++) {
+        levels[i] = (int32_t) rintf(ldexpf(apValues[i], -exponent));
+    }
+    uint32_t used_bits = 0;
+#pragma omp simd reduction(|:used_bits)
+    for (int i = 0; i < aCount; i++) {
+        int32_t delta = levels[i] - (i > 0 ? levels[i - 1] : 0);
+        codes[i] = ((uint32_t) delta << 1) ^ (uint32_t) (delta >> 31);
+        used_bits |= codes[i];
+    }
+    int width = used_bits == 0 ? 0 : 32 - __builtin_clz(used_bits);
 
-void Compressor::Compress(float *array, int nx, int ny, int nz, int nt, double tolerance,
-                          unsigned int codecType, const char *filename,
-                          bool zfp_is_relative) {
-    LoggerSystem *Logger = LoggerSystem::GetInstance();
-    FILE *compressed_file = fopen(filename, "wb");
-    if (compressed_file == nullptr) {
-        Logger->Error() << "Opening compressed file" << filename << "to write to failed..." << '\n';
-        exit(EXIT_FAILURE);
+    header.exponent = (int16_t) exponent;
+    header.width = (uint8_t) width;
+    memcpy(apOutput, &header, sizeof(BlockHeader));
+    if (width == 0) {
+        return sizeof(BlockHeader);
     }
-#ifdef ZFP_COMPRESSION
-    switch (codecType) {
-        case 1:
-            apply_zfp(array, nx, ny, nz, nt, compressed_file, 0, zfp_is_relative, tolerance);
-            break;
-        case 2:
-            compress_zfp(array, nx, ny, nz, nt, tolerance, compressed_file, zfp_is_relative);
-            break;
-        default:
-            Logger->Error() << "***  Invalid codec Type, Terminating" << '\n';
-            exit(EXIT_FAILURE);
+    uint64_t bits = 0;
+    int pending = 0;
+    size_t written = 0;
+    for (int i = 0; i < aCount; i++) {
+        bits |= (uint64_t) codes[i] << pending;
+        pending += width;
+        while (pending >= 8) {
+            payload[written++] = (unsigned char) bits;
+            bits >>= 8;
+            pending -= 8;
+        }
     }
-#else
-    compress_normal(compressed_file, array, nx, ny, nz, nt);
-#endif
-    fclose(compressed_file);
+    if (pending > 0) {
+        payload[written++] = (unsigned char) bits;
+    }
+    return sizeof(BlockHeader) + written;
 }
 
-void Compressor::Decompress(float *array, int nx, int ny, int nz, int nt, double tolerance,
-                            unsigned int codecType, const char *filename,
-                            bool zfp_is_relative) {
-    LoggerSystem *Logger = LoggerSystem::GetInstance();
-    FILE *compressed_file = fopen(filename, "rb");
-    if (compressed_file == nullptr) {
-        Logger->Error() << "Opening compressed file " << filename << " to read from failed..." << '\n';
-        exit(EXIT_FAILURE);
+/**
+ * @brief Decodes a block from the input, returning the number of bytes consumed.
+ */
+static size_t decode_block(const unsigned char *apInput, int aCount, float *apValues) {
+    BlockHeader header{};
+    memcpy(&header, apInput, sizeof(BlockHeader));
+    const unsigned char *payload = apInput + sizeof(BlockHeader);
+    if (header.width == BFP_RAW_WIDTH) {
+        memcpy(apValues, payload, aCount * sizeof(float));
+        return sizeof(BlockHeader) + aCount * sizeof(float);
     }
-#ifdef ZFP_COMPRESSION
-    switch (codecType) {
-        case 1:
-            apply_zfp(array, nx, ny, nz, nt, compressed_file, 1, zfp_is_relative, tolerance);
-            break;
-        case 2:
-            decompress_zfp(array, nx, ny, nz, nt, tolerance, compressed_file, zfp_is_relative);
-            break;
-        default:
-            Logger->Error() << "***Invalid codec Type, Terminating" << '\n';
-            exit(EXIT_FAILURE);
+    if (header.width == 0) {
+        memset(apValues, 0, aCount * sizeof(float));
+        return sizeof(BlockHeader);
+    }
+
+    int width = header.width;
+    uint64_t mask = (1ull << width) - 1;
+    int32_t levels[BFP_BLOCK_SIZE];
+    uint64_t bits = 0;
+    int pending = 0;
+    size_t read = 0;
+    int32_t level = 0;
+    for (int i = 0; i < aCount; i++) {
+        while (pending < width) {
+            bits |= (uint64_t) payload[read++] << pending;
+            pending += 8;
+        }
+        auto code = (uint32_t) (bits & mask);
+        bits >>= width;
+        pending -= width;
+        level += (int32_t) (code >> 1) ^ -(int32_t) (code & 1);
+        levels[i] = level;
+    }
+    float step = ldexpf(1.0f, header.exponent);
+#pragma omp simd
+    for (int i = 0; i < aCount; i++) {
+        apValues[i] = (float) levels[i] * step;
+    }
+    return sizeof(BlockHeader) + read;
+}
+
+/**
+ * @brief Returns the values of a block floating point unit of the given snapshot.
+ */
+static float *get_bfp_unit(float *snapshot, int nx, int ny, int nz,
+                           uint32_t aUnit, size_t *apCount) {
+    size_t size = (size_t) nx * ny * nz;
+    size_t start = (size_t) aUnit * BFP_UNIT_SIZE;
+    *apCount = min((size_t) BFP_UNIT_SIZE, size - start);
+    return snapshot + start;
+}
+
+static void *compress_bfp_unit(float *snapshot, int nx, int ny, int nz, uint32_t aUnit,
+                               double tolerance, bool zfp_is_relative, size_t *apSize) {
+    size_t count;
+    float *values = get_bfp_unit(snapshot, nx, ny, nz, aUnit, &count);
+    size_t blocks = (count + BFP_BLOCK_SIZE - 1) / BFP_BLOCK_SIZE;
+    auto buffer = (unsigned char *) malloc(blocks * sizeof(BlockHeader) + count * sizeof(float));
+    size_t size = 0;
+    for (size_t start = 0; start < count; start += BFP_BLOCK_SIZE) {
+        int block_count = (int) min((size_t) BFP_BLOCK_SIZE, count - start);
+        size += encode_block(values + start, block_count, tolerance, zfp_is_relative, buffer + size);
+    }
+    *apSize = size;
+    return realloc(buffer, size);
+}
+
+static void decompress_bfp_unit(float *snapshot, int nx, int ny, int nz, uint32_t aUnit,
+                                const char *apPayload, size_t aSize) {
+    size_t count;
+    float *values = get_bfp_unit(snapshot, nx, ny, nz, aUnit, &count);
+    auto input = (const unsigned char *) apPayload;
+    size_t read = 0;
+    for (size_t start = 0; start < count; start += BFP_BLOCK_SIZE) {
+        int block_count = (int) min((size_t) BFP_BLOCK_SIZE, count - start);
+        read += decode_block(input + read, block_count, values + start);
+    }
+    if (read != aSize) {
+        LoggerSystem::GetInstance()->Error() << "Decompression failed" << '\n';
+        exit(EXIT_FAILURE);
     }
-#else
-    decompress_normal(compressed_file, array, nx, ny, nz, nt);
-#endif
-    fclose(compressed_file);
 }
 
-void apply_zfp(float *array, int nx, int ny, int nz, int nt,
-               FILE *file, int decompress, bool zfp_is_relative, double tolerance) {
 #ifdef ZFP_COMPRESSION
-    auto logger = LoggerSystem::GetInstance();
-    /// Compressed stream
-    zfp_stream *zfp;
-    /// Storage for compressed stream
-    void *buffer;
-    /// Byte size of compressed buffer
-    size_t buffer_size;
-    /// Bit stream to write to or read from
-    bitstream *stream;
-    /// Array meta data
-    zfp_field *size_field;
-    /// Array scalar type
-    zfp_type type;
-
-    type = zfp_type_float;
-
-    // Allocate meta data for a compressed stream
-    zfp = zfp_stream_open(nullptr);
-
-    // Set compression mode and parameters via one of three functions
-
-    /*
-     * zfp_stream_set_rate(zfp, rate, type, 3, 0);
-     * zfp_stream_set_precision(zfp, precision, type);
-     */
 
+/**
+ * @brief Sets up the ZFP field of a unit of the given snapshot, with the
+ * dimensions ordered from the fastest to the slowest in memory.
+ */
+static zfp_field *make_unit_field(float *snapshot, int nx, int ny, int nz,
+                                  uint32_t aUnit, uint32_t aUnits) {
+    size_t plane = (size_t) nx * (ny > 1 ? nz : 1);
+    int slowest = ny > 1 ? ny : nz;
+    int start = aUnits == 1 ? 0 : aUnit * MIN_BLOCK_SIZE;
+    int length = aUnits == 1 ? slowest : min(MIN_BLOCK_SIZE, slowest - start);
+    float *data = snapshot + start * plane;
+    if ((nx > 1) && (ny > 1) && (nz > 1)) {
+        return zfp_field_3d(data, zfp_type_float, nx, nz, length);
+    } else if ((nx > 1) && (nz > 1)) {
+        return zfp_field_2d(data, zfp_type_float, nx, length);
+    }
+    return zfp_field_1d(data, zfp_type_float, plane * length);
+}
+
+static zfp_stream *open_stream(double tolerance, bool zfp_is_relative) {
+    zfp_stream *zfp = zfp_stream_open(nullptr);
     if (zfp_is_relative) {
         // Concerned with relative error (precision)
         zfp_stream_set_precision(zfp, tolerance);
     } else {
         // Concerned with absolute error (accuracy)
-        /*
-         * /// Old ZFP version
-         * zfp_stream_set_accuracy(zfp[block], tolerance, type);
-         */
         zfp_stream_set_accuracy(zfp, tolerance);
     }
-    // Chooses between 1D, 2D or 3D representation
-    if ((nx > 1) && (ny > 1) && (nz > 1)) {
-        // Handle 3D
-        size_field = zfp_field_3d(array, type, nx, ny, nz);
-    } else if ((nx > 1) && (nz > 1)) {
-        // Handle 2D
-        size_field = zfp_field_2d(array, type, nx, nz);
-    } else {
-        // Handle 1D
-        size_field = zfp_field_1d(array, type, nz);
-    }
-    // Allocate buffer for compressed data
-    buffer_size = zfp_stream_maximum_size(zfp, size_field);
-    zfp_field_free(size_field);
-    buffer = malloc(buffer_size);
+    return zfp;
+}
 
-    // Associate bit stream with allocated buffer
-    stream = stream_open(buffer, buffer_size);
+/**
+ * @brief Compresses a unit into a newly allocated buffer fitting its payload.
+ */
+static void *compress_zfp_unit(zfp_field *field, double tolerance, bool zfp_is_relative, size_t *apSize) {
+    zfp_stream *zfp = open_stream(tolerance, zfp_is_relative);
+    size_t capacity = zfp_stream_maximum_size(zfp, field);
+    void *buffer = malloc(capacity);
+    bitstream *stream = stream_open(buffer, capacity);
     zfp_stream_set_bit_stream(zfp, stream);
-    int pressure_size = nx * ny * nz;
-    float *off_arr;
-    for (int i = 0; i < nt; i++) {
-        off_arr = &array[i * pressure_size];
-
-        // Array meta data
-        zfp_field *field;
-        // Byte size of compressed stream
-        size_t zfp_size;
-        // Allocate meta-data for the 3D array a[nz][ny][nx]
-        ElasticTimer compressor_timer("Compressor::ZFP::SetupProperties");
-        compressor_timer.Start();
-        // To choose between 1d,2d or 3d representation
-        if ((nx > 1) && (ny > 1) && (nz > 1)) {// handle 3d
-            field = zfp_field_3d(off_arr, type, nx, ny, nz);
-        } else if ((nx > 1) && (nz > 1)) {// handle 2d
-            field = zfp_field_2d(off_arr, type, nx, nz);
-        } else {// handle 1d
-            field = zfp_field_1d(off_arr, type, nz);
-        }
-        zfp_stream_rewind(zfp);
-        compressor_timer.Stop();
-        /* Compress or decompress entire array. */
-        if (decompress) {
-            /* Read compressed stream and decompress array. */
-            {
-                ScopeTimer t("Compressor::ZFP::IO::Decompression");
-                fread(&zfp_size, 1, sizeof(zfp_size), file);
-                fread(buffer, 1, zfp_size, file);
-            }
-            {
-                ScopeTimer t("Compressor::ZFP::Decompress");
-                if (!zfp_decompress(zfp, field)) {
-                    logger->Error() << "decompression failed" << '\n';
-                    exit(EXIT_FAILURE);
-                }
-            }
-        } else {
-            /* Compress array and output compressed stream. */
-            ElasticTimer compress_timer("Compressor::ZFP::Compress");
-            compressor_timer.Start();
-            zfp_size = zfp_compress(zfp, field);
-            compressor_timer.Stop();
-            if (!zfp_size) {
-                logger->Error() << "compression failed" << '\n';
-                exit(EXIT_FAILURE);
-            } else {
-                {
-                    ScopeTimer t("Compressor::ZFP::IO::Compression");
-                    fwrite(&zfp_size, 1, sizeof(zfp_size), file);
-                    fwrite(buffer, 1, zfp_size, file);
-                }
-            }
-        }
-        zfp_field_free(field);
+    zfp_stream_rewind(zfp);
+    *apSize = zfp_compress(zfp, field);
+    zfp_stream_close(zfp);
+    stream_close(stream);
+    if (*apSize == 0) {
+        LoggerSystem::GetInstance()->Error() << "Compression failed" << '\n';
+        exit(EXIT_FAILURE);
     }
+    return realloc(buffer, *apSize);
+}
 
-    /*
-     * Clean up
-     */
-
+static void decompress_zfp_unit(zfp_field *field, double tolerance, bool zfp_is_relative,
+                                void *apPayload, size_t aSize) {
+    zfp_stream *zfp = open_stream(tolerance, zfp_is_relative);
+    bitstream *stream = stream_open(apPayload, aSize);
+    zfp_stream_set_bit_stream(zfp, stream);
+    zfp_stream_rewind(zfp);
+    bool success = zfp_decompress(zfp, field) != 0;
     zfp_stream_close(zfp);
     stream_close(stream);
-    free(buffer);
-#endif
+    if (!success) {
+        LoggerSystem::GetInstance()->Error() << "Decompression failed" << '\n';
+        exit(EXIT_FAILURE);
+    }
 }
 
-void compress_zfp(float *array, int nx, int ny, int nz, int nt,
-                  double tolerance, FILE *file,
-                  bool zfp_is_relative) {
-#ifdef ZFP_COMPRESSION
-    LoggerSystem *Logger = LoggerSystem::GetInstance();
-    unsigned int total_blocks = 0;
-
-    // Calculating the number of blocks to be written, a block
-    // will consist of a number of rows in nx dimension
-    total_blocks = (nz + MIN_BLOCK_SIZE - 1) / MIN_BLOCK_SIZE;
-
-    int pressure_size = nx * ny * nz;
-
-    /// Array scalar type
-    zfp_type type;
-    /// Array meta data
-    auto **field = (zfp_field **) malloc(sizeof(zfp_field *) * total_blocks);
-    /// Compressed stream
-    auto **zfp = (zfp_stream **) malloc(sizeof(zfp_stream *) * total_blocks);
-    /// Storage for compressed stream
-    void **buffer = (void **) malloc(sizeof(void *) * total_blocks);
-    /// Byte size of compressed buffer
-    auto *buffer_size = (size_t *) malloc(sizeof(size_t) * total_blocks);
-    /// Bit stream to write to or read from
-    auto **stream = (bitstream **) malloc(sizeof(bitstream *) * total_blocks);
-    /// Byte size of compressed stream
-    auto *zfp_size = (size_t *) malloc(sizeof(size_t) * total_blocks);
-    int *block_dim = (int *) malloc(sizeof(int) * total_blocks);
-    type = zfp_type_float;
-
-#pragma omp parallel for schedule(static)
-    for (unsigned int block = 0; block < total_blocks; block++) {
-        block_dim[block] = ((block < (total_blocks - 1)) ? MIN_BLOCK_SIZE : nz % MIN_BLOCK_SIZE);
-        if (block_dim[block] == 0) {
-            block_dim[block] = MIN_BLOCK_SIZE;
-        }
-        // Determine the size of a block before compression
-        if ((nx > 1) && (ny > 1) && (nz > 1)) { // handle 3d
-            field[block] = zfp_field_3d(&array[block * MIN_BLOCK_SIZE * ny * nx], type, nx, ny, block_dim[block]);
-        } else { // handle 2d
-            field[block] = zfp_field_2d(&array[block * MIN_BLOCK_SIZE * nx], type, nx, block_dim[block]);
-        }
-        // Allocate meta data for a compressed stream.
-        zfp[block] = zfp_stream_open(nullptr);
-
-        if (zfp_is_relative) { // we are concerned with relative error (precision)
-            zfp_stream_set_precision(zfp[block], tolerance);
-        } else {
-            // We are concerned with absolute error (accuracy)
-            // zfp_stream_set_accuracy(zfp[block], tolerance, type);
-            // Old ZFP version
-            zfp_stream_set_accuracy(zfp[block], tolerance); // New ZFP version
-        }
-
-        // Allocate buffer for compressed data
-        buffer_size[block] = zfp_stream_maximum_size(zfp[block], field[block]);
-        buffer[block] = malloc(buffer_size[block]);
-
-        // Associate bit stream with allocated buffer
-        stream[block] = stream_open(buffer[block], buffer_size[block]);
-        zfp_stream_set_bit_stream(zfp[block], stream[block]);
-    }
-
-    /*
-     * Clean up
-     */
-
-    for (int block = 0; block < total_blocks; block++) {
-        zfp_field_free(field[block]);
-    }
-    float *off_arr;
-    for (int i = 0; i < nt; i++) {
-        off_arr = &array[i * pressure_size];
-        ElasticTimer compress_timer("Compressor::ZFP::Compress");
-        compress_timer.Start();
-
-        /*
-         * Loop on blocks, each is compressed and then written
-         */
-
-#pragma omp parallel for schedule(static)
-        for (unsigned int block = 0; block < total_blocks; block++) {
-            // Determine the size of a block before compression
-            if ((nx > 1) && (ny > 1) && (nz > 1)) { // handle 3d
-                field[block] = zfp_field_3d(&off_arr[block * MIN_BLOCK_SIZE * ny * nx], type, nx, ny, block_dim[block]);
-            } else { // handle 2d
-                field[block] = zfp_field_2d(&off_arr[block * MIN_BLOCK_SIZE * nx], type, nx, block_dim[block]);
-            }
-            zfp_stream_rewind(zfp[block]);
-
-            // Compress entire arrayCompressor::ZFP::Compress
-            zfp_size[block] = zfp_compress(zfp[block], field[block]);
-            if (!zfp_size[block]) {
-                Logger->Error() << "compression failed" << '\n';
-                exit(EXIT_FAILURE);
-            }
-        }
-        compress_timer.Stop();
+#endif
 
-        ElasticTimer io_compressor_timer("Compressor::ZFP::IO::Compression");
-        io_compressor_timer.Start();
+/**
+ * @brief Compresses a unit of the given snapshot with the given codec into a
+ * newly allocated buffer fitting its payload.
+ */
+static void *compress_unit(float *snapshot, int nx, int ny, int nz, uint32_t aUnit, uint32_t aUnits,
+                           double tolerance, unsigned int codecType, bool zfp_is_relative, size_t *apSize) {
+    if (codecType == Compressor::BLOCK_FLOATING_POINT) {
+        return compress_bfp_unit(snapshot, nx, ny, nz, aUnit, tolerance, zfp_is_relative, apSize);
+    }
+#ifdef ZFP_COMPRESSION
+    zfp_field *field = make_unit_field(snapshot, nx, ny, nz, aUnit, aUnits);
+    void *payload = compress_zfp_unit(field, tolerance, zfp_is_relative, apSize);
+    zfp_field_free(field);
+    return payload;
+#else
+    return nullptr;
+#endif
+}
 
-        /*
-         * Write Block Sizes serially
-         */
+/**
+ * @brief Decompresses a unit of the given snapshot with the given codec from its payload.
+ */
+static void decompress_unit(float *snapshot, int nx, int ny, int nz, uint32_t aUnit, uint32_t aUnits,
+                            double tolerance, unsigned int codecType, bool zfp_is_relative,
+                            char *apPayload, size_t aSize) {
+    if (codecType == Compressor::BLOCK_FLOATING_POINT) {
+        decompress_bfp_unit(snapshot, nx, ny, nz, aUnit, apPayload, aSize);
+        return;
+    }
+#ifdef ZFP_COMPRESSION
+    zfp_field *field = make_unit_field(snapshot, nx, ny, nz, aUnit, aUnits);
+    decompress_zfp_unit(field, tolerance, zfp_is_relative, apPayload, aSize);
+    zfp_field_free(field);
+#endif
+}
 
-        for (int block = 0; block < total_blocks; block++) {
-            fwrite(&zfp_size[block], sizeof(zfp_size[block]), 1, file); // write the size of the block after compression
-            fwrite(buffer[block], 1, zfp_size[block], file); // write the actual compressed data
+/**
+ * @brief Compresses all units of all snapshots in parallel, then writes
+ * them into a container.
+ */
+static void compress_container(float *array, int nx, int ny, int nz, int nt,
+                               double tolerance, unsigned int codecType,
+                               FILE *file, bool zfp_is_relative) {
+    size_t snapshot_size = (size_t) nx * ny * nz;
+    ContainerHeader header = {CONTAINER_MAGIC, codecType, (uint32_t) nt,
+                              get_units_count(codecType, nx, ny, nz)};
+    size_t units_count = (size_t) nt * header.units;
+
+    vector<void *> payloads(units_count);
+    vector<size_t> sizes(units_count);
+    {
+        ScopeTimer t("Compressor::Container::Compress");
+#pragma omp parallel for schedule(dynamic)
+        for (size_t unit = 0; unit < units_count; unit++) {
+            payloads[unit] = compress_unit(array + (unit / header.units) * snapshot_size,
+                                           nx, ny, nz, unit % header.units, header.units,
+                                           tolerance, codecType, zfp_is_relative, &sizes[unit]);
         }
-        io_compressor_timer.Stop();
-
-        /*
-         * Clean up
-         */
+    }
 
-        for (int block = 0; block < total_blocks; block++) {
-            zfp_field_free(field[block]);
+    vector<uint64_t> offsets(units_count + 1, 0);
+    for (size_t unit = 0; unit < units_count; unit++) {
+        offsets[unit + 1] = offsets[unit] + sizes[unit];
+    }
+    {
+        ScopeTimer t("Compressor::Container::IO::Compression");
+        fwrite(&header, sizeof(header), 1, file);
+        fwrite(offsets.data(), sizeof(uint64_t), offsets.size(), file);
+        for (size_t unit = 0; unit < units_count; unit++) {
+            fwrite(payloads[unit], 1, sizes[unit], file);
+            free(payloads[unit]);
         }
     }
-    for (int block = 0; block < total_blocks; block++) {
-        zfp_stream_close(zfp[block]);
-        stream_close(stream[block]);
-        free(buffer[block]);
-    }
-    free(field);
-    free(zfp);
-    free(buffer);
-    free(buffer_size);
-    free(stream);
-    free(zfp_size);
-    free(block_dim);
-#endif
 }
 
-void decompress_zfp(float *array, int nx, int ny, int nz, int nt,
-                    double tolerance, FILE *file,
-                    bool zfp_is_relative) {
-#ifdef ZFP_COMPRESSION
+/**
+ * @brief Reads the header and offsets table of a container, checking
+ * they match the expected snapshots.
+ */
+static vector<uint64_t> read_offsets(FILE *file, int nx, int ny, int nz, int nt, unsigned int codecType) {
+    ContainerHeader header{};
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        header.magic != CONTAINER_MAGIC || header.codec != codecType ||
+        header.nt != (uint32_t) nt || header.units != get_units_count(codecType, nx, ny, nz)) {
+        LoggerSystem::GetInstance()->Error() << "Invalid compressed snapshots container" << '\n';
+        exit(EXIT_FAILURE);
+    }
+    vector<uint64_t> offsets((size_t) nt * header.units + 1);
+    if (fread(offsets.data(), sizeof(uint64_t), offsets.size(), file) != offsets.size()) {
+        LoggerSystem::GetInstance()->Error() << "Truncated compressed snapshots container" << '\n';
+        exit(EXIT_FAILURE);
+    }
+    return offsets;
+}
 
-    LoggerSystem *Logger = LoggerSystem::GetInstance();
-    unsigned int totalBlocks = 0;
-
-    // Calculating the number of blocks to be written, a block
-    // will consist of a number of rows in nx dimension
-    totalBlocks = (nz + MIN_BLOCK_SIZE - 1) / MIN_BLOCK_SIZE;
-
-    int pressure_size = nx * ny * nz;
-    /// Array scalar type
-    zfp_type type;
-    /// Array meta data
-    auto **field = (zfp_field **) malloc(sizeof(zfp_field *) * totalBlocks);
-    /// Compressed stream
-    auto **zfp = (zfp_stream **) malloc(sizeof(zfp_stream *) * totalBlocks);
-    /// Storage for compressed stream
-    void **buffer = (void **) malloc(sizeof(void *) * totalBlocks);
-    /// Byte size of compressed buffer
-    auto *buffer_size = (size_t *) malloc(sizeof(size_t) * totalBlocks);
-    /// Bit stream to write to or read from
-    auto **stream = (bitstream **) malloc(sizeof(bitstream *) * totalBlocks);
-    /// Byte size of compressed stream
-    auto *zfp_size = (size_t *) malloc(sizeof(size_t) * totalBlocks);
-    int *block_dim = (int *) malloc(sizeof(int) * totalBlocks);
-    type = zfp_type_float;
-
-#pragma omp parallel for schedule(static)
-    for (unsigned int block = 0; block < totalBlocks; block++) {
-        block_dim[block] = ((block < (totalBlocks - 1)) ? MIN_BLOCK_SIZE : nz % MIN_BLOCK_SIZE);
-        if (block_dim[block] == 0) {
-            block_dim[block] = MIN_BLOCK_SIZE;
-        }
-        // Determine the size of a block before compression
-        if ((nx > 1) && (ny > 1) && (nz > 1)) {
-            // Handle 3D
-            field[block] = zfp_field_3d(&array[block * MIN_BLOCK_SIZE * ny * nx], type, nx, ny, block_dim[block]);
-        } else {
-            // Handle 2D
-            field[block] = zfp_field_2d(&array[block * MIN_BLOCK_SIZE * nx], type, nx, block_dim[block]);
+/**
+ * @brief Reads and decompresses the snapshots [aFirst, aFirst + aCount) of a
+ * container into the given array, all their units in parallel.
+ */
+static void decompress_container(float *array, int nx, int ny, int nz, int nt,
+                                 int aFirst, int aCount,
+                                 double tolerance, unsigned int codecType,
+                                 FILE *file, bool zfp_is_relative) {
+    size_t snapshot_size = (size_t) nx * ny * nz;
+    uint32_t units = get_units_count(codecType, nx, ny, nz);
+    char *payload;
+    vector<uint64_t> offsets;
+    size_t first_unit = (size_t) aFirst * units;
+    size_t units_count = (size_t) aCount * units;
+    {
+        ScopeTimer t("Compressor::Container::IO::Decompression");
+        offsets = read_offsets(file, nx, ny, nz, nt, codecType);
+        off_t table_end = ftello(file);
+        size_t payload_size = offsets[first_unit + units_count] - offsets[first_unit];
+        payload = (char *) malloc(payload_size);
+        fseeko(file, table_end + (off_t) offsets[first_unit], SEEK_SET);
+        if (fread(payload, 1, payload_size, file) != payload_size) {
+            LoggerSystem::GetInstance()->Error() << "Truncated compressed snapshots container" << '\n';
+            exit(EXIT_FAILURE);
         }
-        // Allocate meta data for a compressed stream
-        zfp[block] = zfp_stream_open(nullptr);
-
-        if (zfp_is_relative) {
-            // We are concerned with relative error (precision)
-            zfp_stream_set_precision(zfp[block], tolerance);
-        } else {
-            // We are concerned with absolute error (accuracy)
-            // zfp_stream_set_accuracy(zfp[block], tolerance, type); // Old ZFP
-            // version
-            zfp_stream_set_accuracy(zfp[block], tolerance); // New ZFP version
+    }
+    {
+        ScopeTimer t("Compressor::Container::Decompress");
+#pragma omp parallel for schedule(dynamic)
+        for (size_t unit = 0; unit < units_count; unit++) {
+            size_t index = first_unit + unit;
+            decompress_unit(array + (unit / units) * snapshot_size,
+                            nx, ny, nz, unit % units, units,
+                            tolerance, codecType, zfp_is_relative,
+                            payload + (offsets[index] - offsets[first_unit]),
+                            offsets[index + 1] - offsets[index]);
         }
-
-        //  Allocate buffer for compressed data
-        buffer_size[block] = zfp_stream_maximum_size(zfp[block], field[block]);
-        buffer[block] = malloc(buffer_size[block]);
-
-        // Associate bit stream with allocated buffer
-        stream[block] = stream_open(buffer[block], buffer_size[block]);
-        zfp_stream_set_bit_stream(zfp[block], stream[block]);
     }
+    free(payload);
+}
 
-    /*
-     * Clean up
-     */
+/**
+ * @brief Writes the snapshots as is.
+ */
+static void compress_normal(FILE *file, const float *data, int nx, int ny, int nz, int nt) {
+    size_t size = (size_t) nx * ny * nz;
+    ScopeTimer t("Compressor::Normal::Compress");
+    fwrite(data, sizeof(float), size * nt, file);
+}
+
+/**
+ * @brief Reads the snapshots [aFirst, aFirst + aCount) as is.
+ */
+static void decompress_normal(FILE *file, float *data, int nx, int ny, int nz, int aFirst, int aCount) {
+    size_t size = (size_t) nx * ny * nz;
+    ScopeTimer t("Compressor::Normal::Decompress");
+    fseeko(file, (off_t) (aFirst * size * sizeof(float)), SEEK_SET);
+    fread(data, sizeof(float), size * aCount, file);
+}
 
-    for (int block = 0; block < totalBlocks; block++) {
-        zfp_field_free(field[block]);
+/**
+ * @brief Checks the codec is a known one, terminating otherwise.
+ */
+static void check_codec(unsigned int codecType) {
+    if (codecType == Compressor::BLOCK_FLOATING_POINT) {
+        return;
+    }
+#ifdef ZFP_COMPRESSION
+    if (codecType != Compressor::ZFP_SNAPSHOTS && codecType != Compressor::ZFP_SLABS) {
+        LoggerSystem::GetInstance()->Error() << "***  Invalid codec Type, Terminating" << '\n';
+        exit(EXIT_FAILURE);
     }
-    float *off_arr;
-    for (int i = 0; i < nt; i++) {
-        off_arr = &array[i * pressure_size];
-        ElasticTimer io_decompress_timer("Compressor::ZFP::IO::Decompression");
-        io_decompress_timer.Start();
-        /*
-         * Read Block Sizes in serial
-         */
+#endif
+}
 
-        for (int block = 0; block < totalBlocks; block++) {
-            // Write the size of the block after compression
-            fread(&zfp_size[block], sizeof(zfp_size[block]), 1, file);
-            // Write the actual compressed data
-            fread(buffer[block], 1, zfp_size[block], file);
-        }
-        io_decompress_timer.Stop();
-
-        ElasticTimer decompress_timer("Compressor::ZFP::Decompress");
-        decompress_timer.Start();
-
-        /*
-         * Loop on blocks, each is compressed and then written
-         */
-
-#pragma omp parallel for schedule(static)
-        for (unsigned int block = 0; block < totalBlocks; block++) {
-            // Determine the size of a block before compression
-            if ((nx > 1) && (ny > 1) && (nz > 1)) {
-                // Handle 3D
-                field[block] = zfp_field_3d(&off_arr[block * MIN_BLOCK_SIZE * ny * nx], type, nx, ny, block_dim[block]);
-            } else {
-                // Handle 2D
-                field[block] = zfp_field_2d(&off_arr[block * MIN_BLOCK_SIZE * nx], type, nx, block_dim[block]);
-            }
-            zfp_stream_rewind(zfp[block]);
-
-            // Decompress entire array
-            if (!zfp_decompress(zfp[block], field[block])) {
-                Logger->Error() << "Decompression failed" << '\n';
-                exit(EXIT_FAILURE);
-            }
-        }
-        decompress_timer.Stop();
+/**
+ * @brief Whether the given codec writes a container, the ZFP ones fall back to
+ * raw snapshots without ZFP.
+ */
+static bool is_container(unsigned int codecType) {
+#ifdef ZFP_COMPRESSION
+    return true;
+#else
+    return codecType == Compressor::BLOCK_FLOATING_POINT;
+#endif
+}
 
-        /*
-         * Clean up
-         */
+static FILE *open_file(const char *filename, const char *mode) {
+    FILE *file = fopen(filename, mode);
+    if (file == nullptr) {
+        LoggerSystem::GetInstance()->Error() << "Opening compressed file " << filename << " failed..." << '\n';
+        exit(EXIT_FAILURE);
+    }
+    return file;
+}
 
-        for (int block = 0; block < totalBlocks; block++) {
-            zfp_field_free(field[block]);
-        }
+void Compressor::Compress(float *array, int nx, int ny, int nz, int nt, double tolerance,
+                          unsigned int codecType, const char *filename,
+                          bool zfp_is_relative) {
+    check_codec(codecType);
+    FILE *compressed_file = open_file(filename, "wb");
+    if (is_container(codecType)) {
+        compress_container(array, nx, ny, nz, nt, tolerance, codecType, compressed_file, zfp_is_relative);
+    } else {
+        compress_normal(compressed_file, array, nx, ny, nz, nt);
     }
-    for (int block = 0; block < totalBlocks; block++) {
-        zfp_stream_close(zfp[block]);
-        stream_close(stream[block]);
-        free(buffer[block]);
-    }
-    free(field);
-    free(zfp);
-    free(buffer);
-    free(buffer_size);
-    free(stream);
-    free(zfp_size);
-    free(block_dim);
-#endif
+    fclose(compressed_file);
 }
 
-void compress_normal(FILE *file, const float *data, int nx, int ny, int nz, int nt) {
-    int size = nx * ny * nz;
-    const float *offset_arr;
-    {
-        ScopeTimer t("Compressor::Normal::Compress");
-        for (int i = 0; i < nt; i++) {
-            offset_arr = &data[i * size];
-            fwrite(offset_arr, 1, size * sizeof(float), file);
-        }
+void Compressor::Decompress(float *array, int nx, int ny, int nz, int nt, double tolerance,
+                            unsigned int codecType, const char *filename,
+                            bool zfp_is_relative) {
+    check_codec(codecType);
+    FILE *compressed_file = open_file(filename, "rb");
+    if (is_container(codecType)) {
+        decompress_container(array, nx, ny, nz, nt, 0, nt, tolerance, codecType, compressed_file,
+                             zfp_is_relative);
+    } else {
+        decompress_normal(compressed_file, array, nx, ny, nz, 0, nt);
     }
+    fclose(compressed_file);
 }
 
-void decompress_normal(FILE *file, float *data, int nx, int ny, int nz, int nt) {
-    int size = nx * ny * nz;
-    float *offset_arr;
-    {
-        ScopeTimer t("Compressor::Normal::Decompress");
-        for (int i = 0; i < nt; i++) {
-            offset_arr = &data[i * size];
-            fread(offset_arr, 1, size * sizeof(float), file);
-        }
+void Compressor::DecompressSnapshot(float *array, int nx, int ny, int nz, int nt, int time_step,
+                                    double tolerance, unsigned int codecType, const char *filename,
+                                    bool zfp_is_relative) {
+    check_codec(codecType);
+    FILE *compressed_file = open_file(filename, "rb");
+    if (is_container(codecType)) {
+        decompress_container(array, nx, ny, nz, nt, time_step, 1, tolerance, codecType, compressed_file,
+                             zfp_is_relative);
+    } else {
+        decompress_normal(compressed_file, array, nx, ny, nz, time_step, 1);
     }
+    fclose(compressed_file);
 }
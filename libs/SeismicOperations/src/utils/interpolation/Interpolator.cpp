@@ -17,12 +17,15 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 #include <operations/utils/interpolation/Interpolator.hpp>
 #include <bs/base/logger/concrete/LoggerSystem.hpp>
 #include <bs/base/memory/MemoryManager.hpp>
 
+using namespace std;
 using namespace bs::base::logger;
 using namespace bs::base::memory;
 using namespace operations::utils::interpolation;
@@ -48,62 +51,223 @@ void interpolate_3D(const float *old_grid,
                     int bound_length,
                     int half_length);
 
+/// Half width of the windowed sinc, in recorded samples.
+#define SINC_RADIUS     8
+/// Traces handled together by a thread while solving for the splines.
+#define TRACES_BLOCK    256
+
+
+/**
+ * @brief Allocates the resampled traces buffer, or returns nullptr
+ * if the traces do not need to be upsampled.
+ */
+static FrameBuffer<float> *allocate_resampled(TracesHolder *apTraceHolder, uint actual_nt) {
+    LoggerSystem *Logger = LoggerSystem::GetInstance();
+    if (actual_nt <= apTraceHolder->SampleNT) {
+        Logger->Error() << "Interpolation terminated..." << '\n';
+        Logger->Info() << "Actual size should be at least equal sample size..." << '\n';
+        return nullptr;
+    }
+    auto resampled = new FrameBuffer<float>();
+    resampled->Allocate((size_t) actual_nt * apTraceHolder->TraceSizePerTimeStep, "interpolated-traces");
+    return resampled;
+}
+
+/**
+ * @brief Replaces the traces of the holder by the resampled ones.
+ */
+static float *replace_traces(TracesHolder *apTraceHolder, FrameBuffer<float> *apResampled,
+                             uint actual_nt, float total_time) {
+    apResampled->ReflectOnNative();
+    delete apTraceHolder->Traces;
+    apTraceHolder->Traces = apResampled;
+    apTraceHolder->SampleNT = actual_nt;
+    apTraceHolder->SampleDT = total_time / actual_nt;
+    return apTraceHolder->Traces->GetNativePointer();
+}
+
+/**
+ * @brief Position of the given resampled time step, in recorded samples.
+ */
+static inline float sample_position(uint aTimeStep, uint aSampleNT, uint aActualNT) {
+    return (float) (((double) aTimeStep * aSampleNT) / aActualNT);
+}
+
+static inline float sinc(float aX) {
+    if (aX == 0.0f) {
+        return 1.0f;
+    }
+    return sinf(M_PI * aX) / (M_PI * aX);
+}
+
 float *
 Interpolator::Interpolate(TracesHolder *apTraceHolder, uint actual_nt, float total_time, INTERPOLATION aInterpolation) {
-    if (aInterpolation == SPLINE) {
-        Interpolator::InterpolateLinear(apTraceHolder, actual_nt, total_time);
+    if (aInterpolation == LINEAR) {
+        return Interpolator::InterpolateLinear(apTraceHolder, actual_nt, total_time);
+    } else if (aInterpolation == SPLINE) {
+        return Interpolator::InterpolateSpline(apTraceHolder, actual_nt, total_time);
+    } else if (aInterpolation == SINC) {
+        return Interpolator::InterpolateSinc(apTraceHolder, actual_nt, total_time);
     }
     return nullptr;
 }
 
 float *Interpolator::InterpolateLinear(TracesHolder *apTraceHolder, uint actual_nt, float total_time) {
-    LoggerSystem *Logger = LoggerSystem::GetInstance();
-    uint sample_nt = apTraceHolder->SampleNT;
-    if (actual_nt <= sample_nt) {
-        Logger->Error() << "Interpolation terminated..." << '\n';
-        Logger->Info() << "Actual size should be at least equal sample size..." << '\n';
+    auto resampled = allocate_resampled(apTraceHolder, actual_nt);
+    if (resampled == nullptr) {
         return nullptr;
     }
+    uint sample_nt = apTraceHolder->SampleNT;
+    size_t trace_size = apTraceHolder->TraceSizePerTimeStep;
+    const float *traces = apTraceHolder->Traces->GetHostPointer();
+    float *interpolated = resampled->GetHostPointer();
+
+#pragma omp parallel for schedule(static)
+    for (uint it = 0; it < actual_nt; it++) {
+        float position = sample_position(it, sample_nt, actual_nt);
+        uint sample = min((uint) position, sample_nt - 1);
+        uint next = min(sample + 1, sample_nt - 1);
+        float fraction = position - sample;
+        const float *curr_row = traces + sample * trace_size;
+        const float *next_row = traces + next * trace_size;
+        float *row = interpolated + it * trace_size;
+#pragma omp simd
+        for (size_t i = 0; i < trace_size; i++) {
+            row[i] = curr_row[i] + fraction * (next_row[i] - curr_row[i]);
+        }
+    }
+    return replace_traces(apTraceHolder, resampled, actual_nt, total_time);
+}
 
-    auto *interpolated_trace = (float *) mem_allocate(
-            sizeof(float), actual_nt * apTraceHolder->TraceSizePerTimeStep,
-            "interpolated-traces");
-
-    double step = ((float) sample_nt) / actual_nt;
-    double t_curr, t_next, t_intr, trace_curr, trace_next, slope, fx;
-
-    auto num_elements_per_time_step = apTraceHolder->TraceSizePerTimeStep;
-    auto traces = apTraceHolder->Traces->GetHostPointer();
-    for (int i = 0; i < num_elements_per_time_step; ++i) {
-        int idx = 0;
-        for (int t = 0; t < sample_nt - 1; ++t) {
-            t_curr = t;
-            t_next = t + 1;
-            trace_curr = traces[t * num_elements_per_time_step + i];
-            trace_next = traces[(t + 1) * num_elements_per_time_step + i];
-            slope = (trace_next - trace_curr) / (t_next - t_curr);
-
-            while (true) {
-                t_intr = idx * step;
-                if (t_intr > t_next || idx == actual_nt - 1) {
-                    break;
-                }
-                fx = trace_curr + (slope * (t_intr - t_curr));
-                interpolated_trace[idx++ * num_elements_per_time_step + i] = fx;
+float *Interpolator::InterpolateSpline(TracesHolder *apTraceHolder, uint actual_nt, float total_time) {
+    uint sample_nt = apTraceHolder->SampleNT;
+    if (sample_nt < 3) {
+        return Interpolator::InterpolateLinear(apTraceHolder, actual_nt, total_time);
+    }
+    auto resampled = allocate_resampled(apTraceHolder, actual_nt);
+    if (resampled == nullptr) {
+        return nullptr;
+    }
+    size_t trace_size = apTraceHolder->TraceSizePerTimeStep;
+    const float *traces = apTraceHolder->Traces->GetHostPointer();
+    float *interpolated = resampled->GetHostPointer();
+
+    /*
+     * Natural cubic splines over the unit spaced samples, the second derivatives
+     * solve M[t - 1] + 4 M[t] + M[t + 1] = 6 (y[t - 1] - 2 y[t] + y[t + 1]) with
+     * M[0] = M[nt - 1] = 0. The system is the same for all traces, so the
+     * elimination factors are shared and the sweeps run across the traces.
+     */
+    auto factors = (float *) mem_allocate(sizeof(float), sample_nt, "spline-factors");
+    factors[0] = 0.0f;
+    for (uint t = 1; t < sample_nt - 1; t++) {
+        factors[t] = 1.0f / (4.0f - factors[t - 1]);
+    }
+    auto derivatives = (float *) mem_allocate(sizeof(float), (size_t) sample_nt * trace_size,
+                                              "spline-derivatives");
+
+#pragma omp parallel for schedule(static)
+    for (size_t begin = 0; begin < trace_size; begin += TRACES_BLOCK) {
+        size_t end = min(begin + TRACES_BLOCK, trace_size);
+        float *first = derivatives;
+        float *last = derivatives + (size_t) (sample_nt - 1) * trace_size;
+#pragma omp simd
+        for (size_t i = begin; i < end; i++) {
+            first[i] = 0.0f;
+            last[i] = 0.0f;
+        }
+        for (uint t = 1; t < sample_nt - 1; t++) {
+            const float *prev_y = traces + (t - 1) * trace_size;
+            const float *curr_y = traces + t * trace_size;
+            const float *next_y = traces + (t + 1) * trace_size;
+            const float *prev_m = derivatives + (t - 1) * trace_size;
+            float *curr_m = derivatives + t * trace_size;
+            float factor = factors[t];
+#pragma omp simd
+            for (size_t i = begin; i < end; i++) {
+                float rhs = 6.0f * (prev_y[i] - 2.0f * curr_y[i] + next_y[i]);
+                curr_m[i] = (rhs - prev_m[i]) * factor;
+            }
+        }
+        for (uint t = sample_nt - 2; t > 0; t--) {
+            const float *next_m = derivatives + (t + 1) * trace_size;
+            float *curr_m = derivatives + t * trace_size;
+            float factor = factors[t];
+#pragma omp simd
+            for (size_t i = begin; i < end; i++) {
+                curr_m[i] -= factor * next_m[i];
             }
         }
     }
-    apTraceHolder->Traces->Free();
-    apTraceHolder->Traces->Allocate(actual_nt * apTraceHolder->TraceSizePerTimeStep);
-    Device::MemCpy(apTraceHolder->Traces->GetNativePointer(), interpolated_trace,
-                   actual_nt * num_elements_per_time_step * sizeof(float),
-                   dataunits::Device::COPY_HOST_TO_DEVICE);
-    mem_free(interpolated_trace);
 
-    apTraceHolder->SampleNT = actual_nt;
-    apTraceHolder->SampleDT = total_time / actual_nt;
+#pragma omp parallel for schedule(static)
+    for (uint it = 0; it < actual_nt; it++) {
+        float position = sample_position(it, sample_nt, actual_nt);
+        uint sample = min((uint) position, sample_nt - 2);
+        float b = min(position - sample, 1.0f);
+        float a = 1.0f - b;
+        float ca = (a * a * a - a) / 6.0f;
+        float cb = (b * b * b - b) / 6.0f;
+        const float *curr_y = traces + sample * trace_size;
+        const float *next_y = traces + (sample + 1) * trace_size;
+        const float *curr_m = derivatives + sample * trace_size;
+        const float *next_m = derivatives + (sample + 1) * trace_size;
+        float *row = interpolated + it * trace_size;
+#pragma omp simd
+        for (size_t i = 0; i < trace_size; i++) {
+            row[i] = a * curr_y[i] + b * next_y[i] + ca * curr_m[i] + cb * next_m[i];
+        }
+    }
+    mem_free(derivatives);
+    mem_free(factors);
+    return replace_traces(apTraceHolder, resampled, actual_nt, total_time);
+}
 
-    return apTraceHolder->Traces->GetNativePointer();
+float *Interpolator::InterpolateSinc(TracesHolder *apTraceHolder, uint actual_nt, float total_time) {
+    auto resampled = allocate_resampled(apTraceHolder, actual_nt);
+    if (resampled == nullptr) {
+        return nullptr;
+    }
+    uint sample_nt = apTraceHolder->SampleNT;
+    size_t trace_size = apTraceHolder->TraceSizePerTimeStep;
+    const float *traces = apTraceHolder->Traces->GetHostPointer();
+    float *interpolated = resampled->GetHostPointer();
+
+    /*
+     * Lanczos windowed sinc over the 2 * SINC_RADIUS nearest samples, with the
+     * edge samples repeated beyond the trace ends and the weights normalized
+     * to preserve constant traces.
+     */
+#pragma omp parallel for schedule(static)
+    for (uint it = 0; it < actual_nt; it++) {
+        float position = sample_position(it, sample_nt, actual_nt);
+        int sample = (int) position;
+        float weights[2 * SINC_RADIUS];
+        const float *rows[2 * SINC_RADIUS];
+        float sum = 0.0f;
+        for (int tap = 0; tap < 2 * SINC_RADIUS; tap++) {
+            int t = sample - SINC_RADIUS + 1 + tap;
+            float distance = position - t;
+            weights[tap] = sinc(distance) * sinc(distance / SINC_RADIUS);
+            sum += weights[tap];
+            t = max(0, min(t, (int) sample_nt - 1));
+            rows[tap] = traces + t * trace_size;
+        }
+        float *row = interpolated + it * trace_size;
+#pragma omp simd
+        for (size_t i = 0; i < trace_size; i++) {
+            row[i] = 0.0f;
+        }
+        for (int tap = 0; tap < 2 * SINC_RADIUS; tap++) {
+            const float *tap_row = rows[tap];
+            float weight = weights[tap] / sum;
+#pragma omp simd
+            for (size_t i = 0; i < trace_size; i++) {
+                row[i] += weight * tap_row[i];
+            }
+        }
+    }
+    return replace_traces(apTraceHolder, resampled, actual_nt, total_time);
 }
 
 void Interpolator::InterpolateTrilinear(float *old_grid, float *new_grid,
@@ -18,6 +18,7 @@
  */
 
 #include <cmath>
+#include <cstring>
 #include <unordered_set>
 #include <algorithm>
 
@@ -33,6 +34,21 @@ using namespace operations::dataunits;
 using namespace operations::common;
 
 
+/**
+ * @brief
+ * Packs the bit patterns of both coordinates into a single hash key, equal
+ * for equal positions.
+ */
+static uint64_t get_position_key(float aX, float aY) {
+    // Adding zero folds a negative zero into a positive one.
+    aX += 0.0f;
+    aY += 0.0f;
+    uint32_t x_bits, y_bits;
+    memcpy(&x_bits, &aX, sizeof(float));
+    memcpy(&y_bits, &aY, sizeof(float));
+    return ((uint64_t) x_bits << 32u) | y_bits;
+}
+
 Gather *operations::utils::io::CombineGather(std::vector<Gather *> &aGatherVector) {
     int gather_count = aGatherVector.size();
     for (int gather_index = 1; gather_index < gather_count; gather_index++) {
@@ -49,24 +65,16 @@ Gather *operations::utils::io::CombineGather(std::vector<Gather *> &aGatherVecto
 }
 
 void operations::utils::io::RemoveDuplicatesFromGather(Gather *apGather) {
-    int size = apGather->GetNumberTraces();
-    unordered_map<float, unordered_set<float>> unique_positions;
-    for (int i = 0; i < size; i++) {
-        auto cur_sx = apGather->GetTrace(i)->GetScaledCoordinateHeader(TraceHeaderKey::SX);
-        auto cur_sy = apGather->GetTrace(i)->GetScaledCoordinateHeader(TraceHeaderKey::SY);
-        if (unique_positions.find(cur_sx) == unique_positions.end()) {
-            unique_positions[cur_sx] = {};
-            unique_positions[cur_sx].emplace(cur_sy);
-        } else {
-            if (unique_positions[cur_sx].find(cur_sy) == unique_positions[cur_sx].end()) {
-                unique_positions[cur_sx].emplace(cur_sy);
-            } else {
-                apGather->RemoveTrace(i);
-                i--;
-                size--;
-            }
-        }
+    auto sx = apGather->GetScaledCoordinateColumn(TraceHeaderKey::SX);
+    auto sy = apGather->GetScaledCoordinateColumn(TraceHeaderKey::SY);
+    // Only the first trace at each position is kept.
+    unordered_set<uint64_t> unique_positions;
+    unique_positions.reserve(sx.size());
+    vector<bool> removed(sx.size());
+    for (size_t i = 0; i < sx.size(); i++) {
+        removed[i] = !unique_positions.insert(get_position_key(sx[i], sy[i])).second;
     }
+    apGather->RemoveTraces(removed);
 }
 
 bool operations::utils::io::IsLineGather(Gather *apGather) {
@@ -109,6 +117,28 @@ bool operations::utils::io::IsLineGather(Gather *apGather) {
 }
 
 
+/**
+ * @brief
+ * Sizes the window along an axis to the span of the source and receivers widened
+ * by the aperture and clipped to the domain, within the points allocated for the
+ * axis, and returns its start. When the span does not fit, the window is centred
+ * on it, kept inside the domain and always contains the source, so the receivers
+ * farthest from its centre are dropped.
+ */
+static uint fit_adaptive_window(RegularAxis<uint> &aWindowAxis,
+                                int aSource, int aMinReceiver, int aMaxReceiver,
+                                int aAperture, int aDomainSize) {
+    int low = max(min(aSource, aMinReceiver) - aAperture, 0);
+    int high = min(max(aSource, aMaxReceiver) + aAperture, aDomainSize - 1);
+    aWindowAxis.ResizeAxis(high - low + 1);
+    int window_size = aWindowAxis.GetAxisSize();
+    int start = low + (high - low + 1 - window_size) / 2;
+    start = max(start, aSource - window_size + 1);
+    start = min(start, aSource);
+    start = min(start, aDomainSize - window_size);
+    return max(start, 0);
+}
+
 void operations::utils::io::ParseGatherToTraces(
         bs::io::dataunits::Gather *apGather, Point3D *apSource, TracesHolder *apTraces,
         uint **x_position, uint **y_position,
@@ -140,10 +170,75 @@ void operations::utils::io::ParseGatherToTraces(
     apSource->x = round(source_org_x / apGridBox->GetAfterSamplingAxis()->GetXAxis().GetCellDimension());
     apSource->z = round(source_org_z / apGridBox->GetAfterSamplingAxis()->GetZAxis().GetCellDimension());
     apSource->y = round(source_org_y / apGridBox->GetAfterSamplingAxis()->GetYAxis().GetCellDimension());
+    // Receivers locations, parsed once from the trace headers.
+    uint trace_count = apGather->GetNumberTraces();
+    float dx = apGridBox->GetAfterSamplingAxis()->GetXAxis().GetCellDimension();
+    float dy = apGridBox->GetAfterSamplingAxis()->GetYAxis().GetCellDimension();
+    auto gx_locations = apGather->GetScaledCoordinateColumn(TraceHeaderKey::GX);
+    auto gy_locations = apGather->GetScaledCoordinateColumn(TraceHeaderKey::GY);
+    for (uint i = 0; i < trace_count; i++) {
+        float gx_loc = gx_locations[i]
+                       - apGridBox->GetAfterSamplingAxis()->GetXAxis().GetReferencePoint();
+        float gy_loc = gy_locations[i]
+                       - apGridBox->GetAfterSamplingAxis()->GetYAxis().GetReferencePoint();
+        if (ny == 1) {
+            gx_loc = sqrtf(gx_loc * gx_loc + gy_loc * gy_loc);
+            gy_loc = 0;
+        }
+        gx_locations[i] = gx_loc;
+        gy_locations[i] = gy_loc;
+    }
     // If window model, need to setup the starting point of the window and adjust source point.
     // Handle 3 cases : no room for left window, no room for right window, room for both.
     // Those 3 cases can apply to y-direction as well if 3D.
-    if (apParameters->IsUsingWindow()) {
+    if (apParameters->IsUsingWindow() && apParameters->IsAdaptiveWindow()) {
+        // Size and place the window over the acquisition span of this shot, inside the
+        // points allocated for the largest window, so all the components loop over the
+        // smaller logical window.
+        auto &window_x_axis = apGridBox->GetWindowAxis()->GetXAxis();
+        auto &window_y_axis = apGridBox->GetWindowAxis()->GetYAxis();
+        auto &window_z_axis = apGridBox->GetWindowAxis()->GetZAxis();
+        int domain_x = apGridBox->GetAfterSamplingAxis()->GetXAxis().GetLogicalAxisSize() - 2 * offset;
+        int domain_y = apGridBox->GetAfterSamplingAxis()->GetYAxis().GetLogicalAxisSize() - 2 * offset;
+        int min_x = apSource->x, max_x = apSource->x;
+        int min_y = apSource->y, max_y = apSource->y;
+        for (uint i = 0; i < trace_count; i++) {
+            int gx = round(gx_locations[i] / dx);
+            int gy = round(gy_locations[i] / dy);
+            min_x = min(min_x, gx);
+            max_x = max(max_x, gx);
+            min_y = min(min_y, gy);
+            max_y = max(max_y, gy);
+        }
+        int aperture = apParameters->GetWindowAperture();
+        uint window_start_x = 0;
+        if (apParameters->GetLeftWindow() != 0 || apParameters->GetRightWindow() != 0) {
+            window_start_x = fit_adaptive_window(window_x_axis, apSource->x, min_x, max_x,
+                                                 aperture, domain_x);
+        }
+        apGridBox->SetWindowStart(X_AXIS, window_start_x);
+        apSource->x = apSource->x - window_start_x;
+        apGridBox->SetWindowStart(Y_AXIS, 0);
+        if (ny != 1 && (apParameters->GetFrontWindow() != 0 || apParameters->GetBackWindow() != 0)) {
+            uint window_start_y = fit_adaptive_window(window_y_axis, apSource->y, min_y, max_y,
+                                                      aperture, domain_y);
+            apGridBox->SetWindowStart(Y_AXIS, window_start_y);
+            apSource->y = apSource->y - window_start_y;
+        }
+        // Cut the depth where the window half width is seen from its centre under the
+        // aperture angle, deeper points only see the acquisition under narrower angles.
+        window_z_axis.ResizeAxis(window_z_axis.GetAxisCapacity());
+        float aperture_angle = apParameters->GetWindowApertureAngle();
+        if (aperture_angle > 0) {
+            float half_width = window_x_axis.GetAxisSize() * dx / 2;
+            if (ny != 1) {
+                half_width = max(half_width, window_y_axis.GetAxisSize() * dy / 2);
+            }
+            float depth = half_width / tanf(aperture_angle * M_PI / 180);
+            int depth_size = ceil(depth / apGridBox->GetAfterSamplingAxis()->GetZAxis().GetCellDimension());
+            window_z_axis.ResizeAxis(max(depth_size, (int) apSource->z + 1));
+        }
+    } else if (apParameters->IsUsingWindow()) {
         apGridBox->SetWindowStart(X_AXIS, 0);
         // No room for left window.
         if (apSource->x < apParameters->GetLeftWindow() ||
@@ -179,43 +274,35 @@ void operations::utils::io::ParseGatherToTraces(
         apSource->y += offset;
     }
     // Begin traces parsing.
-    // Remove traces outside the window.
+    // Flag the traces outside the window, they are removed in a single pass at the end.
     uint intern_x = apGridBox->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() - 2 * offset;
     uint intern_y = apGridBox->GetWindowAxis()->GetYAxis().GetLogicalAxisSize() - 2 * offset;
-    for (int i = ((int) apGather->GetNumberTraces()) - 1; i >= 0; i--) {
-        bool erased = false;
-        float gx_loc = apGather->GetTrace(i)->GetScaledCoordinateHeader(TraceHeaderKey::GX)
-                       - apGridBox->GetAfterSamplingAxis()->GetXAxis().GetReferencePoint();
-        float gy_loc = apGather->GetTrace(i)->GetScaledCoordinateHeader(TraceHeaderKey::GY)
-                       - apGridBox->GetAfterSamplingAxis()->GetYAxis().GetReferencePoint();
-
-        if (ny == 1) {
-            gx_loc = sqrtf(gx_loc * gx_loc + gy_loc * gy_loc);
-            gy_loc = 0;
-        }
-        uint gx = round(gx_loc / apGridBox->GetAfterSamplingAxis()->GetXAxis().GetCellDimension());
-        uint gy = round(gy_loc / apGridBox->GetAfterSamplingAxis()->GetYAxis().GetCellDimension());
-        if (gx < apGridBox->GetWindowStart(X_AXIS) || gx >= apGridBox->GetWindowStart(X_AXIS) + intern_x) {
-            apGather->RemoveTrace(i);
-            erased = true;
-        } else if (apGridBox->GetAfterSamplingAxis()->GetYAxis().GetLogicalAxisSize() != 1) {
-            if (gy < apGridBox->GetWindowStart(Y_AXIS) || gy >= apGridBox->GetWindowStart(Y_AXIS) + intern_y) {
-                apGather->RemoveTrace(i);
-                erased = true;
-            }
+    uint window_start_x = apGridBox->GetWindowStart(X_AXIS);
+    uint window_start_y = apGridBox->GetWindowStart(Y_AXIS);
+    bool is_3d = apGridBox->GetAfterSamplingAxis()->GetYAxis().GetLogicalAxisSize() != 1;
+    std::vector<bool> removed(trace_count, false);
+    uint kept_count = 0;
+    for (uint i = 0; i < trace_count; i++) {
+        uint gx = round(gx_locations[i] / dx);
+        uint gy = round(gy_locations[i] / dy);
+        if (gx < window_start_x || gx >= window_start_x + intern_x) {
+            removed[i] = true;
+        } else if (is_3d) {
+            removed[i] = gy < window_start_y || gy >= window_start_y + intern_y;
         }
 
-        if (!erased) {
-            x_dim.insert(gx_loc);
-            y_dim.insert(gy_loc);
+        if (!removed[i]) {
+            x_dim.insert(gx_locations[i]);
+            y_dim.insert(gy_locations[i]);
+            kept_count++;
         }
     }
     /* Set meta data. */
     apTraces->SampleDT = apGather->GetSamplingRate() / (float) 1e6;
     int sample_nt = apGather->GetTrace(0)->GetNumberOfSamples();
 
-    int num_elements_per_time_step = apGather->GetNumberTraces();
-    apTraces->TraceSizePerTimeStep = apGather->GetNumberTraces();
+    int num_elements_per_time_step = kept_count;
+    apTraces->TraceSizePerTimeStep = kept_count;
     apTraces->ReceiversCountX = x_dim.size();
     apTraces->ReceiversCountY = y_dim.size();
     apTraces->SampleNT = sample_nt;
@@ -232,31 +319,37 @@ void operations::utils::io::ParseGatherToTraces(
     *y_position = (uint *) mem_allocate(
             sizeof(uint), num_elements_per_time_step, "traces y-position");
 
+    apTraces->ShiftsX = (float *) mem_allocate(
+            sizeof(float), num_elements_per_time_step, "traces x-shift");
+    apTraces->ShiftsY = (float *) mem_allocate(
+            sizeof(float), num_elements_per_time_step, "traces y-shift");
+
     auto traces = (float *) mem_allocate(sizeof(float), sample_nt * num_elements_per_time_step, "traces_tmp");
-    for (int trace_index = 0; trace_index < num_elements_per_time_step; trace_index++) {
-        for (int t = 0; t < sample_nt; t++) {
-            traces[t * num_elements_per_time_step + trace_index]
-                    = apGather->GetTrace(trace_index)->GetTraceData()[t];
+    for (uint i = 0, trace_index = 0; i < trace_count; i++) {
+        if (removed[i]) {
+            continue;
         }
-        float gx_loc = apGather->GetTrace(trace_index)->GetScaledCoordinateHeader(TraceHeaderKey::GX)
-                       - apGridBox->GetAfterSamplingAxis()->GetXAxis().GetReferencePoint();
-        float gy_loc = apGather->GetTrace(trace_index)->GetScaledCoordinateHeader(TraceHeaderKey::GY)
-                       - apGridBox->GetAfterSamplingAxis()->GetYAxis().GetReferencePoint();
-        if (ny == 1) {
-            gx_loc = sqrtf(gx_loc * gx_loc + gy_loc * gy_loc);
-            gy_loc = 0;
+        float *trace_data = apGather->GetTrace(i)->GetTraceData();
+        for (int t = 0; t < sample_nt; t++) {
+            traces[t * num_elements_per_time_step + trace_index] = trace_data[t];
         }
-        uint gx = round(gx_loc / apGridBox->GetAfterSamplingAxis()->GetXAxis().GetCellDimension());
-        uint gy = round(gy_loc / apGridBox->GetAfterSamplingAxis()->GetYAxis().GetCellDimension());
-        gx -= apGridBox->GetWindowStart(X_AXIS);
-        gy -= apGridBox->GetWindowStart(Y_AXIS);
+        float gx_cells = gx_locations[i] / dx;
+        float gy_cells = gy_locations[i] / dy;
+        uint gx = round(gx_cells);
+        uint gy = round(gy_cells);
+        apTraces->ShiftsX[trace_index] = gx_cells - roundf(gx_cells);
+        apTraces->ShiftsY[trace_index] = gy_cells - roundf(gy_cells);
+        gx -= window_start_x;
+        gy -= window_start_y;
         (*x_position)[trace_index] = gx + offset;
-        if (apGridBox->GetAfterSamplingAxis()->GetYAxis().GetLogicalAxisSize() > 1) {
+        if (is_3d) {
             (*y_position)[trace_index] = gy + offset;
         } else {
             (*y_position)[trace_index] = gy;
         }
+        trace_index++;
     }
+    apGather->RemoveTraces(removed);
     /* Setup traces data to the arrays. */
     apTraces->Traces = new FrameBuffer<float>;
     apTraces->Traces->Allocate(sample_nt * num_elements_per_time_step, "traces");
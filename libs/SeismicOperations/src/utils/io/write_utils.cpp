@@ -75,9 +75,8 @@ operations::utils::io::TransformToGather(const float *apData, uint aNX, uint aNY
         for (int iy = 0; iy < aNY; iy++) {
             for (int ix = 0; ix < aNX; ix++) {
                 auto trace = new Trace(aNS);
-                auto header_map = apMetaDataGather->GetTrace(iy * aNX + ix)->GetTraceHeaders();
-                auto new_headers_map = ((std::unordered_map<TraceHeaderKey, std::string> *) trace->GetTraceHeaders());
-                new_headers_map->insert(header_map->begin(), header_map->end());
+                trace->CopyTraceHeaders(*apMetaDataGather->GetTrace(iy * aNX + ix));
+                trace->SetTraceHeaderKeyValue(TraceHeaderKey::NS, (unsigned short) aNS);
                 uint16_t sampling = aDS * aSampleScale;
                 trace->SetTraceHeaderKeyValue(TraceHeaderKey::DT, sampling);
                 trace->SetTraceHeaderKeyValue(TraceHeaderKey::FLDR, shot + 1);
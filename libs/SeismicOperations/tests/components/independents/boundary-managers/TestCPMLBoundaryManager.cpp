@@ -18,6 +18,7 @@
  */
 
 #include <cmath>
+#include <vector>
 
 #include <prerequisites/libraries/catch/catch.hpp>
 
@@ -26,6 +27,7 @@
 #include <operations/components/independents/concrete/boundary-managers/CPMLBoundaryManager.hpp>
 #include <operations/components/independents/concrete/computation-kernels/isotropic/SecondOrderComputationKernel.hpp>
 #include <operations/common/DataTypes.h>
+#include <operations/configurations/MapKeys.h>
 #include <operations/test-utils/dummy-data-generators/DummyConfigurationMapGenerator.hpp>
 #include <operations/test-utils/dummy-data-generators/DummyGridBoxGenerator.hpp>
 #include <operations/test-utils/dummy-data-generators/DummyParametersGenerator.hpp>
@@ -166,6 +168,127 @@ void TEST_CASE_CPML(GridBox *apGridBox,
     delete velocity;
 }
 
+/**
+ * @note
+ * Propagates a spike for the given number of time steps through a constant
+ * velocity with the CPML applied either inside the kernel sweep or after it,
+ * and returns the final current pressure wave field.
+ */
+vector<float> PROPAGATE_CPML(GridBox *apGridBox,
+                             ComputationParameters *apParameters,
+                             bool aFusedSweep,
+                             int aTimeSteps) {
+    auto pressure_curr = new FrameBuffer<float>();
+    auto pressure_prev = new FrameBuffer<float>();
+    auto velocity = new FrameBuffer<float>();
+
+    int nx = apGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
+    int ny = apGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
+    int nz = apGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
+
+    int wnx = apGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wny = apGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
+    int wnz = apGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    uint window_size = wnx * wny * wnz;
+    uint size = nx * ny * nz;
+
+    pressure_curr->Allocate(window_size);
+    pressure_prev->Allocate(window_size);
+    velocity->Allocate(size);
+
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | CURR | DIR_Z, pressure_curr);
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | PREV | DIR_Z, pressure_prev);
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | NEXT | DIR_Z, pressure_prev);
+    apGridBox->RegisterParameter(PARM | GB_VEL, velocity);
+
+    vector<float> temp_vel(size);
+    float dt = apGridBox->GetDT();
+    for (uint i = 0; i < size; i++) {
+        temp_vel[i] = 1500 * 1500 * dt * dt;
+    }
+
+    Device::MemSet(pressure_curr->GetNativePointer(), 0.0f, window_size * sizeof(float));
+    Device::MemSet(pressure_prev->GetNativePointer(), 0.0f, window_size * sizeof(float));
+    Device::MemCpy(velocity->GetNativePointer(), temp_vel.data(), size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+
+    auto h_pressure = apGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetHostPointer();
+    h_pressure[(wnx / 2) + (wnz / 2) * wnx + (wny / 2) * wnx * wnz] = 1;
+
+    nlohmann::json json_map;
+    json_map[OP_K_PROPRIETIES][OP_K_USE_TOP_LAYER] = true;
+    json_map[OP_K_PROPRIETIES][OP_K_FUSED_SWEEP] = aFusedSweep;
+    auto configuration_map = new JSONConfigurationMap(json_map);
+
+    auto boundary_manager = new CPMLBoundaryManager(configuration_map);
+    auto computation_kernel = new SecondOrderComputationKernel(configuration_map);
+
+    boundary_manager->SetComputationParameters(apParameters);
+    computation_kernel->SetComputationParameters(apParameters);
+
+    boundary_manager->AcquireConfiguration();
+    computation_kernel->AcquireConfiguration();
+
+    boundary_manager->SetGridBox(apGridBox);
+    computation_kernel->SetGridBox(apGridBox);
+
+    computation_kernel->SetBoundaryManager(boundary_manager);
+    computation_kernel->SetMode(operations::components::KERNEL_MODE::FORWARD);
+
+    boundary_manager->ExtendModel();
+
+    for (int it = 0; it < aTimeSteps; it++) {
+        computation_kernel->Step();
+    }
+
+    float *curr = apGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetHostPointer();
+    vector<float> result(curr, curr + window_size);
+
+    delete computation_kernel;
+    delete boundary_manager;
+    delete configuration_map;
+
+    delete pressure_curr;
+    delete pressure_prev;
+    delete velocity;
+    return result;
+}
+
+void TEST_CASE_CPML_FUSED_SWEEP(GridBox *apFusedGridBox,
+                                GridBox *apGridBox,
+                                ComputationParameters *apParameters) {
+    /*
+     * Environment setting (i.e. Backend setting initialization).
+     */
+    set_environment();
+
+    /*
+     * Long enough for the wave to reach and travel inside the layers.
+     */
+    int time_steps = 200;
+
+    auto fused = PROPAGATE_CPML(apFusedGridBox, apParameters, true, time_steps);
+    auto separate = PROPAGATE_CPML(apGridBox, apParameters, false, time_steps);
+
+    float max_value = 0;
+    for (float value : separate) {
+        max_value = fmax(max_value, fabs(value));
+    }
+    REQUIRE(max_value > 0);
+
+    int misses = 0;
+    for (uint index = 0; index < separate.size(); index++) {
+        if (fabs(fused[index] - separate[index]) > max_value * 1e-4) {
+            misses++;
+        }
+    }
+    REQUIRE(misses == 0);
+
+    delete apFusedGridBox;
+    delete apGridBox;
+    delete apParameters;
+}
+
 TEST_CASE("CPML Boundary Manager - 2D - No Window", "[No Window],[2D]") {
     TEST_CASE_CPML(
             generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
@@ -178,4 +301,31 @@ TEST_CASE("CPML Boundary Manager - 2D - Window", "[Window],[2D]") {
             generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
             generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
             generate_average_case_configuration_map_wave());
-}
\ No newline at end of file
+}
+
+TEST_CASE("CPML Boundary Manager - 3D - No Window", "[No Window],[3D]") {
+    TEST_CASE_CPML(
+            generate_grid_box(OP_TU_3D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+TEST_CASE("CPML Boundary Manager - 3D - Window", "[Window],[3D]") {
+    TEST_CASE_CPML(
+            generate_grid_box(OP_TU_3D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+TEST_CASE("CPML Boundary Manager - 2D - No Window - Fused Sweep", "[No Window],[2D]") {
+    TEST_CASE_CPML_FUSED_SWEEP(
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC));
+}
+
+TEST_CASE("CPML Boundary Manager - 2D - Window - Fused Sweep", "[Window],[2D]") {
+    TEST_CASE_CPML_FUSED_SWEEP(
+            generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
+            generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC));
+}
@@ -264,6 +264,85 @@ void TEST_CASE_RANDOM(GridBox *apGridBox,
     delete pressure_prev;
 }
 
+/**
+ * @note
+ * Extends the same model with two managers of the same seed, the boundaries
+ * should match exactly, for the initial extension and for a given shot id,
+ * while a different shot id should get a different boundary.
+ */
+void TEST_CASE_RANDOM_REPRODUCIBLE(GridBox *apGridBox,
+                                   ComputationParameters *apParameters) {
+    set_environment();
+
+    int nx = apGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
+    int ny = apGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
+    int nz = apGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
+    uint size = nx * ny * nz;
+
+    auto velocity = new FrameBuffer<float>();
+    velocity->Allocate(size);
+    apGridBox->RegisterParameter(PARM | GB_VEL, velocity);
+
+    vector<float> temp_vel(size);
+    float dt = apGridBox->GetDT();
+    for (uint i = 0; i < size; i++) {
+        temp_vel[i] = 1500 * 1500 * dt * dt;
+    }
+
+    nlohmann::json json_map;
+    json_map[OP_K_PROPRIETIES][OP_K_GRAIN_SIDE_LENGTH] = 20;
+    json_map[OP_K_PROPRIETIES][OP_K_RANDOM_SEED] = 7;
+    auto configuration_map = new JSONConfigurationMap(json_map);
+
+    vector<vector<float>> extended;
+    vector<RandomBoundaryManager *> boundary_managers;
+    for (int run = 0; run < 2; run++) {
+        Device::MemCpy(velocity->GetNativePointer(), temp_vel.data(), size * sizeof(float),
+                       Device::COPY_HOST_TO_DEVICE);
+
+        auto boundary_manager = new RandomBoundaryManager(configuration_map);
+        boundary_manager->SetComputationParameters(apParameters);
+        boundary_manager->AcquireConfiguration();
+        boundary_manager->SetGridBox(apGridBox);
+        boundary_manager->ExtendModel();
+        boundary_managers.push_back(boundary_manager);
+
+        float *v = velocity->GetHostPointer();
+        extended.emplace_back(v, v + size);
+    }
+    REQUIRE(extended[0] == extended[1]);
+    REQUIRE(extended[0] != temp_vel);
+
+    vector<vector<float>> re_extended;
+    for (auto boundary_manager : boundary_managers) {
+        Device::MemCpy(velocity->GetNativePointer(), temp_vel.data(), size * sizeof(float),
+                       Device::COPY_HOST_TO_DEVICE);
+        boundary_manager->SetShotId(5);
+        boundary_manager->ReExtendModel();
+
+        float *v = velocity->GetHostPointer();
+        re_extended.emplace_back(v, v + size);
+    }
+    REQUIRE(re_extended[0] == re_extended[1]);
+    REQUIRE(re_extended[0] != extended[0]);
+
+    Device::MemCpy(velocity->GetNativePointer(), temp_vel.data(), size * sizeof(float),
+                   Device::COPY_HOST_TO_DEVICE);
+    boundary_managers[1]->SetShotId(6);
+    boundary_managers[1]->ReExtendModel();
+    float *v = velocity->GetHostPointer();
+    REQUIRE(vector<float>(v, v + size) != re_extended[0]);
+
+    for (auto boundary_manager : boundary_managers) {
+        delete boundary_manager;
+    }
+    delete configuration_map;
+    delete velocity;
+
+    delete apGridBox;
+    delete apParameters;
+}
+
 TEST_CASE("Random Boundary Manager - 2D - No Window", "[No Window],[2D]") {
     TEST_CASE_RANDOM(
             generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
@@ -277,3 +356,9 @@ TEST_CASE("Random Boundary Manager - 2D - Window", "[Window],[2D]") {
             generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
             generate_average_case_configuration_map_wave());
 }
+
+TEST_CASE("Random Boundary Manager - 2D - Reproducible", "[No Window],[2D]") {
+    TEST_CASE_RANDOM_REPRODUCIBLE(
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC));
+}
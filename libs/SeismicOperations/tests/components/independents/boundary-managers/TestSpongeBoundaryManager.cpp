@@ -162,3 +162,17 @@ TEST_CASE("Sponge Boundary Manager - 2D - Window", "[Window],[2D]") {
             generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
             generate_average_case_configuration_map_wave());
 }
+
+TEST_CASE("Sponge Boundary Manager - 3D - No Window", "[No Window],[3D]") {
+    TEST_CASE_SPONGE(
+            generate_grid_box(OP_TU_3D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+TEST_CASE("Sponge Boundary Manager - 3D - Window", "[Window],[3D]") {
+    TEST_CASE_SPONGE(
+            generate_grid_box(OP_TU_3D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
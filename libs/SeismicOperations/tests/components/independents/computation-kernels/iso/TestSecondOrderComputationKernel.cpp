@@ -18,6 +18,7 @@
  */
 
 #include <limits>
+#include <vector>
 
 #include <prerequisites/libraries/catch/catch.hpp>
 
@@ -251,3 +252,241 @@ TEST_CASE("Isotropic Second Order - 2D - Window", "[Window],[2D]") {
             generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
             generate_average_case_configuration_map_wave());
 }
+
+TEST_CASE("Isotropic Second Order - 3D - No Window", "[No Window],[3D]") {
+    TEST_CASE_SECOND_ORDER_COMPUTATION_KERNEL(
+            generate_grid_box(OP_TU_3D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+TEST_CASE("Isotropic Second Order - 3D - Window", "[Window],[3D]") {
+    TEST_CASE_SECOND_ORDER_COMPUTATION_KERNEL(
+            generate_grid_box(OP_TU_3D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+/**
+ * @note
+ * Checks that advancing several time steps at once through the temporal
+ * blocking gives the same wave fields as stepping them one by one.
+ */
+void TEST_CASE_SECOND_ORDER_TEMPORAL_BLOCKING(GridBox *apGridBox,
+                                              ComputationParameters *apParameters,
+                                              ConfigurationMap *apConfigurationMap) {
+    /*
+     * Environment setting (i.e. Backend setting initialization).
+     */
+    set_environment();
+
+    int nx = apGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
+    int nz = apGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
+
+    int wnx = apGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wnz = apGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    uint window_size = wnx * wnz;
+    uint size = nx * nz;
+
+    auto pressure_curr = new FrameBuffer<float>();
+    auto pressure_prev = new FrameBuffer<float>();
+    auto velocity = new FrameBuffer<float>();
+    pressure_curr->Allocate(window_size);
+    pressure_prev->Allocate(window_size);
+    velocity->Allocate(size);
+
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | CURR | DIR_Z, pressure_curr);
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | PREV | DIR_Z, pressure_prev);
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | NEXT | DIR_Z, pressure_prev);
+    apGridBox->RegisterParameter(PARM | GB_VEL, velocity);
+
+    vector<float> temp_vel(size);
+    float dt = apGridBox->GetDT();
+    for (uint i = 0; i < size; i++) {
+        temp_vel[i] = 1500 * 1500 * dt * dt;
+    }
+    Device::MemCpy(velocity->GetNativePointer(), temp_vel.data(), size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+
+    auto computation_kernel = new SecondOrderComputationKernel(apConfigurationMap);
+    computation_kernel->SetGridBox(apGridBox);
+    computation_kernel->SetComputationParameters(apParameters);
+    computation_kernel->SetMode(operations::components::KERNEL_MODE::FORWARD);
+
+    /*
+     * Both runs start from the same non trivial state.
+     */
+
+    auto reset_state = [&]() {
+        Device::MemSet(pressure_curr->GetNativePointer(), 0.0f, window_size * sizeof(float));
+        Device::MemSet(pressure_prev->GetNativePointer(), 0.0f, window_size * sizeof(float));
+        apGridBox->Set(WAVE | GB_PRSS | CURR | DIR_Z, pressure_curr);
+        apGridBox->Set(WAVE | GB_PRSS | PREV | DIR_Z, pressure_prev);
+        apGridBox->Set(WAVE | GB_PRSS | NEXT | DIR_Z, pressure_prev);
+        float *h_pressure = pressure_curr->GetHostPointer();
+        h_pressure[(wnx / 2) + (wnz / 2) * wnx] = 1;
+        Device::MemCpy(pressure_curr->GetNativePointer(), h_pressure,
+                       window_size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+        computation_kernel->Step();
+    };
+
+    for (uint time_steps : {2u, 5u}) {
+        reset_state();
+        for (uint it = 0; it < time_steps; it++) {
+            computation_kernel->Step();
+        }
+        float *curr = apGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetHostPointer();
+        float *prev = apGridBox->Get(WAVE | GB_PRSS | PREV | DIR_Z)->GetHostPointer();
+        vector<float> expected_curr(curr, curr + window_size);
+        vector<float> expected_prev(prev, prev + window_size);
+
+        reset_state();
+        computation_kernel->AdvanceSteps(time_steps);
+        curr = apGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetHostPointer();
+        prev = apGridBox->Get(WAVE | GB_PRSS | PREV | DIR_Z)->GetHostPointer();
+
+        REQUIRE(apGridBox->Get(WAVE | GB_PRSS | NEXT | DIR_Z) ==
+                apGridBox->Get(WAVE | GB_PRSS | PREV | DIR_Z));
+        int misses = 0;
+        for (uint index = 0; index < window_size; index++) {
+            if (!approximately_equal(curr[index], expected_curr[index]) ||
+                !approximately_equal(prev[index], expected_prev[index])) {
+                misses++;
+            }
+        }
+        REQUIRE(misses == 0);
+    }
+
+    delete computation_kernel;
+
+    delete apGridBox;
+    delete apParameters;
+    delete apConfigurationMap;
+}
+
+TEST_CASE("Isotropic Second Order - 2D - Temporal Blocking", "[No Window],[2D]") {
+    TEST_CASE_SECOND_ORDER_TEMPORAL_BLOCKING(
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+TEST_CASE("Isotropic Second Order - 2D - Window - Temporal Blocking", "[Window],[2D]") {
+    TEST_CASE_SECOND_ORDER_TEMPORAL_BLOCKING(
+            generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+/**
+ * @note
+ * Checks that a window resized inside its allocated points, as the adaptive
+ * window does per shot, propagates as a window allocated at that size, and
+ * that the points beyond its logical size are left untouched.
+ */
+void TEST_CASE_SECOND_ORDER_RESIZED_WINDOW(ComputationParameters *apParameters,
+                                           ConfigurationMap *apConfigurationMap) {
+    /*
+     * Environment setting (i.e. Backend setting initialization).
+     */
+    set_environment();
+
+    uint logical_nx = 15;
+    uint logical_nz = 13;
+    uint time_steps = 6;
+
+    auto propagate = [&](GridBox *apGridBox, vector<float> &aLogicalPressure) {
+        int wnx = apGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+        int wnz = apGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+        int nx = apGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
+        int nz = apGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
+        uint window_size = wnx * wnz;
+        uint size = nx * nz;
+
+        auto pressure_curr = new FrameBuffer<float>();
+        auto pressure_prev = new FrameBuffer<float>();
+        auto velocity = new FrameBuffer<float>();
+        pressure_curr->Allocate(window_size);
+        pressure_prev->Allocate(window_size);
+        velocity->Allocate(size);
+
+        apGridBox->RegisterWaveField(WAVE | GB_PRSS | CURR | DIR_Z, pressure_curr);
+        apGridBox->RegisterWaveField(WAVE | GB_PRSS | PREV | DIR_Z, pressure_prev);
+        apGridBox->RegisterWaveField(WAVE | GB_PRSS | NEXT | DIR_Z, pressure_prev);
+        apGridBox->RegisterParameter(PARM | GB_VEL, velocity);
+
+        vector<float> temp_vel(size);
+        float dt = apGridBox->GetDT();
+        for (uint i = 0; i < size; i++) {
+            temp_vel[i] = 1500 * 1500 * dt * dt;
+        }
+        Device::MemCpy(velocity->GetNativePointer(), temp_vel.data(), size * sizeof(float),
+                       Device::COPY_HOST_TO_DEVICE);
+        Device::MemSet(pressure_curr->GetNativePointer(), 0.0f, window_size * sizeof(float));
+        Device::MemSet(pressure_prev->GetNativePointer(), 0.0f, window_size * sizeof(float));
+        float *h_pressure = pressure_curr->GetHostPointer();
+        h_pressure[(logical_nx / 2) + (logical_nz / 2) * wnx] = 1;
+        Device::MemCpy(pressure_curr->GetNativePointer(), h_pressure,
+                       window_size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+
+        auto computation_kernel = new SecondOrderComputationKernel(apConfigurationMap);
+        computation_kernel->SetGridBox(apGridBox);
+        computation_kernel->SetComputationParameters(apParameters);
+        computation_kernel->SetMode(operations::components::KERNEL_MODE::FORWARD);
+        for (uint it = 0; it < time_steps; it++) {
+            computation_kernel->Step();
+        }
+
+        float *curr = apGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetHostPointer();
+        int outside = 0;
+        aLogicalPressure.clear();
+        for (int iz = 0; iz < wnz; iz++) {
+            for (int ix = 0; ix < wnx; ix++) {
+                if (ix < logical_nx && iz < logical_nz) {
+                    aLogicalPressure.push_back(curr[iz * wnx + ix]);
+                } else if (curr[iz * wnx + ix] != 0) {
+                    outside++;
+                }
+            }
+        }
+
+        delete computation_kernel;
+        delete pressure_curr;
+        delete pressure_prev;
+        delete velocity;
+        delete apGridBox;
+        return outside;
+    };
+
+    auto resized_grid_box = generate_grid_box(OP_TU_2D, OP_TU_INC_WIND);
+    uint actual_wnx = resized_grid_box->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    resized_grid_box->GetWindowAxis()->GetXAxis().ResizeAxis(logical_nx);
+    resized_grid_box->GetWindowAxis()->GetZAxis().ResizeAxis(logical_nz);
+    REQUIRE(resized_grid_box->GetWindowAxis()->GetXAxis().GetLogicalAxisSize() == logical_nx);
+    REQUIRE(resized_grid_box->GetWindowAxis()->GetXAxis().GetActualAxisSize() == actual_wnx);
+
+    auto allocated_grid_box = generate_grid_box(OP_TU_2D, OP_TU_INC_WIND);
+    allocated_grid_box->SetWindowAxis(new Axis3D<unsigned int>(logical_nx, 1, logical_nz));
+
+    vector<float> resized_pressure;
+    vector<float> allocated_pressure;
+    REQUIRE(propagate(resized_grid_box, resized_pressure) == 0);
+    REQUIRE(propagate(allocated_grid_box, allocated_pressure) == 0);
+
+    int misses = 0;
+    for (uint index = 0; index < allocated_pressure.size(); index++) {
+        if (!approximately_equal(resized_pressure[index], allocated_pressure[index])) {
+            misses++;
+        }
+    }
+    REQUIRE(misses == 0);
+
+    delete apParameters;
+    delete apConfigurationMap;
+}
+
+TEST_CASE("Isotropic Second Order - 2D - Resized Window", "[Window],[2D]") {
+    TEST_CASE_SECOND_ORDER_RESIZED_WINDOW(
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
@@ -19,13 +19,16 @@
 
 
 #include <limits>
+#include <vector>
 
 #include <prerequisites/libraries/catch/catch.hpp>
 
 #include <bs/base/api/cpp/BSBase.hpp>
+#include <bs/base/configurations/concrete/JSONConfigurationMap.hpp>
 
 #include <operations/components/independents/concrete/computation-kernels/isotropic/StaggeredComputationKernel.hpp>
 #include <operations/common/DataTypes.h>
+#include <operations/configurations/MapKeys.h>
 #include <operations/test-utils/dummy-data-generators/DummyConfigurationMapGenerator.hpp>
 #include <operations/test-utils/dummy-data-generators/DummyGridBoxGenerator.hpp>
 #include <operations/test-utils/dummy-data-generators/DummyParametersGenerator.hpp>
@@ -270,4 +273,137 @@ TEST_CASE("Staggered Order - 2D - Window", "[Window],[2D]") {
             generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
             generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
             generate_average_case_configuration_map_wave());
-}
\ No newline at end of file
+}
+
+TEST_CASE("Staggered Order - 3D - No Window", "[No Window],[3D]") {
+    TEST_CASE_STAGGERED_COMPUTATION_KERNEL(
+            generate_grid_box(OP_TU_3D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+TEST_CASE("Staggered Order - 3D - Window", "[Window],[3D]") {
+    TEST_CASE_STAGGERED_COMPUTATION_KERNEL(
+            generate_grid_box(OP_TU_3D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+/**
+ * @note
+ * Propagates an impulse in 2D for the given number of steps, with the velocity
+ * and pressure sweeps fused or not, and returns the final pressure.
+ */
+vector<float> RUN_STAGGERED_COMPUTATION_KERNEL(bool aFusedSweep, uint aTimeSteps) {
+    set_environment();
+
+    /*
+     * A grid tall enough to be split into several chunks of rows, swept
+     * in several strips of rows each.
+     */
+
+    int nx = 67;
+    int nz = 131;
+    float dx = 6.25f;
+    float dz = 6.25f;
+
+    auto grid_box = new GridBox();
+    grid_box->SetAfterSamplingAxis(new Axis3D<unsigned int>(nx, 1, nz));
+    grid_box->SetInitialAxis(new Axis3D<unsigned int>(nx, 1, nz));
+    grid_box->SetWindowAxis(new Axis3D<unsigned int>(nx, 1, nz));
+    grid_box->GetAfterSamplingAxis()->GetXAxis().SetCellDimension(dx);
+    grid_box->GetAfterSamplingAxis()->GetZAxis().SetCellDimension(dz);
+    grid_box->GetInitialAxis()->GetXAxis().SetCellDimension(dx);
+    grid_box->GetInitialAxis()->GetZAxis().SetCellDimension(dz);
+    grid_box->SetDT(0.00207987f);
+
+    auto parameters = generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC);
+    parameters->SetBlockX(16);
+    parameters->SetBlockZ(6);
+
+    int wnx = nx;
+    int wnz = nz;
+    uint window_size = wnx * wnz;
+    uint size = nx * nz;
+
+    auto pressure_curr = new FrameBuffer<float>(window_size);
+    auto pressure_next = new FrameBuffer<float>(window_size);
+    auto particle_vel_x = new FrameBuffer<float>(window_size);
+    auto particle_vel_z = new FrameBuffer<float>(window_size);
+    auto velocity = new FrameBuffer<float>(size);
+    auto density = new FrameBuffer<float>(size);
+
+    grid_box->RegisterWaveField(WAVE | GB_PRSS | CURR | DIR_Z, pressure_curr);
+    grid_box->RegisterWaveField(WAVE | GB_PRSS | NEXT | DIR_Z, pressure_next);
+    grid_box->RegisterWaveField(WAVE | GB_PRTC | CURR | DIR_Z, particle_vel_z);
+    grid_box->RegisterWaveField(WAVE | GB_PRTC | CURR | DIR_X, particle_vel_x);
+    grid_box->RegisterParameter(PARM | GB_VEL, velocity);
+    grid_box->RegisterParameter(PARM | GB_DEN, density);
+
+    float dt = grid_box->GetDT();
+    vector<float> temp_vel(size, 1500 * 1500 * dt * dt);
+    vector<float> temp_den(size);
+    for (uint i = 0; i < size; i++) {
+        temp_den[i] = 1.0f + 0.5f * (float) (i / nx) / (float) nz;
+    }
+    Device::MemCpy(velocity->GetNativePointer(), temp_vel.data(), size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+    Device::MemCpy(density->GetNativePointer(), temp_den.data(), size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+
+    vector<float> zeros(window_size, 0.0f);
+    zeros[(wnx / 3) + (wnz / 4) * wnx] = 1;
+    Device::MemCpy(pressure_curr->GetNativePointer(), zeros.data(), window_size * sizeof(float),
+                   Device::COPY_HOST_TO_DEVICE);
+    zeros[(wnx / 3) + (wnz / 4) * wnx] = 0;
+    Device::MemCpy(pressure_next->GetNativePointer(), zeros.data(), window_size * sizeof(float),
+                   Device::COPY_HOST_TO_DEVICE);
+    Device::MemCpy(particle_vel_x->GetNativePointer(), zeros.data(), window_size * sizeof(float),
+                   Device::COPY_HOST_TO_DEVICE);
+    Device::MemCpy(particle_vel_z->GetNativePointer(), zeros.data(), window_size * sizeof(float),
+                   Device::COPY_HOST_TO_DEVICE);
+
+    nlohmann::json json_map;
+    json_map[OP_K_PROPRIETIES][OP_K_FUSED_SWEEP] = aFusedSweep;
+    auto configuration_map = new JSONConfigurationMap(json_map);
+
+    auto computation_kernel = new StaggeredComputationKernel(configuration_map);
+    computation_kernel->SetGridBox(grid_box);
+    computation_kernel->SetComputationParameters(parameters);
+    computation_kernel->AcquireConfiguration();
+    computation_kernel->SetMode(operations::components::KERNEL_MODE::FORWARD);
+
+    for (uint t = 0; t < aTimeSteps; t++) {
+        computation_kernel->Step();
+    }
+    float *pressure = grid_box->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetHostPointer();
+    vector<float> result(pressure, pressure + window_size);
+
+    delete computation_kernel;
+    delete configuration_map;
+    delete grid_box;
+    delete parameters;
+    delete pressure_curr;
+    delete pressure_next;
+    delete particle_vel_x;
+    delete particle_vel_z;
+    delete velocity;
+    delete density;
+    return result;
+}
+
+TEST_CASE("Staggered Order - 2D - Fused Sweep", "[No Window],[2D]") {
+    auto separate = RUN_STAGGERED_COMPUTATION_KERNEL(false, 60);
+    auto fused = RUN_STAGGERED_COMPUTATION_KERNEL(true, 60);
+
+    int misses = 0;
+    int non_zeros = 0;
+    for (size_t i = 0; i < fused.size(); i++) {
+        if (fused[i] != separate[i]) {
+            misses++;
+        }
+        if (fused[i] != 0) {
+            non_zeros++;
+        }
+    }
+    REQUIRE(misses == 0);
+    REQUIRE(non_zeros > 0);
+}
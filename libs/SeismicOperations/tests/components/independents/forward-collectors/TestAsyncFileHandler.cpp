@@ -0,0 +1,127 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <prerequisites/libraries/catch/catch.hpp>
+
+#include <operations/components/independents/concrete/forward-collectors/file-handler/AsyncFileHandler.hpp>
+#include <operations/components/independents/concrete/forward-collectors/file-handler/file_handler.h>
+
+using namespace std;
+using namespace operations::components::helpers;
+
+
+TEST_CASE("Async File Handler - Spill and Prefetch Ring", "[AsyncFileHandler]") {
+    const uint slots = 2;
+    const uint blocks = 6;
+    const size_t block_size = 4096;
+
+    vector<float> ring(slots * block_size);
+    auto handler = new AsyncFileHandler(slots);
+
+    /*
+     * Spill blocks through the ring, reusing a slot only after its
+     * previous spill is done.
+     */
+
+    for (uint block = 0; block < blocks; block++) {
+        uint slot = block % slots;
+        handler->Wait(slot);
+        float *host_block = ring.data() + slot * block_size;
+        for (size_t i = 0; i < block_size; i++) {
+            host_block[i] = (float) (block * block_size + i);
+        }
+        string path = string(OPERATIONS_TEST_DATA_PATH) + "/async_" + to_string(block);
+        handler->Submit(slot, [=]() {
+            bin_file_save(path.c_str(), host_block, block_size);
+        });
+    }
+    handler->WaitAll();
+    REQUIRE(!handler->IsPending(0));
+    REQUIRE(!handler->IsPending(1));
+
+    /*
+     * Fetch them back in reverse order, prefetching the
+     * previous block while checking the current one.
+     */
+
+    int misses = 0;
+    auto load = [&](uint block) {
+        float *host_block = ring.data() + (block % slots) * block_size;
+        string path = string(OPERATIONS_TEST_DATA_PATH) + "/async_" + to_string(block);
+        handler->Submit(block % slots, [=]() {
+            bin_file_load(path.c_str(), host_block, block_size);
+        });
+    };
+    load(blocks - 1);
+    for (int block = blocks - 1; block >= 0; block--) {
+        handler->Wait(block % slots);
+        if (block > 0) {
+            load(block - 1);
+        }
+        float *host_block = ring.data() + (block % slots) * block_size;
+        for (size_t i = 0; i < block_size; i++) {
+            if (host_block[i] != (float) (block * block_size + i)) {
+                misses++;
+            }
+        }
+    }
+    REQUIRE(misses == 0);
+
+    delete handler;
+    for (uint block = 0; block < blocks; block++) {
+        string path = string(OPERATIONS_TEST_DATA_PATH) + "/async_" + to_string(block);
+        remove(path.c_str());
+    }
+}
+
+TEST_CASE("Async File Handler - Task Exception", "[AsyncFileHandler]") {
+    auto handler = new AsyncFileHandler(2);
+    int done = 0;
+
+    handler->Submit(0, []() {
+        throw std::runtime_error("failed spill");
+    });
+    handler->Submit(1, [&done]() {
+        done++;
+    });
+
+    /* The failure is reported on its own slot only, and only once. */
+    REQUIRE_NOTHROW(handler->Wait(1));
+    REQUIRE(done == 1);
+    REQUIRE_THROWS_AS(handler->Wait(0), std::runtime_error);
+    REQUIRE_NOTHROW(handler->Wait(0));
+
+    /* The worker keeps running the following tasks. */
+    handler->Submit(0, []() {
+        throw std::runtime_error("failed fetch");
+    });
+    handler->Submit(0, [&done]() {
+        done++;
+    });
+    REQUIRE_THROWS_AS(handler->WaitAll(), std::runtime_error);
+    REQUIRE(done == 2);
+    REQUIRE_NOTHROW(handler->WaitAll());
+
+    delete handler;
+}
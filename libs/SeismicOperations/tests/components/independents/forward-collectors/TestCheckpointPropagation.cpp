@@ -0,0 +1,225 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <vector>
+
+#include <prerequisites/libraries/catch/catch.hpp>
+
+#include <bs/base/configurations/concrete/JSONConfigurationMap.hpp>
+
+#include <operations/components/independents/concrete/forward-collectors/CheckpointPropagation.hpp>
+#include <operations/components/independents/concrete/boundary-managers/NoBoundaryManager.hpp>
+#include <operations/common/DataTypes.h>
+#include <operations/components/independents/concrete/computation-kernels/isotropic/SecondOrderComputationKernel.hpp>
+#include <operations/components/independents/concrete/source-injectors/RickerSourceInjector.hpp>
+#include <operations/components/dependents/concrete/memory-handlers/WaveFieldsMemoryHandler.hpp>
+#include <operations/configurations/MapKeys.h>
+#include <operations/test-utils/dummy-data-generators/DummyGridBoxGenerator.hpp>
+#include <operations/test-utils/dummy-data-generators/DummyParametersGenerator.hpp>
+#include <operations/test-utils/EnvironmentHandler.hpp>
+
+
+using namespace std;
+using namespace bs::base::configurations;
+using namespace operations::components;
+using namespace operations::common;
+using namespace operations::dataunits;
+using namespace operations::testutils;
+using namespace operations::helpers;
+
+
+/**
+ * @note
+ * Runs the forward and backward loops the same way the RTM engine does, and
+ * checks that every fetched forward state (recomputed or not) matches the
+ * state seen during the forward propagation.
+ */
+void TEST_CASE_FORWARD_COLLECTOR_CHECKPOINT(GridBox *apGridBox,
+                                            ComputationParameters *apParameters,
+                                            float aCheckpoints) {
+    /*
+     * Environment setting (i.e. Backend setting initialization).
+     */
+    set_environment();
+
+    /*
+     * Register and allocate parameters and wave fields in
+     * grid box according to the current test case.
+     */
+
+    auto pressure_curr = new FrameBuffer<float>();
+    auto pressure_prev = new FrameBuffer<float>();
+    auto velocity = new FrameBuffer<float>();
+
+    uint nt = 60;
+    apGridBox->SetNT(nt);
+
+    int nx = apGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
+    int ny = apGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
+    int nz = apGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
+
+    int wnx = apGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wny = apGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
+    int wnz = apGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    uint window_size = wnx * wny * wnz;
+    uint size = nx * ny * nz;
+
+    pressure_curr->Allocate(window_size);
+    pressure_prev->Allocate(window_size);
+    velocity->Allocate(size);
+
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | CURR | DIR_Z, pressure_curr);
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | PREV | DIR_Z, pressure_prev);
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | NEXT | DIR_Z, pressure_prev);
+    apGridBox->RegisterParameter(PARM | GB_VEL, velocity);
+
+    vector<float> temp_vel(size);
+    float dt = apGridBox->GetDT();
+    for (uint i = 0; i < size; i++) {
+        temp_vel[i] = 1500 * 1500 * dt * dt;
+    }
+    Device::MemCpy(velocity->GetNativePointer(), temp_vel.data(), size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+
+    /*
+     * Memory budget fitting the requested number of checkpoints
+     * of the two pressure wave fields.
+     */
+
+    nlohmann::json json_map;
+    json_map[OP_K_PROPRIETIES][OP_K_MEMORY_BUDGET] =
+            (aCheckpoints * 2 * window_size * sizeof(float)) / (1024 * 1024);
+    auto configuration_map = new JSONConfigurationMap(json_map);
+
+    auto memory_handler = new WaveFieldsMemoryHandler(configuration_map);
+    memory_handler->SetComputationParameters(apParameters);
+
+    auto computation_kernel = new SecondOrderComputationKernel(configuration_map);
+    computation_kernel->SetGridBox(apGridBox);
+    computation_kernel->SetComputationParameters(apParameters);
+    computation_kernel->SetMode(KERNEL_MODE::FORWARD);
+
+    auto boundary_manager = new NoBoundaryManager(configuration_map);
+
+    auto source_point = new Point3D(wnx / 2, wny / 2, wnz / 2);
+    auto source_injector = new RickerSourceInjector(configuration_map);
+    source_injector->SetComputationParameters(apParameters);
+    source_injector->SetGridBox(apGridBox);
+    source_injector->SetSourcePoint(source_point);
+
+    auto dependent_components_map = new ComponentsMap<DependentComponent>();
+    dependent_components_map->Set(MEMORY_HANDLER, memory_handler);
+
+    auto components_map = new ComponentsMap<Component>();
+    components_map->Set(COMPUTATION_KERNEL, computation_kernel);
+    components_map->Set(SOURCE_INJECTOR, source_injector);
+    components_map->Set(BOUNDARY_MANAGER, boundary_manager);
+
+    auto forward_collector = new CheckpointPropagation(configuration_map);
+    forward_collector->SetComputationParameters(apParameters);
+    forward_collector->SetDependentComponents(dependent_components_map);
+    forward_collector->SetComponentsMap(components_map);
+    forward_collector->SetGridBox(apGridBox);
+    forward_collector->AcquireConfiguration();
+
+    /*
+     * Forward propagation, keeping every state for reference.
+     */
+
+    forward_collector->ResetGrid(true);
+
+    vector<vector<float>> states;
+    for (uint it = 1; it < nt; it++) {
+        float *curr = apGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetHostPointer();
+        states.emplace_back(curr, curr + window_size);
+
+        forward_collector->SaveForward();
+        source_injector->ApplySource(it);
+        computation_kernel->Step();
+    }
+
+    /*
+     * Backward propagation, fetching the states in reverse.
+     */
+
+    forward_collector->ResetGrid(false);
+
+    int misses = 0;
+    for (uint it = nt - 1; it > 0; it--) {
+        forward_collector->FetchForward();
+        float *curr = forward_collector->GetForwardGrid()->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetHostPointer();
+        for (uint index = 0; index < window_size; index++) {
+            if (curr[index] != states[it - 1][index]) {
+                misses++;
+            }
+        }
+    }
+    REQUIRE(misses == 0);
+
+    uint checkpoints = forward_collector->GetCheckpointsCount();
+    if (checkpoints < nt - 1) {
+        REQUIRE(checkpoints == (uint) aCheckpoints);
+        REQUIRE(forward_collector->GetRecomputedSteps() > 0);
+    } else {
+        REQUIRE(forward_collector->GetRecomputedSteps() == 0);
+    }
+
+    delete forward_collector;
+    delete components_map;
+    delete dependent_components_map;
+    delete source_injector;
+    delete source_point;
+    delete boundary_manager;
+    delete computation_kernel;
+    delete memory_handler;
+    delete configuration_map;
+
+    delete apGridBox;
+    delete apParameters;
+}
+
+TEST_CASE("Checkpoint Forward Collector - 2D - No Window", "[No Window],[2D]") {
+    TEST_CASE_FORWARD_COLLECTOR_CHECKPOINT(
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            4.5f);
+}
+
+TEST_CASE("Checkpoint Forward Collector - 2D - Window", "[Window],[2D]") {
+    TEST_CASE_FORWARD_COLLECTOR_CHECKPOINT(
+            generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            4.5f);
+}
+
+TEST_CASE("Checkpoint Forward Collector - 2D - All States Fit", "[No Window],[2D]") {
+    TEST_CASE_FORWARD_COLLECTOR_CHECKPOINT(
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            100.0f);
+}
+
+TEST_CASE("Checkpoint Forward Collector - 2D - Temporal Blocking", "[No Window],[2D]") {
+    auto parameters = generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC);
+    parameters->SetBlockT(4);
+    TEST_CASE_FORWARD_COLLECTOR_CHECKPOINT(
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            parameters,
+            4.5f);
+}
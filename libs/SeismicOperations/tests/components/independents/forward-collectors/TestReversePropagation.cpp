@@ -26,6 +26,7 @@
 #include <operations/components/dependency/concrete/HasDependents.hpp>
 #include <operations/components/independents/concrete/computation-kernels/isotropic/SecondOrderComputationKernel.hpp>
 #include <operations/components/dependents/concrete/memory-handlers/WaveFieldsMemoryHandler.hpp>
+#include <operations/configurations/MapKeys.h>
 #include <operations/test-utils/dummy-data-generators/DummyConfigurationMapGenerator.hpp>
 #include <operations/test-utils/dummy-data-generators/DummyGridBoxGenerator.hpp>
 #include <operations/test-utils/dummy-data-generators/DummyParametersGenerator.hpp>
@@ -265,7 +266,8 @@ void TEST_CASE_FORWARD_COLLECTOR_REVERSE_NO_INJECTION(GridBox *apGridBox,
 
 void TEST_CASE_FORWARD_COLLECTOR_REVERSE_INC_INJECTION(GridBox *apGridBox,
                                                        ComputationParameters *apParameters,
-                                                       ConfigurationMap *apConfigurationMap) {
+                                                       ConfigurationMap *apConfigurationMap,
+                                                       bool aBoundaryCompression = false) {
     /*
      * Environment setting (i.e. Backend setting initialization).
      */
@@ -280,7 +282,7 @@ void TEST_CASE_FORWARD_COLLECTOR_REVERSE_INC_INJECTION(GridBox *apGridBox,
     auto pressure_prev = new FrameBuffer<float>();
     auto velocity = new FrameBuffer<float>();
 
-    auto configuration_map = new JSONConfigurationMap(R"(
+    nlohmann::json json_map = R"(
                 {
                     "wave": {
                         "physics": "acoustic",
@@ -293,7 +295,9 @@ void TEST_CASE_FORWARD_COLLECTOR_REVERSE_INC_INJECTION(GridBox *apGridBox,
                                 "boundary-saving": true
                              }
                 }
-            )"_json);
+            )"_json;
+    json_map[OP_K_PROPRIETIES][OP_K_BOUNDARY_COMPRESSION] = aBoundaryCompression;
+    auto configuration_map = new JSONConfigurationMap(json_map);
     auto memory_handler = new WaveFieldsMemoryHandler(configuration_map);
 
     float nt = 5;
@@ -537,14 +541,19 @@ void TEST_CASE_FORWARD_COLLECTOR_REVERSE_INC_INJECTION(GridBox *apGridBox,
     auto fetch_backup_grid = forward_collector->GetForwardGrid();
     auto fetch_backup_pres = fetch_backup_grid->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetHostPointer();
 
+    /// Compressed boundaries are restored within the quantization error.
+    auto is_restored = [aBoundaryCompression](float aValue) {
+        return aBoundaryCompression ? approximately_equal(aValue, 0.25f) : aValue == 0.25f;
+    };
+
     misses = 0;
     for (int iy = start_y; iy < end_y; iy++) {
         for (int iz = start_z; iz < end_z; iz++) {
             for (int ix = 0; ix < half_length; ix++) {
-                if (fetch_backup_pres[iy * wnz * wnx + iz * wnx + bound_length + ix] != 0.25) {
+                if (!is_restored(fetch_backup_pres[iy * wnz * wnx + iz * wnx + bound_length + ix])) {
                     misses += 1;
                 }
-                if (fetch_backup_pres[iy * wnz * wnx + iz * wnx + (wnx - bound_length - 1) - ix] != 0.25) {
+                if (!is_restored(fetch_backup_pres[iy * wnz * wnx + iz * wnx + (wnx - bound_length - 1) - ix])) {
                     misses += 1;
                 }
             }
@@ -553,10 +562,10 @@ void TEST_CASE_FORWARD_COLLECTOR_REVERSE_INC_INJECTION(GridBox *apGridBox,
     for (int iy = start_y; iy < end_y; iy++) {
         for (int iz = 0; iz < half_length; iz++) {
             for (int ix = start_x; ix < end_x; ix++) {
-                if (fetch_backup_pres[iy * wnz * wnx + (bound_length + iz) * wnx + ix] != 0.25) {
+                if (!is_restored(fetch_backup_pres[iy * wnz * wnx + (bound_length + iz) * wnx + ix])) {
                     misses += 1;
                 }
-                if (fetch_backup_pres[iy * wnz * wnx + (wnz - bound_length - 1 - iz) * wnx + ix] != 0.25) {
+                if (!is_restored(fetch_backup_pres[iy * wnz * wnx + (wnz - bound_length - 1 - iz) * wnx + ix])) {
                     misses += 1;
                 }
             }
@@ -566,10 +575,10 @@ void TEST_CASE_FORWARD_COLLECTOR_REVERSE_INC_INJECTION(GridBox *apGridBox,
         for (int iy = 0; iy < half_length; iy++) {
             for (int iz = start_z; iz < end_z; iz++) {
                 for (int ix = start_x; ix < end_x; ix++) {
-                    if (fetch_backup_pres[(bound_length + iy) * wnz * wnx + iz * wnx + ix] != 0.25) {
+                    if (!is_restored(fetch_backup_pres[(bound_length + iy) * wnz * wnx + iz * wnx + ix])) {
                         misses += 1;
                     }
-                    if (fetch_backup_pres[(wny - bound_length - 1 - iy) * wnz * wnx + iz * wnx + ix] != 0.250) {
+                    if (!is_restored(fetch_backup_pres[(wny - bound_length - 1 - iy) * wnz * wnx + iz * wnx + ix])) {
                         misses += 1;
                     }
                 }
@@ -614,4 +623,27 @@ TEST_CASE("Reverse Forward Collector Injection - 2D - Window", "[Window],[2D]")
             generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
             generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
             generate_average_case_configuration_map_wave());
-}
\ No newline at end of file
+}
+
+TEST_CASE("Reverse Forward Collector Injection - 3D - No Window", "[No Window],[3D]") {
+    TEST_CASE_FORWARD_COLLECTOR_REVERSE_INC_INJECTION(
+            generate_grid_box(OP_TU_3D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+TEST_CASE("Reverse Forward Collector Injection - 2D - No Window - Compressed", "[No Window],[2D]") {
+    TEST_CASE_FORWARD_COLLECTOR_REVERSE_INC_INJECTION(
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave(),
+            true);
+}
+
+TEST_CASE("Reverse Forward Collector Injection - 3D - Window - Compressed", "[Window],[3D]") {
+    TEST_CASE_FORWARD_COLLECTOR_REVERSE_INC_INJECTION(
+            generate_grid_box(OP_TU_3D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave(),
+            true);
+}
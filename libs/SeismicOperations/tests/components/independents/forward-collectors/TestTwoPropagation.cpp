@@ -17,11 +17,20 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstdio>
+#include <string>
+#include <vector>
+
 #include <prerequisites/libraries/catch/catch.hpp>
 
+#include <bs/base/configurations/concrete/JSONConfigurationMap.hpp>
+
 #include <operations/components/independents/concrete/forward-collectors/TwoPropagation.hpp>
 #include <operations/common/DataTypes.h>
 #include <operations/components/dependents/concrete/memory-handlers/WaveFieldsMemoryHandler.hpp>
+#include <operations/components/independents/concrete/computation-kernels/isotropic/SecondOrderComputationKernel.hpp>
+#include <operations/components/independents/concrete/source-injectors/RickerSourceInjector.hpp>
+#include <operations/configurations/MapKeys.h>
 #include <operations/test-utils/dummy-data-generators/DummyConfigurationMapGenerator.hpp>
 #include <operations/test-utils/dummy-data-generators/DummyGridBoxGenerator.hpp>
 #include <operations/test-utils/dummy-data-generators/DummyParametersGenerator.hpp>
@@ -959,4 +968,148 @@ TEST_CASE("TwoForward Collector Injection no parallel  - 2D - Window", "[Window]
             generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
             generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
             generate_average_case_configuration_map_wave());
-}
\ No newline at end of file
+}
+/**
+ * @note
+ * Runs the forward and backward loops the same way the RTM engine does, and
+ * returns the forward states fetched during the backward propagation, along
+ * with the states saved at each forward step. A positive memory budget forces
+ * the snapshots through the asynchronous spill ring.
+ */
+void RUN_FORWARD_COLLECTOR_TWO(float aMemoryBudgetFrames,
+                               vector<vector<float>> &aSaved,
+                               vector<vector<float>> &aFetched) {
+    set_environment();
+
+    auto grid_box = generate_grid_box(OP_TU_2D, OP_TU_NO_WIND);
+    auto parameters = generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC);
+
+    auto pressure_curr = new FrameBuffer<float>();
+    auto pressure_prev = new FrameBuffer<float>();
+    auto velocity = new FrameBuffer<float>();
+
+    uint nt = 60;
+    grid_box->SetNT(nt);
+
+    int nx = grid_box->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
+    int ny = grid_box->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
+    int nz = grid_box->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
+
+    int wnx = grid_box->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wny = grid_box->GetWindowAxis()->GetYAxis().GetActualAxisSize();
+    int wnz = grid_box->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    uint window_size = wnx * wny * wnz;
+    uint size = nx * ny * nz;
+
+    pressure_curr->Allocate(window_size);
+    pressure_prev->Allocate(window_size);
+    velocity->Allocate(size);
+    Device::MemSet(pressure_curr->GetNativePointer(), 0.0f, window_size * sizeof(float));
+    Device::MemSet(pressure_prev->GetNativePointer(), 0.0f, window_size * sizeof(float));
+
+    grid_box->RegisterWaveField(WAVE | GB_PRSS | CURR | DIR_Z, pressure_curr);
+    grid_box->RegisterWaveField(WAVE | GB_PRSS | PREV | DIR_Z, pressure_prev);
+    grid_box->RegisterParameter(PARM | GB_VEL, velocity);
+
+    vector<float> temp_vel(size);
+    float dt = grid_box->GetDT();
+    for (uint i = 0; i < size; i++) {
+        temp_vel[i] = 1500 * 1500 * dt * dt;
+    }
+    Device::MemCpy(velocity->GetNativePointer(), temp_vel.data(), size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+
+    nlohmann::json json_map;
+    json_map[OP_K_PROPRIETIES][OP_K_WRITE_PATH] = OPERATIONS_TEST_DATA_PATH;
+    json_map[OP_K_PROPRIETIES][OP_K_COMPRESSION] = false;
+    json_map[OP_K_PROPRIETIES][OP_K_MEMORY_BUDGET] =
+            (aMemoryBudgetFrames * window_size * sizeof(float)) / (1024 * 1024);
+    auto configuration_map = new JSONConfigurationMap(json_map);
+
+    auto memory_handler = new WaveFieldsMemoryHandler(configuration_map);
+    memory_handler->SetComputationParameters(parameters);
+    auto dependent_components_map = new ComponentsMap<DependentComponent>();
+    dependent_components_map->Set(MEMORY_HANDLER, memory_handler);
+
+    auto forward_collector = new TwoPropagation(configuration_map);
+    forward_collector->SetComputationParameters(parameters);
+    forward_collector->SetDependentComponents(dependent_components_map);
+    forward_collector->SetGridBox(grid_box);
+    forward_collector->AcquireConfiguration();
+
+    auto computation_kernel = new SecondOrderComputationKernel(configuration_map);
+    computation_kernel->SetGridBox(grid_box);
+    computation_kernel->SetComputationParameters(parameters);
+    computation_kernel->SetMode(KERNEL_MODE::FORWARD);
+
+    auto source_point = new Point3D(wnx / 2, wny / 2, wnz / 2);
+    auto source_injector = new RickerSourceInjector(configuration_map);
+    source_injector->SetComputationParameters(parameters);
+    source_injector->SetGridBox(grid_box);
+    source_injector->SetSourcePoint(source_point);
+
+    forward_collector->ResetGrid(true);
+    for (uint it = 1; it < nt; it++) {
+        forward_collector->SaveForward();
+        source_injector->ApplySource(it);
+        float *curr = grid_box->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetHostPointer();
+        aSaved.emplace_back(curr, curr + window_size);
+        computation_kernel->Step();
+    }
+
+    forward_collector->ResetGrid(false);
+    for (uint it = nt - 1; it > 0; it--) {
+        forward_collector->FetchForward();
+        float *curr = forward_collector->GetForwardGrid()->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetHostPointer();
+        aFetched.emplace_back(curr, curr + window_size);
+    }
+
+    delete forward_collector;
+    delete source_injector;
+    delete source_point;
+    delete computation_kernel;
+    delete dependent_components_map;
+    delete memory_handler;
+    delete configuration_map;
+    delete grid_box;
+    delete parameters;
+
+    for (uint block = 0; block < nt; block++) {
+        string path = string(OPERATIONS_TEST_DATA_PATH) + "/two_prop/temp_" + to_string(block);
+        remove(path.c_str());
+    }
+}
+
+void TEST_FETCHED_IN_REVERSE(float aMemoryBudgetFrames) {
+    vector<vector<float>> saved;
+    vector<vector<float>> fetched;
+    RUN_FORWARD_COLLECTOR_TWO(aMemoryBudgetFrames, saved, fetched);
+
+    REQUIRE(fetched.size() == saved.size());
+
+    int misses = 0;
+    int non_zeros = 0;
+    for (uint it = 0; it < fetched.size(); it++) {
+        auto const &expected = saved[saved.size() - 1 - it];
+        for (uint index = 0; index < expected.size(); index++) {
+            if (fetched[it][index] != expected[index]) {
+                misses++;
+            }
+            if (fetched[it][index] != 0) {
+                non_zeros++;
+            }
+        }
+    }
+    REQUIRE(misses == 0);
+    REQUIRE(non_zeros > 0);
+}
+
+TEST_CASE("Two Forward Collector - 2D - Fetch In Reverse", "[No Window],[2D]") {
+    /* All the snapshots in memory. */
+    TEST_FETCHED_IN_REVERSE(0);
+}
+
+TEST_CASE("Two Forward Collector - 2D - Spill Ring", "[No Window],[2D]") {
+    /* Room for 16 snapshots, spilled in blocks of 3 through a ring of 2 slots. */
+    TEST_FETCHED_IN_REVERSE(16);
+}
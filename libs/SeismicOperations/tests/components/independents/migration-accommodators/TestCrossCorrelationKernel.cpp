@@ -17,9 +17,15 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string>
+#include <vector>
+
 #include <prerequisites/libraries/catch/catch.hpp>
 
+#include <bs/base/configurations/concrete/JSONConfigurationMap.hpp>
+
 #include <operations/components/independents/concrete/migration-accommodators/CrossCorrelationKernel.hpp>
+#include <operations/components/independents/concrete/computation-kernels/isotropic/SecondOrderComputationKernel.hpp>
 #include <operations/configurations/MapKeys.h>
 #include <operations/data-units/concrete/holders/FrameBuffer.hpp>
 #include <operations/common/DataTypes.h>
@@ -453,6 +459,126 @@ void TEST_CASE_CROSS_CORRELATION_NO_COMPENSATION(GridBox *apGridBox,
     delete uut;
 }
 
+/**
+ * @note
+ * Runs the same backward step with the correlation as a separate pass and
+ * fused into the computation kernel, both should give the same image.
+ */
+void TEST_CASE_CROSS_CORRELATION_FUSED(GridBox *apGridBox,
+                                       ComputationParameters *apParameters,
+                                       const string &aCompensation) {
+    set_environment();
+
+    auto *forward_gridbox = new GridBox;
+    apGridBox->SetNT(1);
+    apGridBox->Clone(forward_gridbox);
+
+    int nx = apGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
+    int ny = apGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
+    int nz = apGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
+
+    int wnx = apGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wny = apGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
+    int wnz = apGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    uint window_size = wnx * wny * wnz;
+    uint size = nx * ny * nz;
+
+    auto pressure_curr = new FrameBuffer<float>(window_size);
+    auto pressure_prev = new FrameBuffer<float>(window_size);
+    auto pressure_forward = new FrameBuffer<float>(window_size);
+    auto velocity = new FrameBuffer<float>(size);
+    auto window_velocity = new FrameBuffer<float>(window_size);
+
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | CURR | DIR_Z, pressure_curr);
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | PREV | DIR_Z, pressure_prev);
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | NEXT | DIR_Z, pressure_prev);
+    apGridBox->RegisterParameter(PARM | GB_VEL, velocity, window_velocity);
+    forward_gridbox->RegisterWaveField(WAVE | GB_PRSS | CURR | DIR_Z, pressure_forward);
+
+    vector<float> curr(window_size), prev(window_size), forward(window_size);
+    vector<float> temp_vel(window_size);
+    float dt = apGridBox->GetDT();
+    for (uint i = 0; i < window_size; i++) {
+        curr[i] = (float) rand() / RAND_MAX;
+        prev[i] = (float) rand() / RAND_MAX;
+        forward[i] = (float) rand() / RAND_MAX;
+        temp_vel[i] = 1500 * 1500 * dt * dt;
+    }
+    Device::MemCpy(window_velocity->GetNativePointer(), temp_vel.data(),
+                   window_size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+    Device::MemCpy(pressure_forward->GetNativePointer(), forward.data(),
+                   window_size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+
+    nlohmann::json json_map;
+    json_map[OP_K_PROPRIETIES][OP_K_COMPENSATION] = aCompensation;
+    json_map[OP_K_PROPRIETIES][OP_K_FUSED_CORRELATION] = true;
+    auto configuration_map = new JSONConfigurationMap(json_map);
+
+    vector<vector<float>> correlations;
+    vector<vector<float>> stacks;
+    for (int run = 0; run < 2; run++) {
+        Device::MemCpy(apGridBox->Get(WAVE | GB_PRSS | CURR | DIR_Z)->GetNativePointer(), curr.data(),
+                       window_size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+        Device::MemCpy(apGridBox->Get(WAVE | GB_PRSS | PREV | DIR_Z)->GetNativePointer(), prev.data(),
+                       window_size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+
+        auto computation_kernel = new SecondOrderComputationKernel(configuration_map);
+        computation_kernel->SetComputationParameters(apParameters);
+        computation_kernel->SetGridBox(apGridBox);
+        computation_kernel->SetMode(KERNEL_MODE::ADJOINT);
+
+        auto uut = new CrossCorrelationKernel(configuration_map);
+        uut->SetComputationParameters(apParameters);
+        uut->SetGridBox(apGridBox);
+        uut->AcquireConfiguration();
+
+        bool fused = false;
+        if (run == 1) {
+            fused = uut->FuseInto(computation_kernel, forward_gridbox);
+#if defined(USING_OMP)
+            REQUIRE(fused);
+#endif
+        }
+        computation_kernel->Step();
+        if (!fused) {
+            uut->Correlate(forward_gridbox);
+        }
+        uut->Stack();
+
+        float *correlation = uut->GetShotCorrelation()->GetHostPointer();
+        float *stack = uut->GetStackedShotCorrelation()->GetHostPointer();
+        correlations.emplace_back(correlation, correlation + window_size);
+        stacks.emplace_back(stack, stack + size);
+
+        delete uut;
+        delete computation_kernel;
+    }
+
+    int misses = 0;
+    for (uint i = 0; i < window_size; i++) {
+        misses += !approximately_equal(correlations[0][i], correlations[1][i]);
+    }
+    REQUIRE(misses == 0);
+
+    misses = 0;
+    for (uint i = 0; i < size; i++) {
+        misses += !approximately_equal(stacks[0][i], stacks[1][i]);
+    }
+    REQUIRE(misses == 0);
+
+    delete configuration_map;
+    delete pressure_curr;
+    delete pressure_prev;
+    delete pressure_forward;
+    delete velocity;
+    delete window_velocity;
+    delete forward_gridbox;
+
+    delete apGridBox;
+    delete apParameters;
+}
+
 TEST_CASE("CrossCorrelation - No Compensation - 2D - No Window", "[No Window],[2D]") {
     TEST_CASE_CROSS_CORRELATION_NO_COMPENSATION(
             generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
@@ -467,6 +593,20 @@ TEST_CASE("CrossCorrelation - No Compensation - 2D - Window", "[Window],[2D]") {
             generate_average_case_configuration_map_wave());
 }
 
+TEST_CASE("CrossCorrelation - No Compensation - 3D - No Window", "[No Window],[3D]") {
+    TEST_CASE_CROSS_CORRELATION_NO_COMPENSATION(
+            generate_grid_box(OP_TU_3D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+TEST_CASE("CrossCorrelation - No Compensation - 3D - Window", "[Window],[3D]") {
+    TEST_CASE_CROSS_CORRELATION_NO_COMPENSATION(
+            generate_grid_box(OP_TU_3D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
 TEST_CASE("CrossCorrelation - Combined Compensation - 2D - No Window", "[No Window],[2D]") {
     TEST_CASE_CROSS_CORRELATION_COMBINED_COMPENSATION(
             generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
@@ -480,3 +620,59 @@ TEST_CASE("CrossCorrelation - Combined Compensation - 2D - Window", "[Window],[2
             generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
             generate_average_case_configuration_map_wave());
 }
+
+TEST_CASE("CrossCorrelation - Combined Compensation - 3D - No Window", "[No Window],[3D]") {
+    TEST_CASE_CROSS_CORRELATION_COMBINED_COMPENSATION(
+            generate_grid_box(OP_TU_3D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+TEST_CASE("CrossCorrelation - Combined Compensation - 3D - Window", "[Window],[3D]") {
+    TEST_CASE_CROSS_CORRELATION_COMBINED_COMPENSATION(
+            generate_grid_box(OP_TU_3D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            generate_average_case_configuration_map_wave());
+}
+
+TEST_CASE("CrossCorrelation - Fused - No Compensation - 2D - No Window", "[No Window],[2D]") {
+    TEST_CASE_CROSS_CORRELATION_FUSED(
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            OP_K_COMPENSATION_NONE);
+}
+
+TEST_CASE("CrossCorrelation - Fused - Combined Compensation - 2D - No Window", "[No Window],[2D]") {
+    TEST_CASE_CROSS_CORRELATION_FUSED(
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            OP_K_COMPENSATION_COMBINED);
+}
+
+TEST_CASE("CrossCorrelation - Fused - No Compensation - 2D - Window", "[Window],[2D]") {
+    TEST_CASE_CROSS_CORRELATION_FUSED(
+            generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            OP_K_COMPENSATION_NONE);
+}
+
+TEST_CASE("CrossCorrelation - Fused - Combined Compensation - 2D - Window", "[Window],[2D]") {
+    TEST_CASE_CROSS_CORRELATION_FUSED(
+            generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
+            OP_K_COMPENSATION_COMBINED);
+}
+
+TEST_CASE("CrossCorrelation - Fused - No Compensation - 3D - No Window", "[No Window],[3D]") {
+    TEST_CASE_CROSS_CORRELATION_FUSED(
+            generate_grid_box(OP_TU_3D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            OP_K_COMPENSATION_NONE);
+}
+
+TEST_CASE("CrossCorrelation - Fused - Combined Compensation - 3D - No Window", "[No Window],[3D]") {
+    TEST_CASE_CROSS_CORRELATION_FUSED(
+            generate_grid_box(OP_TU_3D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC),
+            OP_K_COMPENSATION_COMBINED);
+}
@@ -20,6 +20,8 @@
 #include <map>
 #include <string>
 
+#include <sys/mman.h>
+
 #include <prerequisites/libraries/catch/catch.hpp>
 
 #include <bs/base/logger/concrete/LoggerSystem.hpp>
@@ -196,4 +198,70 @@ TEST_CASE("SeismicModelHandler - 2D - Window - ISO", "[Window],[2D],[ISO]") {
             generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
             generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
             generate_average_case_configuration_map_wave());
-}
\ No newline at end of file
+}
+
+TEST_CASE("SeismicModelHandler - 3D - Window Beyond 4G Cells", "[Window],[3D],[Large]") {
+    set_environment();
+
+    /// The full model spans more than 2^32 cells, only the pages under the window get touched.
+    uint nx = 1024, ny = 4200, nz = 1024;
+    uint wnx = 16, wny = 16, wnz = 16;
+    uint sx = 100, sy = 4100, sz = 200;
+    size_t model_size = (size_t) nx * ny * nz;
+    auto model = (float *) mmap(nullptr, model_size * sizeof(float), PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    REQUIRE(model != MAP_FAILED);
+
+    auto parameters = new ComputationParameters(O_8);
+    parameters->SetBoundaryLength(0);
+    parameters->SetIsUsingWindow(true);
+
+    auto grid_box = new GridBox();
+    grid_box->SetAfterSamplingAxis(new Axis3D<unsigned int>(nx, ny, nz));
+    grid_box->SetWindowAxis(new Axis3D<unsigned int>(wnx, wny, wnz));
+    grid_box->SetWindowStart(X_AXIS, sx);
+    grid_box->SetWindowStart(Y_AXIS, sy);
+    grid_box->SetWindowStart(Z_AXIS, sz);
+
+    auto full = new FrameBuffer<float>();
+    full->SetNativePointer(model);
+    auto window = new FrameBuffer<float>((size_t) wnx * wny * wnz);
+    grid_box->RegisterParameter(PARM | GB_VEL, full, window);
+
+    uint offset = parameters->GetHalfLength();
+    for (uint iy = offset; iy < wny - offset; iy++) {
+        for (uint iz = offset; iz < wnz - offset; iz++) {
+            for (uint ix = offset; ix < wnx - offset; ix++) {
+                model[(size_t) (iy + sy) * nx * nz + (iz + sz) * nx + ix + sx] =
+                        1.0f + ix + 100.0f * iz + 10000.0f * iy;
+            }
+        }
+    }
+
+    auto configuration_map = generate_average_case_configuration_map_wave();
+    auto model_handler = new SeismicModelHandler(configuration_map);
+    model_handler->SetComputationParameters(parameters);
+    model_handler->SetGridBox(grid_box);
+    model_handler->SetupWindow();
+
+    float *window_values = window->GetHostPointer();
+    int misses = 0;
+    for (uint iy = offset; iy < wny - offset; iy++) {
+        for (uint iz = offset; iz < wnz - offset; iz++) {
+            for (uint ix = offset; ix < wnx - offset; ix++) {
+                misses += window_values[(size_t) iy * wnx * wnz + iz * wnx + ix] !=
+                          1.0f + ix + 100.0f * iz + 10000.0f * iy;
+            }
+        }
+    }
+    REQUIRE(misses == 0);
+
+    full->SetNativePointer(nullptr);
+    munmap(model, model_size * sizeof(float));
+    delete model_handler;
+    delete full;
+    delete window;
+    delete grid_box;
+    delete parameters;
+    delete configuration_map;
+}
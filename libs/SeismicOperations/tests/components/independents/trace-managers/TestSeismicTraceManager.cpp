@@ -17,10 +17,17 @@
  * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <vector>
+
 #include <prerequisites/libraries/catch/catch.hpp>
 
+#include <bs/base/configurations/concrete/JSONConfigurationMap.hpp>
+#include <bs/base/memory/MemoryManager.hpp>
+
 #include <operations/components/independents/concrete/trace-managers/SeismicTraceManager.hpp>
 #include <operations/common/DataTypes.h>
+#include <operations/configurations/MapKeys.h>
+#include <operations/utils/io/read_utils.h>
 #include <operations/utils/io/write_utils.h>
 #include <operations/test-utils/dummy-data-generators/DummyConfigurationMapGenerator.hpp>
 #include <operations/test-utils/dummy-data-generators/DummyGridBoxGenerator.hpp>
@@ -36,6 +43,8 @@ using namespace operations::common;
 using namespace operations::dataunits;
 using namespace operations::testutils;
 using namespace operations::utils::io;
+using namespace bs::io::dataunits;
+using namespace bs::base::memory;
 
 #define TRACE_STRIDE_X 3
 #define TRACE_STRIDE_Y 4
@@ -202,6 +211,285 @@ void TEST_CASE_TRACE_MANAGER(GridBox *apGridBox,
     delete uut;
 }
 
+/**
+ * @note
+ * Injects the single receiver of the first shot half way between two grid
+ * points with the sinc injection, and checks that it gets spread evenly
+ * over both points while keeping the amplitude injected by a point receiver.
+ */
+void TEST_CASE_TRACE_MANAGER_SINC(GridBox *apGridBox,
+                                  ComputationParameters *apParameters) {
+    set_environment();
+
+    auto pressure_curr = new FrameBuffer<float>();
+    auto pressure_prev = new FrameBuffer<float>();
+    auto velocity = new FrameBuffer<float>();
+
+    int nx = apGridBox->GetAfterSamplingAxis()->GetXAxis().GetActualAxisSize();
+    int ny = apGridBox->GetAfterSamplingAxis()->GetYAxis().GetActualAxisSize();
+    int nz = apGridBox->GetAfterSamplingAxis()->GetZAxis().GetActualAxisSize();
+
+    int wnx = apGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wny = apGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
+    int wnz = apGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    uint window_size = wnx * wny * wnz;
+    uint size = nx * ny * nz;
+
+    pressure_curr->Allocate(window_size);
+    pressure_prev->Allocate(window_size);
+    velocity->Allocate(size);
+
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | CURR | DIR_Z, pressure_curr);
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | PREV | DIR_Z, pressure_prev);
+    apGridBox->RegisterWaveField(WAVE | GB_PRSS | NEXT | DIR_Z, pressure_prev);
+    apGridBox->RegisterParameter(PARM | GB_VEL, velocity);
+
+    float dt = apGridBox->GetDT();
+    vector<float> temp_vel(size, 1500 * 1500 * dt * dt);
+    Device::MemSet(pressure_curr->GetNativePointer(), 0.0f, window_size * sizeof(float));
+    Device::MemSet(pressure_prev->GetNativePointer(), 0.0f, window_size * sizeof(float));
+    Device::MemCpy(velocity->GetNativePointer(), temp_vel.data(), size * sizeof(float), Device::COPY_HOST_TO_DEVICE);
+
+    nlohmann::json json_map;
+    json_map[OP_K_PROPRIETIES][OP_K_RECEIVER_INJECTION] = OP_K_SINC;
+    auto configuration_map = new JSONConfigurationMap(json_map);
+
+    auto uut = new SeismicTraceManager(configuration_map);
+    uut->SetComputationParameters(apParameters);
+    uut->SetGridBox(apGridBox);
+    uut->AcquireConfiguration();
+
+    std::stringstream ss;
+    ss << OPERATIONS_TEST_DATA_PATH << "/dummy_trace_sinc_" << wnx << "_" << wnz << "_" << wny << std::endl;
+    std::string file_name = ss.str();
+    auto ground_truth = generate_dummy_trace(file_name, apGridBox,
+                                             TRACE_STRIDE_X,
+                                             TRACE_STRIDE_Y);
+    file_name += ".segy";
+    std::vector<std::string> files;
+    files.push_back(file_name);
+
+    auto shots = uut->GetWorkingShots(files, 0, wnx * wny, "CSR");
+    REQUIRE(!shots.empty());
+
+    uut->ReadShot(files, shots[0], "CSR");
+    REQUIRE(uut->GetTracesHolder()->ShiftsX != nullptr);
+    REQUIRE(uut->GetTracesHolder()->ShiftsX[0] == Approx(0.0f).margin(1e-4));
+    uut->GetTracesHolder()->ShiftsX[0] = 0.5f;
+    uut->PreprocessShot();
+
+    uint pos = (apParameters->GetBoundaryLength() + apParameters->GetHalfLength()) *
+               wnx + uut->GetTracesHolder()->PositionsX[0];
+
+    uut->ApplyTraces(apGridBox->GetNT() - 1);
+    float test_value = uut->GetTracesHolder()->Traces->GetHostPointer()[wnz - 1] * 1500 * 1500 * dt * dt;
+
+    float *pressure = pressure_curr->GetHostPointer();
+    float row_sum = 0;
+    for (int ix = 0; ix < wnx; ix++) {
+        row_sum += pressure[pos - uut->GetTracesHolder()->PositionsX[0] + ix];
+    }
+    REQUIRE(approximately_equal(row_sum, test_value, 0.05));
+#if defined(USING_OMP)
+    REQUIRE(approximately_equal(pressure[pos], pressure[pos + 1], 1e-4));
+    REQUIRE(fabs(pressure[pos]) < fabs(test_value));
+#endif
+
+    remove(file_name.c_str());
+
+    delete ground_truth;
+
+    delete pressure_curr;
+    delete pressure_prev;
+    delete velocity;
+
+    delete apGridBox;
+    delete apParameters;
+    delete configuration_map;
+    delete uut;
+}
+
+/**
+ * @note
+ * Prefetches the second shot while the first one is read, and checks that
+ * handing it over gives the same traces, geometry and grid meta data as
+ * reading it directly.
+ */
+void TEST_CASE_TRACE_MANAGER_PREFETCH(GridBox *apGridBox,
+                                      ComputationParameters *apParameters) {
+    set_environment();
+
+    int wnx = apGridBox->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    int wny = apGridBox->GetWindowAxis()->GetYAxis().GetActualAxisSize();
+    int wnz = apGridBox->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    auto configuration_map = generate_average_case_configuration_map_wave();
+    nlohmann::json json_map;
+    json_map[OP_K_PROPRIETIES][OP_K_SHOT_PREFETCH] = true;
+    auto prefetch_configuration_map = new JSONConfigurationMap(json_map);
+    auto uut = new SeismicTraceManager(prefetch_configuration_map);
+    uut->SetComputationParameters(apParameters);
+    uut->SetGridBox(apGridBox);
+    uut->AcquireConfiguration();
+
+    auto reference = new SeismicTraceManager(configuration_map);
+    reference->SetComputationParameters(apParameters);
+    reference->SetGridBox(apGridBox);
+    reference->AcquireConfiguration();
+
+    std::stringstream ss;
+    ss << OPERATIONS_TEST_DATA_PATH << "/dummy_trace_prefetch_" << wnx << "_" << wnz << "_" << wny << std::endl;
+    std::string file_name = ss.str();
+    auto ground_truth = generate_dummy_trace(file_name, apGridBox,
+                                             TRACE_STRIDE_X,
+                                             TRACE_STRIDE_Y);
+    file_name += ".segy";
+    std::vector<std::string> files;
+    files.push_back(file_name);
+
+    auto shots = uut->GetWorkingShots(files, 0, wnx * wny, "CSR");
+    reference->GetWorkingShots(files, 0, wnx * wny, "CSR");
+    REQUIRE(shots.size() > 2);
+
+    uut->ReadShot(files, shots[0], "CSR");
+    uut->PrefetchShot(files, shots[2], "CSR");
+    uut->ReadShot(files, shots[2], "CSR");
+    uint nt = apGridBox->GetNT();
+    uint window_start = apGridBox->GetWindowStart(X_AXIS);
+
+    reference->ReadShot(files, shots[2], "CSR");
+    REQUIRE(apGridBox->GetNT() == nt);
+    REQUIRE(apGridBox->GetWindowStart(X_AXIS) == window_start);
+
+    auto traces = uut->GetTracesHolder();
+    auto expected = reference->GetTracesHolder();
+    REQUIRE(traces->TraceSizePerTimeStep == expected->TraceSizePerTimeStep);
+    REQUIRE(traces->SampleNT == expected->SampleNT);
+    REQUIRE(traces->PositionsX[0] == expected->PositionsX[0]);
+    REQUIRE(traces->PositionsY[0] == expected->PositionsY[0]);
+    REQUIRE(uut->GetSourcePoint()->x == reference->GetSourcePoint()->x);
+    REQUIRE(uut->GetSourcePoint()->z == reference->GetSourcePoint()->z);
+
+    int misses = 0;
+    for (uint i = 0; i < traces->SampleNT * traces->TraceSizePerTimeStep; i++) {
+        if (traces->Traces->GetHostPointer()[i] != expected->Traces->GetHostPointer()[i]) {
+            misses++;
+        }
+    }
+    REQUIRE(misses == 0);
+
+    /* A prefetch of another shot is dropped. */
+    uut->PrefetchShot(files, shots[1], "CSR");
+    uut->ReadShot(files, shots[0], "CSR");
+    REQUIRE(uut->GetTracesHolder()->Traces != nullptr);
+
+    remove(file_name.c_str());
+
+    delete ground_truth;
+
+    delete uut;
+    delete reference;
+    delete configuration_map;
+    delete prefetch_configuration_map;
+    delete apGridBox;
+    delete apParameters;
+}
+
+/**
+ * @note
+ * Parses shots with the window sized and placed over their acquisition span, and
+ * checks the window start and size, its depth, the source position and the receivers
+ * kept for a span that fits the window, one wider than the window and one at the
+ * domain edge.
+ */
+void TEST_CASE_TRACE_MANAGER_ADAPTIVE_WINDOW(int aSource, int aFirstReceiver, int aLastReceiver,
+                                             float aApertureAngle, int aExpectedStart,
+                                             int aExpectedSize, int aExpectedDepth) {
+    set_environment();
+
+    int nx = 42;
+    int nz = 30;
+    int wnx = 12;
+    float dx = 10.0f;
+    float dt = 0.001f;
+    uint ns = 8;
+
+    auto parameters = generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC);
+    parameters->SetIsAdaptiveWindow(true);
+    parameters->SetWindowAperture(2);
+    parameters->SetWindowApertureAngle(aApertureAngle);
+    int offset = parameters->GetBoundaryLength() + parameters->GetHalfLength();
+
+    auto grid_box = new GridBox();
+    grid_box->SetAfterSamplingAxis(new Axis3D<unsigned int>(nx, 1, nz));
+    grid_box->SetWindowAxis(new Axis3D<unsigned int>(wnx, 1, nz));
+    for (auto axis : {grid_box->GetAfterSamplingAxis(), grid_box->GetWindowAxis()}) {
+        axis->GetXAxis().AddBoundary(OP_DIREC_BOTH, parameters->GetBoundaryLength());
+        axis->GetXAxis().AddHalfLengthPadding(OP_DIREC_BOTH, parameters->GetHalfLength());
+        axis->GetZAxis().AddBoundary(OP_DIREC_BOTH, parameters->GetBoundaryLength());
+        axis->GetZAxis().AddHalfLengthPadding(OP_DIREC_BOTH, parameters->GetHalfLength());
+        axis->GetXAxis().SetCellDimension(dx);
+        axis->GetZAxis().SetCellDimension(dx);
+    }
+    grid_box->SetInitialAxis(new Axis3D<unsigned int>(*grid_box->GetAfterSamplingAxis()));
+    grid_box->SetDT(dt);
+    uint actual_wnx = grid_box->GetWindowAxis()->GetXAxis().GetActualAxisSize();
+    uint actual_wnz = grid_box->GetWindowAxis()->GetZAxis().GetActualAxisSize();
+
+    auto gather = new Gather();
+    for (int gx = aFirstReceiver; gx <= aLastReceiver; gx++) {
+        auto trace = new Trace(ns);
+        trace->SetTraceHeaderKeyValue(TraceHeaderKey::SCALCO, (int16_t) -1);
+        trace->SetScaledCoordinateHeader(TraceHeaderKey::SX, aSource * dx);
+        trace->SetScaledCoordinateHeader(TraceHeaderKey::SY, 0);
+        trace->SetScaledCoordinateHeader(TraceHeaderKey::GX, gx * dx);
+        trace->SetScaledCoordinateHeader(TraceHeaderKey::GY, 0);
+        trace->SetTraceHeaderKeyValue(TraceHeaderKey::DT, (uint16_t) (dt * 1e6));
+        trace->SetTraceData(new float[ns]);
+        for (uint is = 0; is < ns; is++) {
+            trace->GetTraceData()[is] = gx;
+        }
+        gather->AddTrace(trace);
+    }
+    gather->SetSamplingRate(dt * 1e6);
+
+    Point3D source;
+    TracesHolder traces;
+    uint *x_position;
+    uint *y_position;
+    float total_time;
+    ParseGatherToTraces(gather, &source, &traces, &x_position, &y_position,
+                        grid_box, parameters, &total_time);
+
+    int first_kept = std::max(aFirstReceiver, aExpectedStart);
+    int last_kept = std::min(aLastReceiver, aExpectedStart + aExpectedSize - 1);
+
+    /* The window shrinks inside the allocated points, its stride is kept. */
+    REQUIRE(grid_box->GetWindowStart(X_AXIS) == aExpectedStart);
+    REQUIRE(grid_box->GetWindowAxis()->GetXAxis().GetAxisSize() == aExpectedSize);
+    REQUIRE(grid_box->GetWindowAxis()->GetZAxis().GetAxisSize() == aExpectedDepth);
+    REQUIRE(grid_box->GetWindowAxis()->GetXAxis().GetActualAxisSize() == actual_wnx);
+    REQUIRE(grid_box->GetWindowAxis()->GetZAxis().GetActualAxisSize() == actual_wnz);
+    REQUIRE(source.x == aSource - aExpectedStart + offset);
+    REQUIRE(traces.TraceSizePerTimeStep == last_kept - first_kept + 1);
+    for (uint i = 0; i < traces.TraceSizePerTimeStep; i++) {
+        int gx = gather->GetTrace(i)->GetTraceData()[0];
+        REQUIRE(gx >= first_kept);
+        REQUIRE(gx <= last_kept);
+        REQUIRE(x_position[i] == gx - aExpectedStart + offset);
+    }
+
+    delete traces.Traces;
+    mem_free(x_position);
+    mem_free(y_position);
+    mem_free(traces.ShiftsX);
+    mem_free(traces.ShiftsY);
+    delete gather;
+    delete parameters;
+    delete grid_box;
+}
+
 TEST_CASE("SeismicTraceManager - 2D - No Window", "[No Window],[2D]") {
     TEST_CASE_TRACE_MANAGER(
             generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
@@ -215,3 +503,32 @@ TEST_CASE("SeismicTraceManager - 2D - Window", "[Window],[2D]") {
             generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC),
             generate_average_case_configuration_map_wave());
 }
+
+TEST_CASE("SeismicTraceManager - 2D - Sinc Injection", "[No Window],[2D]") {
+    TEST_CASE_TRACE_MANAGER_SINC(
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC));
+}
+
+TEST_CASE("SeismicTraceManager - 2D - Prefetch - No Window", "[No Window],[2D]") {
+    TEST_CASE_TRACE_MANAGER_PREFETCH(
+            generate_grid_box(OP_TU_2D, OP_TU_NO_WIND),
+            generate_computation_parameters(OP_TU_NO_WIND, ISOTROPIC));
+}
+
+TEST_CASE("SeismicTraceManager - 2D - Prefetch - Window", "[Window],[2D]") {
+    TEST_CASE_TRACE_MANAGER_PREFETCH(
+            generate_grid_box(OP_TU_2D, OP_TU_INC_WIND),
+            generate_computation_parameters(OP_TU_INC_WIND, ISOTROPIC));
+}
+
+TEST_CASE("SeismicTraceManager - 2D - Adaptive Window", "[Window],[2D]") {
+    /* One sided spread fitting the window with its aperture. */
+    TEST_CASE_TRACE_MANAGER_ADAPTIVE_WINDOW(20, 22, 27, 0, 18, 12, 30);
+    /* Spread wider than the window, centred and cut on both sides. */
+    TEST_CASE_TRACE_MANAGER_ADAPTIVE_WINDOW(20, 10, 35, 0, 17, 12, 30);
+    /* Short spread at the end of the domain, clipped to it. */
+    TEST_CASE_TRACE_MANAGER_ADAPTIVE_WINDOW(40, 38, 41, 0, 36, 6, 30);
+    /* Depth cut where the 60 m half width is seen under 60 degrees. */
+    TEST_CASE_TRACE_MANAGER_ADAPTIVE_WINDOW(20, 22, 27, 60, 18, 12, 4);
+}
@@ -180,3 +180,58 @@ TEST_CASE("FrameBuffer - Defined Size", "[FrameBuffer]") {
     delete fb_int;
     delete fb_float;
 }
+
+TEST_CASE("FrameBuffer - Beyond 4 GiB", "[FrameBuffer],[Large]") {
+
+    set_environment();
+
+    /// More than 2^32 bytes, only the pages at the tail get touched.
+    size_t size = (1ULL << 30) + 1024;
+    size_t tail = size - 1024;
+
+    auto fb_float = new FrameBuffer<float>();
+    fb_float->Allocate(size, "large float");
+    REQUIRE(fb_float->GetNativePointer() != nullptr);
+
+    float test_value_float[512];
+    for (int i = 0; i < 512; i++) {
+        test_value_float[i] = 12.5f * i;
+    }
+
+    Device::MemSet(fb_float->GetNativePointer() + tail, 0, sizeof(float) * 1024);
+    Device::MemCpy(fb_float->GetNativePointer() + tail + 512, test_value_float, sizeof(float) * 512);
+
+    float *host = fb_float->GetHostPointer();
+    int misses = 0;
+    for (int i = 0; i < 512; i++) {
+        misses += (0 != host[tail + i]);
+        misses += (test_value_float[i] != host[tail + 512 + i]);
+    }
+    REQUIRE(misses == 0);
+
+    delete fb_float;
+}
+
+TEST_CASE("FrameBuffer - Beyond 4 GiB - Full Set", "[.],[FrameBuffer],[Large]") {
+
+    set_environment();
+
+    /// Touches the whole buffer, hidden by default since it needs more than 4 GiB of memory.
+    size_t size = (1ULL << 30) + 1024;
+
+    auto fb_int = new FrameBuffer<int>();
+    fb_int->Allocate(size, "large int");
+    REQUIRE(fb_int->GetNativePointer() != nullptr);
+
+    char test_value = 2;
+    int eval = test_value << 24 | test_value << 16 | test_value << 8 | test_value;
+
+    Device::MemSet(fb_int->GetNativePointer(), test_value, sizeof(int) * size);
+
+    int *host = fb_int->GetHostPointer();
+    REQUIRE(host[0] == eval);
+    REQUIRE(host[size / 2] == eval);
+    REQUIRE(host[size - 1] == eval);
+
+    delete fb_int;
+}
@@ -0,0 +1,158 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <prerequisites/libraries/catch/catch.hpp>
+
+#include <operations/utils/compressor/Compressor.hpp>
+
+using namespace std;
+using namespace operations::utils::compressors;
+
+#define TOLERANCE 1e-3
+
+
+/**
+ * @note
+ * Compresses smooth snapshots, then checks that they are all restored within
+ * the tolerance, whether decompressed together or each on its own.
+ */
+void TEST_CASE_COMPRESSOR(int nx, int ny, int nz, int nt, unsigned int aCodecType) {
+    size_t snapshot_size = (size_t) nx * ny * nz;
+    vector<float> snapshots(snapshot_size * nt);
+    for (int t = 0; t < nt; t++) {
+        for (size_t i = 0; i < snapshot_size; i++) {
+            snapshots[t * snapshot_size + i] = sinf(0.05f * i + 0.3f * t);
+        }
+    }
+    string path = string(OPERATIONS_TEST_DATA_PATH) + "/compressed_snapshots";
+
+    vector<float> input(snapshots);
+    Compressor::Compress(input.data(), nx, ny, nz, nt, TOLERANCE, aCodecType, path.c_str(), false);
+
+    vector<float> output(snapshot_size * nt);
+    Compressor::Decompress(output.data(), nx, ny, nz, nt, TOLERANCE, aCodecType, path.c_str(), false);
+    float max_error = 0;
+    for (size_t i = 0; i < output.size(); i++) {
+        max_error = fmax(max_error, fabs(output[i] - snapshots[i]));
+    }
+    REQUIRE(max_error <= TOLERANCE);
+
+    vector<float> snapshot(snapshot_size);
+    for (int t = nt - 1; t >= 0; t--) {
+        Compressor::DecompressSnapshot(snapshot.data(), nx, ny, nz, nt, t,
+                                       TOLERANCE, aCodecType, path.c_str(), false);
+        int misses = 0;
+        for (size_t i = 0; i < snapshot_size; i++) {
+            if (snapshot[i] != output[t * snapshot_size + i]) {
+                misses++;
+            }
+        }
+        REQUIRE(misses == 0);
+    }
+
+    remove(path.c_str());
+}
+
+TEST_CASE("Compressor - 2D - Whole Snapshots", "[Compressor],[2D]") {
+    TEST_CASE_COMPRESSOR(23, 1, 21, 5, Compressor::ZFP_SNAPSHOTS);
+}
+
+TEST_CASE("Compressor - 2D - Blocked Snapshots", "[Compressor],[2D]") {
+    TEST_CASE_COMPRESSOR(23, 1, 21, 5, Compressor::ZFP_SLABS);
+}
+
+TEST_CASE("Compressor - 3D - Blocked Snapshots", "[Compressor],[3D]") {
+    TEST_CASE_COMPRESSOR(9, 6, 7, 5, Compressor::ZFP_SLABS);
+}
+
+TEST_CASE("Compressor - 2D - Block Floating Point", "[Compressor],[2D]") {
+    TEST_CASE_COMPRESSOR(23, 1, 21, 5, Compressor::BLOCK_FLOATING_POINT);
+}
+
+TEST_CASE("Compressor - 3D - Block Floating Point", "[Compressor],[3D]") {
+    TEST_CASE_COMPRESSOR(40, 30, 20, 3, Compressor::BLOCK_FLOATING_POINT);
+}
+
+TEST_CASE("Compressor - Block Floating Point - Precision And Size", "[Compressor]") {
+    int nx = 200, nz = 100, nt = 2;
+    size_t snapshot_size = (size_t) nx * nz;
+    vector<float> snapshots(snapshot_size * nt);
+    for (size_t i = 0; i < snapshots.size(); i++) {
+        snapshots[i] = 1000.0f * sinf(0.01f * i);
+    }
+    // Blocks holding values the quantization cannot represent are kept as is.
+    snapshots[7] = INFINITY;
+    string path = string(OPERATIONS_TEST_DATA_PATH) + "/compressed_snapshots";
+
+    vector<float> input(snapshots);
+    int bits = 12;
+    Compressor::Compress(input.data(), nx, 1, nz, nt, bits,
+                         Compressor::BLOCK_FLOATING_POINT, path.c_str(), true);
+
+    FILE *file = fopen(path.c_str(), "rb");
+    fseek(file, 0, SEEK_END);
+    long compressed_size = ftell(file);
+    fclose(file);
+    REQUIRE(compressed_size < (long) (snapshots.size() * sizeof(float) / 2));
+
+    vector<float> output(snapshot_size * nt);
+    Compressor::Decompress(output.data(), nx, 1, nz, nt, bits,
+                           Compressor::BLOCK_FLOATING_POINT, path.c_str(), true);
+    REQUIRE(output[7] == INFINITY);
+    float max_error = 0;
+    for (size_t i = 0; i < output.size(); i++) {
+        if (i != 7) {
+            max_error = fmax(max_error, fabs(output[i] - snapshots[i]));
+        }
+    }
+    REQUIRE(max_error <= 1000.0f / (1 << (bits - 1)));
+
+    remove(path.c_str());
+}
+
+TEST_CASE("Compressor - Block Floating Point - Denormal Magnitudes", "[Compressor]") {
+    int nx = 64, nz = 32, nt = 1;
+    size_t snapshot_size = (size_t) nx * nz;
+    float max_magnitude = 1e-39f;
+    vector<float> snapshots(snapshot_size * nt);
+    for (size_t i = 0; i < snapshots.size(); i++) {
+        snapshots[i] = max_magnitude * sinf(0.05f * i);
+    }
+    string path = string(OPERATIONS_TEST_DATA_PATH) + "/compressed_denormal_snapshots";
+
+    vector<float> input(snapshots);
+    int bits = 12;
+    Compressor::Compress(input.data(), nx, 1, nz, nt, bits,
+                         Compressor::BLOCK_FLOATING_POINT, path.c_str(), true);
+    vector<float> output(snapshot_size * nt);
+    Compressor::Decompress(output.data(), nx, 1, nz, nt, bits,
+                           Compressor::BLOCK_FLOATING_POINT, path.c_str(), true);
+    float max_error = 0;
+    for (size_t i = 0; i < output.size(); i++) {
+        max_error = fmax(max_error, fabs(output[i] - snapshots[i]));
+    }
+    REQUIRE(max_error <= max_magnitude / (1 << (bits - 1)));
+
+    remove(path.c_str());
+}
@@ -0,0 +1,103 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include <prerequisites/libraries/catch/catch.hpp>
+
+#include <operations/utils/interpolation/Interpolator.hpp>
+#include <operations/test-utils/EnvironmentHandler.hpp>
+
+using namespace std;
+using namespace operations::dataunits;
+using namespace operations::testutils;
+using namespace operations::utils::interpolation;
+
+#define SAMPLE_NT       64
+#define ACTUAL_NT       256
+#define TRACES_COUNT    3
+
+
+/**
+ * @brief Recorded value of the given trace at the given time (in samples).
+ */
+static float recorded_value(uint aTrace, float aTime) {
+    return sinf(2.0f * M_PI * (aTrace + 1) * aTime / SAMPLE_NT) + 0.5f * aTrace;
+}
+
+/**
+ * @note
+ * Resamples band limited traces four times finer, and checks the resampled
+ * values against the exact ones away from the trace ends.
+ */
+void TEST_CASE_INTERPOLATOR(INTERPOLATION aInterpolation, float aTolerance) {
+    set_environment();
+
+    auto traces_holder = new TracesHolder();
+    traces_holder->SampleNT = SAMPLE_NT;
+    traces_holder->SampleDT = 0.004f;
+    traces_holder->TraceSizePerTimeStep = TRACES_COUNT;
+    traces_holder->Traces = new FrameBuffer<float>();
+    traces_holder->Traces->Allocate(SAMPLE_NT * TRACES_COUNT);
+
+    float *traces = traces_holder->Traces->GetHostPointer();
+    for (uint t = 0; t < SAMPLE_NT; t++) {
+        for (uint i = 0; i < TRACES_COUNT; i++) {
+            traces[t * TRACES_COUNT + i] = recorded_value(i, t);
+        }
+    }
+    traces_holder->Traces->ReflectOnNative();
+
+    float total_time = SAMPLE_NT * traces_holder->SampleDT;
+    REQUIRE(Interpolator::Interpolate(traces_holder, ACTUAL_NT, total_time, aInterpolation) != nullptr);
+    REQUIRE(traces_holder->SampleNT == ACTUAL_NT);
+    REQUIRE(traces_holder->SampleDT == Approx(total_time / ACTUAL_NT));
+
+    float max_error = 0;
+    float *interpolated = traces_holder->Traces->GetHostPointer();
+    for (uint t = 0; t < ACTUAL_NT; t++) {
+        float time = (float) t * SAMPLE_NT / ACTUAL_NT;
+        for (uint i = 0; i < TRACES_COUNT; i++) {
+            float value = interpolated[t * TRACES_COUNT + i];
+            /* Recorded samples are kept as is. */
+            if (t % (ACTUAL_NT / SAMPLE_NT) == 0) {
+                REQUIRE(value == Approx(recorded_value(i, time)).margin(1e-5));
+            }
+            if (time > 8 && time < SAMPLE_NT - 8) {
+                max_error = fmax(max_error, fabs(value - recorded_value(i, time)));
+            }
+        }
+    }
+    REQUIRE(max_error < aTolerance);
+
+    delete traces_holder->Traces;
+    delete traces_holder;
+}
+
+TEST_CASE("Interpolator - Linear", "[Interpolator]") {
+    TEST_CASE_INTERPOLATOR(LINEAR, 0.1f);
+}
+
+TEST_CASE("Interpolator - Spline", "[Interpolator]") {
+    TEST_CASE_INTERPOLATOR(SPLINE, 5e-3f);
+}
+
+TEST_CASE("Interpolator - Sinc", "[Interpolator]") {
+    TEST_CASE_INTERPOLATOR(SINC, 5e-3f);
+}
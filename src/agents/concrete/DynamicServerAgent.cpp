@@ -24,17 +24,14 @@
 #include <bs/base/logger/concrete/LoggerSystem.hpp>
 
 #include <stbx/agents/concrete/DynamicServerAgent.hpp>
+#include <stbx/agents/helpers/ResultsReduction.hpp>
 
 using namespace std;
 using namespace bs::base::logger;
 using namespace stbx::agents;
 using namespace operations::dataunits;
 
-DynamicServerAgent::~DynamicServerAgent() {
-    for (auto it : this->mStacks) {
-        delete[] it;
-    }
-}
+DynamicServerAgent::~DynamicServerAgent() = default;
 
 GridBox *DynamicServerAgent::Initialize() {
     LoggerSystem *Logger=LoggerSystem::GetInstance();
@@ -147,21 +144,8 @@ void DynamicServerAgent::BeforeFinalize() {}
 MigrationData *DynamicServerAgent::AfterFinalize(MigrationData *apMigrationData) {
     MigrationData *md = apMigrationData;
 
-    uint size = md->GetGridSize(X_AXIS) *
-                md->GetGridSize(Y_AXIS) *
-                md->GetGridSize(Z_AXIS) *
-                md->GetGatherDimension();
+    helpers::ReduceResults(md, this->mCommunication, 0);
 
-    for (int i = 0; i < md->GetResults().size(); ++i) {
-        mStacks.push_back(new float[size]);
-        MPI_Reduce(md->GetResultAt(i)->GetData(), this->mStacks[i],
-                   size, MPI_FLOAT, MPI_SUM, 0, this->mCommunication);
-    }
-    if (this->self == 0) {
-        for (int i = 0; i < md->GetResults().size(); ++i) {
-            md->SetResults(i, new Result(this->mStacks[i]));
-        }
-    }
     MPI_Finalize();
     if (this->self != 0) {
         exit(0);
@@ -0,0 +1,104 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if defined(USING_MPI)
+
+#include <mpi.h>
+#include <bs/base/logger/concrete/LoggerSystem.hpp>
+#include <stbx/agents/concrete/DynamicSharedCounterAgent.hpp>
+#include <stbx/agents/helpers/ResultsReduction.hpp>
+
+using namespace std;
+using namespace bs::base::logger;
+using namespace stbx::agents;
+using namespace operations::dataunits;
+
+DynamicSharedCounterAgent::~DynamicSharedCounterAgent() = default;
+
+GridBox *DynamicSharedCounterAgent::Initialize() {
+    LoggerSystem *Logger = LoggerSystem::GetInstance();
+    this->mpGridBox = mpEngine->Initialize();
+
+    int provided;
+    MPI_Init_thread(&this->argc, &this->argv, MPI_THREAD_FUNNELED, &provided);
+
+    if (provided != MPI_THREAD_FUNNELED) {
+        Logger->Error() << "Warning MPI did not provide MPI_THREAD_FUNNELED..." << '\n';
+    }
+
+    this->mCommunication = MPI_COMM_WORLD;
+    MPI_Comm_rank(this->mCommunication, &this->self);
+    MPI_Comm_size(this->mCommunication, &this->mProcessCount);
+
+    return this->mpGridBox;
+}
+
+void DynamicSharedCounterAgent::BeforeMigration() {
+    this->mPossibleShots = mpEngine->GetValidShots();
+
+    // Rank 0 exposes the shot counter, the other processes only access it.
+    MPI_Aint window_size = this->self == 0 ? sizeof(int) : 0;
+    MPI_Win_allocate(window_size, sizeof(int), MPI_INFO_NULL, this->mCommunication,
+                     &this->mpCounter, &this->mCounterWindow);
+    MPI_Win_lock_all(0, this->mCounterWindow);
+    if (this->self == 0) {
+        *this->mpCounter = 0;
+    }
+    // Counter is initialized before any process starts pulling shots,
+    // the local store is synchronized with the window on both sides of the barrier.
+    MPI_Win_sync(this->mCounterWindow);
+    MPI_Barrier(this->mCommunication);
+    MPI_Win_sync(this->mCounterWindow);
+}
+
+void DynamicSharedCounterAgent::AfterMigration() {}
+
+void DynamicSharedCounterAgent::BeforeFinalize() {
+    MPI_Win_unlock_all(this->mCounterWindow);
+    MPI_Win_free(&this->mCounterWindow);
+}
+
+MigrationData *DynamicSharedCounterAgent::AfterFinalize(MigrationData *apMigrationData) {
+    MigrationData *md = apMigrationData;
+
+    helpers::ReduceResults(md, this->mCommunication, 0);
+
+    MPI_Finalize();
+    if (this->self != 0) {
+        exit(0);
+    }
+    return md;
+}
+
+bool DynamicSharedCounterAgent::HasNextShot() {
+    // Atomically take the next shot index from the shared counter.
+    int increment = 1;
+    MPI_Fetch_and_op(&increment, &this->mShotIndex, MPI_INT,
+                     0, 0, MPI_SUM, this->mCounterWindow);
+    MPI_Win_flush(0, this->mCounterWindow);
+    return this->mShotIndex < (int) this->mPossibleShots.size();
+}
+
+vector<uint> DynamicSharedCounterAgent::GetNextShot() {
+    vector<uint> process_shots;
+    process_shots.push_back(this->mPossibleShots[this->mShotIndex]);
+    return process_shots;
+}
+
+#endif
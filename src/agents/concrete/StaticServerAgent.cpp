@@ -22,6 +22,7 @@
 #include <mpi.h>
 #include <bs/base/logger/concrete/LoggerSystem.hpp>
 #include <stbx/agents/concrete//StaticServerAgent.hpp>
+#include <stbx/agents/helpers/ResultsReduction.hpp>
 
 using namespace std;
 using namespace bs::base::logger;
@@ -32,11 +33,7 @@ StaticServerAgent::StaticServerAgent() {
     this->mCount = 0;
 }
 
-StaticServerAgent::~StaticServerAgent() {
-    for (auto it : this->mStacks) {
-        delete[] it;
-    }
-}
+StaticServerAgent::~StaticServerAgent() = default;
 
 GridBox *StaticServerAgent::Initialize() {
     LoggerSystem *Logger=LoggerSystem::GetInstance();
@@ -67,21 +64,8 @@ void StaticServerAgent::BeforeFinalize() {}
 MigrationData *StaticServerAgent::AfterFinalize(MigrationData *apMigrationData) {
     MigrationData *md = apMigrationData;
 
-    uint size = md->GetGridSize(X_AXIS) *
-                md->GetGridSize(Y_AXIS) *
-                md->GetGridSize(Z_AXIS) *
-                md->GetGatherDimension();
+    helpers::ReduceResults(md, this->mCommunication, 0);
 
-    for (int i = 0; i < md->GetResults().size(); ++i) {
-        mStacks.push_back(new float[size]);
-        MPI_Reduce(md->GetResultAt(i)->GetData(), this->mStacks[i],
-                   size, MPI_FLOAT, MPI_SUM, 0, this->mCommunication);
-    }
-    if (this->self == 0) {
-        for (int i = 0; i < md->GetResults().size(); ++i) {
-            md->SetResults(i, new Result(this->mStacks[i]));
-        }
-    }
     MPI_Finalize();
     if (this->self != 0) {
         exit(0);
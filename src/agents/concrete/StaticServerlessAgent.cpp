@@ -22,6 +22,7 @@
 #include <mpi.h>
 #include <bs/base/logger/concrete/LoggerSystem.hpp>
 #include <stbx/agents/concrete/StaticServerlessAgent.hpp>
+#include <stbx/agents/helpers/ResultsReduction.hpp>
 
 using namespace std;
 using namespace stbx::agents;
@@ -32,11 +33,7 @@ StaticServerlessAgent::StaticServerlessAgent() {
     this->mCount = 0;
 }
 
-StaticServerlessAgent::~StaticServerlessAgent() {
-    for (auto it : this->mStacks) {
-        delete[] it;
-    }
-}
+StaticServerlessAgent::~StaticServerlessAgent() = default;
 
 GridBox *StaticServerlessAgent::Initialize() {
     LoggerSystem *Logger=LoggerSystem::GetInstance();
@@ -67,22 +64,7 @@ void StaticServerlessAgent::BeforeFinalize() {}
 MigrationData *StaticServerlessAgent::AfterFinalize(MigrationData *apMigrationData) {
     MigrationData *md = apMigrationData;
 
-    uint size = md->GetGridSize(X_AXIS) *
-                md->GetGridSize(Y_AXIS) *
-                md->GetGridSize(Z_AXIS) *
-                md->GetGatherDimension();
-
-    for (int i = 0; i < md->GetResults().size(); ++i) {
-        this->mStacks.push_back(new float[size]);
-        MPI_Reduce(md->GetResultAt(i)->GetData(), this->mStacks[i],
-                   size, MPI_FLOAT, MPI_SUM, 0, this->mCommunication);
-    }
-
-    if (this->self == 0) {
-        for (int i = 0; i < md->GetResults().size(); ++i) {
-            md->SetResults(i, new Result(this->mStacks[i]));
-        }
-    }
+    helpers::ReduceResults(md, this->mCommunication, 0);
 
     MPI_Finalize();
     if (this->self != 0) {
@@ -0,0 +1,64 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if defined(USING_MPI)
+
+#include <algorithm>
+#include <vector>
+
+#include <stbx/agents/helpers/ResultsReduction.hpp>
+
+using namespace std;
+using namespace operations::dataunits;
+
+
+void stbx::agents::helpers::ReduceResults(MigrationData *apMigrationData,
+                                          MPI_Comm aCommunicator, int aRoot,
+                                          size_t aChunkSize, int aChunksInFlight) {
+    int rank;
+    MPI_Comm_rank(aCommunicator, &rank);
+
+    size_t size = (size_t) apMigrationData->GetGridSize(X_AXIS) *
+                  apMigrationData->GetGridSize(Y_AXIS) *
+                  apMigrationData->GetGridSize(Z_AXIS) *
+                  apMigrationData->GetGatherDimension();
+    // Chunks also keep every count within the int range of MPI.
+    aChunkSize = min(max(aChunkSize, (size_t) 1), (size_t) INT32_MAX);
+    aChunksInFlight = max(aChunksInFlight, 1);
+
+    // Ring of in flight reductions, a slot is reused once its reduction completes.
+    vector<MPI_Request> requests(aChunksInFlight, MPI_REQUEST_NULL);
+    size_t issued = 0;
+    for (auto result : apMigrationData->GetResults()) {
+        float *data = result->GetData();
+        for (size_t offset = 0; offset < size; offset += aChunkSize) {
+            MPI_Request &request = requests[issued % aChunksInFlight];
+            MPI_Wait(&request, MPI_STATUS_IGNORE);
+            int count = (int) min(aChunkSize, size - offset);
+            // The root accumulates into its own result, the others only send theirs.
+            const void *send_buffer = rank == aRoot ? MPI_IN_PLACE : data + offset;
+            MPI_Ireduce(send_buffer, data + offset, count, MPI_FLOAT, MPI_SUM,
+                        aRoot, aCommunicator, &request);
+            issued++;
+        }
+    }
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+}
+
+#endif
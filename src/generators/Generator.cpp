@@ -19,6 +19,7 @@
 
 #include <iostream>
 #include <string>
+#include <sys/stat.h>
 
 #include <bs/base/logger/concrete/LoggerSystem.hpp>
 #include <bs/base/configurations/concrete/JSONConfigurationMap.hpp>
@@ -164,6 +165,10 @@ Generator::GenerateAgent() {
             logger->Info() << "Using MPI Shot Distribution:"
                               "\n\tDistribution Type: Dynamic Without Server" << '\n';
             agent = new DynamicServerlessAgent();
+        } else if (agents_map[OP_K_TYPE].get<string>() == "mpi-dynamic-shared-counter") {
+            logger->Info() << "Using MPI Shot Distribution:"
+                              "\n\tDistribution Type: Dynamic With Shared Counter" << '\n';
+            agent = new DynamicSharedCounterAgent();
         }
 #endif
     else {
@@ -212,12 +217,38 @@ Generator::GenerateEngine(const string &aWritePath) {
     auto logger = LoggerSystem::GetInstance();
     auto algorithm = this->mMap[K_SYSTEM][K_ALGORITHM][OP_K_TYPE];
 
+    int concurrent_shots = 1;
+    if (this->mMap[K_SYSTEM][K_ALGORITHM].contains(K_CONCURRENT_SHOTS)) {
+        concurrent_shots = this->mMap[K_SYSTEM][K_ALGORITHM][K_CONCURRENT_SHOTS].get<int>();
+    }
+    if (concurrent_shots < 1) {
+        logger->Error() << "Invalid value for concurrent-shots key : "
+                        << "should be a positive number...\n"
+                        << "Terminating...\n";
+        exit(EXIT_FAILURE);
+    }
+
     Engine *engine;
-    if (algorithm == "rtm") {
+    if (algorithm == "rtm" && concurrent_shots == 1) {
         engine = new RTMEngine(this->GenerateRTMConfiguration(aWritePath),
                                this->GenerateParameters(),
                                this->GenerateCallbacks(aWritePath));
         logger->Info() << "RTM engine generated successfully...\n";
+    } else if (algorithm == "rtm") {
+        vector<RTMEngine *> workers;
+        for (int worker = 0; worker < concurrent_shots; worker++) {
+            /* Each worker gets its own directory for its temporary files. */
+            string worker_path = aWritePath;
+            if (worker > 0) {
+                worker_path += "/worker_" + to_string(worker);
+                mkdir(worker_path.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+            }
+            workers.push_back(new RTMEngine(this->GenerateRTMConfiguration(worker_path),
+                                            this->GenerateParameters(),
+                                            this->GenerateCallbacks(aWritePath)));
+        }
+        engine = new ConcurrentRTMEngine(workers);
+        logger->Info() << "Concurrent RTM engine generated successfully...\n";
     } else {
         logger->Error() << "Unsupported algorithm..."
                         << "Terminating...\n";
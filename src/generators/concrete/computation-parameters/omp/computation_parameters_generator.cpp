@@ -46,6 +46,7 @@ void print_parameters(ComputationParameters *parameters) {
     Logger->Info() << "\tblock factor in x-direction : " << parameters->GetBlockX() << '\n';
     Logger->Info() << "\tblock factor in z-direction : " << parameters->GetBlockZ() << '\n';
     Logger->Info() << "\tblock factor in y-direction : " << parameters->GetBlockY() << '\n';
+    Logger->Info() << "\ttemporal block factor : " << parameters->GetBlockT() << '\n';
     if (parameters->IsUsingWindow()) {
         Logger->Info() << "\tWindow mode : enabled" << '\n';
         if (parameters->GetLeftWindow() == 0 && parameters->GetRightWindow() == 0) {
@@ -65,6 +66,12 @@ void print_parameters(ComputationParameters *parameters) {
         } else {
             Logger->Info() << "\t\tNO WINDOW IN Z-axis" << '\n';
         }
+        if (parameters->IsAdaptiveWindow()) {
+            Logger->Info() << "\t\tAdaptive placement, aperture : " << parameters->GetWindowAperture() << '\n';
+            if (parameters->GetWindowApertureAngle() > 0) {
+                Logger->Info() << "\t\tAperture angle : " << parameters->GetWindowApertureAngle() << '\n';
+            }
+        }
     } else {
         Logger->Info() << "\tWindow mode : disabled (To enable set use-window=yes)..." << '\n';
     }
@@ -76,7 +83,7 @@ generate_parameters(json &map) {
     Logger->Info() << "Parsing OpenMP computation properties..." << '\n';
     json computation_parameters_map = map["computation-parameters"];
 
-    int boundary_length = -1, block_x = -1, block_z = -1, block_y = -1, order = -1;
+    int boundary_length = -1, block_x = -1, block_z = -1, block_y = -1, block_t = -1, order = -1;
     int left_win = -1, right_win = -1, front_win = -1, back_win = -1, depth_win = -1, use_window = -1;
     int n_threads;
     float dt_relax = -1, source_frequency = -1;
@@ -98,6 +105,7 @@ generate_parameters(json &map) {
     block_x = computation_parameters_getter->GetBlock("x");
     block_y = computation_parameters_getter->GetBlock("y");
     block_z = computation_parameters_getter->GetBlock("z");
+    block_t = computation_parameters_getter->GetTemporalBlock();
 
     Window w = computation_parameters_getter->GetWindow();
     left_win = w.left_win;
@@ -138,6 +146,16 @@ generate_parameters(json &map) {
         Logger->Info() << "Using default blocking factor in z-direction of 35" << '\n';
         block_z = 35;
     }
+    if (block_y == -1) {
+        Logger->Error() << "No valid value provided for key 'block-y'..." << '\n';
+        Logger->Info() << "Using default blocking factor in y-direction of 1" << '\n';
+        block_y = 1;
+    }
+    if (block_t == -1) {
+        Logger->Error() << "No valid value provided for key 'block-t'..." << '\n';
+        Logger->Info() << "Using default temporal blocking factor of 1" << '\n';
+        block_t = 1;
+    }
     if (use_window == -1) {
         Logger->Error() << "No valid value provided for key 'use-window'..." << '\n';
         Logger->Info() << "Disabling window by default.." << '\n';
@@ -191,6 +209,9 @@ generate_parameters(json &map) {
     parameters->SetDepthWindow(depth_win);
     parameters->SetFrontWindow(front_win);
     parameters->SetBackWindow(back_win);
+    parameters->SetIsAdaptiveWindow(use_window && w.adaptive);
+    parameters->SetWindowAperture(w.aperture);
+    parameters->SetWindowApertureAngle(w.aperture_angle);
     parameters->SetEquationOrder(configurationsGenerator->GetEquationOrder());
     parameters->SetApproximation(configurationsGenerator->GetApproximation());
     parameters->SetPhysics(configurationsGenerator->GetPhysics());
@@ -200,6 +221,7 @@ generate_parameters(json &map) {
     parameters->SetBlockX(block_x);
     parameters->SetBlockZ(block_z);
     parameters->SetBlockY(block_y);
+    parameters->SetBlockT(block_t);
 
     print_parameters(parameters);
     return parameters;
@@ -227,6 +227,12 @@ void print_parameters(ComputationParameters *parameters) {
         } else {
             Logger->Info() << "\t\tNO WINDOW IN Z-axis" << '\n';
         }
+        if (parameters->IsAdaptiveWindow()) {
+            Logger->Info() << "\t\tAdaptive placement, aperture : " << parameters->GetWindowAperture() << '\n';
+            if (parameters->GetWindowApertureAngle() > 0) {
+                Logger->Info() << "\t\tAperture angle : " << parameters->GetWindowApertureAngle() << '\n';
+            }
+        }
     } else {
         Logger->Info() << "\tWindow mode : disabled (To enable set use-window=yes)..." << '\n';
     }
@@ -425,6 +431,9 @@ ComputationParameters *generate_parameters(json &map) {
     parameters->SetDepthWindow(depth_win);
     parameters->SetFrontWindow(front_win);
     parameters->SetBackWindow(back_win);
+    parameters->SetIsAdaptiveWindow(use_window && w.adaptive);
+    parameters->SetWindowAperture(w.aperture);
+    parameters->SetWindowApertureAngle(w.aperture_angle);
     parameters->SetEquationOrder(configurationsGenerator->GetEquationOrder());
     parameters->SetApproximation(configurationsGenerator->GetApproximation());
     parameters->SetPhysics(configurationsGenerator->GetPhysics());
@@ -172,6 +172,9 @@ ComponentsGenerator::GenerateForwardCollector(const string &write_path) {
     } else if (type == "three") {
         logger->Info() << "Generating Three Propagation Forward Collector...\n";
         forward_collector = new ReversePropagation(map);
+    } else if (type == "checkpoint") {
+        logger->Info() << "Generating Checkpointing Forward Collector...\n";
+        forward_collector = new CheckpointPropagation(map);
     }
 
     if (forward_collector == nullptr) {
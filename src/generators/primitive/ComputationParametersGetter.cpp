@@ -82,6 +82,25 @@ Window ComputationParametersGetter::GetWindow() {
                 w.back_win = DEF_VAL;
             }
         }
+        if (!window_map[K_ADAPTIVE].is_null()) {
+            w.adaptive = window_map[K_ADAPTIVE].get<bool>();
+        }
+        if (!window_map[K_APERTURE].is_null()) {
+            w.aperture = window_map[K_APERTURE].get<int>();
+            if (w.aperture < 0) {
+                Logger->Error() << "Invalid value entered for window aperture: "
+                                   "must be positive..." << '\n';
+                w.aperture = 0;
+            }
+        }
+        if (!window_map[K_APERTURE_ANGLE].is_null()) {
+            w.aperture_angle = window_map[K_APERTURE_ANGLE].get<float>();
+            if (w.aperture_angle < 0 || w.aperture_angle >= 90) {
+                Logger->Error() << "Invalid value entered for window aperture angle: "
+                                   "must be between 0 and 90 degrees..." << '\n';
+                w.aperture_angle = 0;
+            }
+        }
     }
     return w;
 }
@@ -164,6 +183,23 @@ int ComputationParametersGetter::GetBlock(const std::string &direction) {
     return value;
 }
 
+int ComputationParametersGetter::GetTemporalBlock() {
+    LoggerSystem *Logger = LoggerSystem::GetInstance();
+    json cache_blocking_map = this->mMap[K_CACHE_BLOCKING];
+    string block = "block-t";
+    if (cache_blocking_map[block].is_null()) {
+        // Temporal blocking is optional, one time step per sweep by default.
+        return 1;
+    }
+    int value = cache_blocking_map[block].get<int>();
+    if (value <= 0) {
+        Logger->Error() << "Invalid value entered for temporal block factor : "
+                           "must be positive..." << '\n';
+        return DEF_VAL;
+    }
+    return value;
+}
+
 int ComputationParametersGetter::GetIsotropicCircle() {
     LoggerSystem *Logger = LoggerSystem::GetInstance();
     int value = this->mMap[K_ISOTROPIC_CIRCLE].get<int>();
@@ -0,0 +1,272 @@
+/**
+ * Copyright (C) 2021 by Brightskies inc
+ *
+ * This file is part of SeismicToolbox.
+ *
+ * SeismicToolbox is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * SeismicToolbox is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GEDLIB. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <prerequisites/libraries/catch/catch.hpp>
+
+#include <bs/base/configurations/concrete/JSONConfigurationMap.hpp>
+
+#include <operations/engines/concrete/ConcurrentRTMEngine.hpp>
+#include <operations/utils/io/write_utils.h>
+
+#include <stbx/generators/Generator.hpp>
+#include <stbx/test-utils/utils.h>
+
+using namespace std;
+
+using namespace bs::base::configurations;
+using namespace bs::io::dataunits;
+using namespace bs::io::streams;
+
+using namespace stbx::generators;
+using namespace stbx::testutils;
+
+using namespace operations::engines;
+using namespace operations::dataunits;
+
+#define CONCURRENT_MODEL_FILE   STBX_TEST_DATA_PATH "/concurrent_engine_velocity"
+#define CONCURRENT_TRACES_FILE  STBX_TEST_DATA_PATH "/concurrent_engine_traces"
+#define CONCURRENT_WRITE_PATH   STBX_TEST_DATA_PATH "/concurrent_engine"
+
+namespace {
+    const int NX = 61;
+    const int NZ = 41;
+    const float DX = 10.0f;
+    const int NS = 300;
+    const float DT = 1e-3;
+    const vector<float> SOURCES = {200.0f, 300.0f, 400.0f};
+
+    void WriteGathers(string aFilePath, const vector<Gather *> &aGathers) {
+        nlohmann::json configuration_map;
+        JSONConfigurationMap io_map(configuration_map);
+        SeismicWriter writer(SeismicWriter::ToWriterType("segy"), &io_map);
+        writer.AcquireConfiguration();
+        writer.Initialize(aFilePath);
+        writer.Write(aGathers);
+        writer.Finalize();
+        for (auto g : aGathers) {
+            delete g;
+        }
+    }
+
+    /// Writes a layered velocity model and a deterministic shot gather
+    /// for every source position.
+    void WriteWorkload() {
+        vector<float> velocity(NX * NZ);
+        for (int iz = 0; iz < NZ; iz++) {
+            for (int ix = 0; ix < NX; ix++) {
+                velocity[iz * NX + ix] = iz < NZ / 2 ? 1500.0f : 2500.0f;
+            }
+        }
+        WriteGathers(CONCURRENT_MODEL_FILE,
+                     operations::utils::io::TransformToGather(velocity.data(), NX, 1, NZ,
+                                                              DX, DX, DX, 0, 0, 0, 0,
+                                                              1, 1e3, 1e3));
+
+        vector<Gather *> shots;
+        for (size_t shot = 0; shot < SOURCES.size(); shot++) {
+            auto gather = new Gather();
+            for (int ix = 10; ix <= 50; ix++) {
+                auto trace = new Trace(NS);
+                trace->SetTraceHeaderKeyValue(TraceHeaderKey::SCALCO, (int16_t) -1000);
+                trace->SetScaledCoordinateHeader(TraceHeaderKey::SX, SOURCES[shot]);
+                trace->SetScaledCoordinateHeader(TraceHeaderKey::SY, 0);
+                trace->SetScaledCoordinateHeader(TraceHeaderKey::GX, ix * DX);
+                trace->SetScaledCoordinateHeader(TraceHeaderKey::GY, 0);
+                trace->SetTraceHeaderKeyValue(TraceHeaderKey::DT, (uint16_t) (DT * 1e6));
+                trace->SetTraceHeaderKeyValue(TraceHeaderKey::FLDR, (int) shot + 1);
+                trace->SetTraceData(new float[NS]);
+                float offset = fabsf(ix * DX - SOURCES[shot]);
+                for (int is = 0; is < NS; is++) {
+                    float t = is * DT - 0.05f - sqrtf(offset * offset + 400.0f * 400.0f) / 1500.0f;
+                    trace->GetTraceData()[is] = expf(-2000.0f * t * t);
+                }
+                gather->AddTrace(trace);
+            }
+            gather->SetSamplingRate(DT * 1e6);
+            string value = to_string(shot + 1);
+            gather->SetUniqueKeyValue(TraceHeaderKey::FLDR, value);
+            shots.push_back(gather);
+        }
+        WriteGathers(CONCURRENT_TRACES_FILE, shots);
+    }
+
+    nlohmann::json GenerateWorkload(int aConcurrentShots, bool aUsingWindow,
+                                    const string &aBoundary) {
+        nlohmann::json workload = R"(
+{
+  "callbacks": {
+    "writer": {
+      "enable": false
+    },
+    "norm": {
+      "enable": false
+    }
+  },
+  "computation-parameters": {
+    "stencil-order": 8,
+    "boundary-length": 10,
+    "source-frequency": 20,
+    "isotropic-radius": 5,
+    "dt-relax": 0.9,
+    "algorithm": "cpu",
+    "device": "none",
+    "cache-blocking": {
+      "block-x": 128,
+      "block-z": 16,
+      "block-y": 1
+    },
+    "window": {
+      "left": 150,
+      "right": 150,
+      "depth": 400,
+      "front": 0,
+      "back": 0
+    }
+  },
+  "traces": {
+    "min": 1,
+    "max": 3,
+    "sort-type": "CSR"
+  },
+  "models": {
+  },
+  "wave": {
+    "physics": "acoustic",
+    "approximation": "isotropic",
+    "equation-order": "second",
+    "grid-sampling": "uniform"
+  },
+  "components": {
+    "boundary-manager": {
+      "properties": {
+        "use-top-layer": false
+      }
+    },
+    "migration-accommodator": {
+      "type": "cross-correlation",
+      "properties": {
+        "compensation": "none"
+      }
+    },
+    "forward-collector": {
+      "type": "three"
+    },
+    "trace-manager": {
+      "properties": {
+        "type": "segy",
+        "shot-stride": 1,
+        "interpolation": "none"
+      }
+    },
+    "source-injector": {
+      "type": "ricker"
+    },
+    "model-handler": {
+      "properties": {
+        "type": "segy"
+      }
+    }
+  },
+  "interpolation": {
+    "type": "none"
+  },
+  "system": {
+    "algorithm": {
+      "type": "rtm"
+    }
+  }
+}
+        )"_json;
+        workload["computation-parameters"]["window"]["enable"] = aUsingWindow;
+        workload["traces"]["paths"] = {CONCURRENT_TRACES_FILE ".segy"};
+        workload["models"]["velocity"] = CONCURRENT_MODEL_FILE ".segy";
+        workload["components"]["boundary-manager"]["type"] = aBoundary;
+        workload["system"]["algorithm"]["concurrent-shots"] = aConcurrentShots;
+        return workload;
+    }
+
+    /// Migrates all the shots of the workload and returns the stacked image.
+    vector<float> Migrate(const nlohmann::json &aWorkload) {
+        Generator generator(aWorkload);
+        auto engine = generator.GenerateEngine(CONCURRENT_WRITE_PATH);
+        auto gb = engine->Initialize();
+        engine->MigrateShots(engine->GetValidShots(), gb);
+        MigrationData *md = engine->Finalize(gb);
+        size_t size = (size_t) md->GetGridSize(X_AXIS) *
+                      md->GetGridSize(Y_AXIS) *
+                      md->GetGridSize(Z_AXIS);
+        float *data = md->GetResults()[0]->GetData();
+        vector<float> image(data, data + size);
+        delete engine;
+        return image;
+    }
+
+    void REQUIRE_SAME_IMAGE(const vector<float> &aSerial, const vector<float> &aConcurrent) {
+        REQUIRE(aSerial.size() == aConcurrent.size());
+        float max_value = 0;
+        for (float value : aSerial) {
+            max_value = max(max_value, fabsf(value));
+        }
+        REQUIRE(max_value > 0);
+        size_t mismatches = 0;
+        for (size_t i = 0; i < aSerial.size(); i++) {
+            if (fabsf(aSerial[i] - aConcurrent[i]) > 1e-4f * max_value) {
+                mismatches++;
+            }
+        }
+        REQUIRE(mismatches == 0);
+    }
+} //namespace
+
+void TEST_CASE_CONCURRENT_RTM_ENGINE() {
+    mkdir(CONCURRENT_WRITE_PATH, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+    WriteWorkload();
+
+    SECTION("Shared Model - Window") {
+        auto serial = Migrate(GenerateWorkload(1, true, "cpml"));
+        auto concurrent = Migrate(GenerateWorkload(2, true, "cpml"));
+        REQUIRE_SAME_IMAGE(serial, concurrent);
+    }
+
+    SECTION("Copied Model - No Window") {
+        auto serial = Migrate(GenerateWorkload(1, false, "sponge"));
+        auto concurrent = Migrate(GenerateWorkload(3, false, "sponge"));
+        REQUIRE_SAME_IMAGE(serial, concurrent);
+    }
+
+    remove(CONCURRENT_MODEL_FILE ".segy");
+    remove(CONCURRENT_MODEL_FILE ".bs.io.idx.segy");
+    remove(CONCURRENT_TRACES_FILE ".segy");
+    remove(CONCURRENT_TRACES_FILE "FLDR_.bs.io.idx.segy");
+    rmdir(CONCURRENT_WRITE_PATH "/worker_1");
+    rmdir(CONCURRENT_WRITE_PATH "/worker_2");
+    rmdir(CONCURRENT_WRITE_PATH);
+}
+
+TEST_CASE("Concurrent RTM Engine Generation Testing", "[Generators]") {
+    TEST_CASE_CONCURRENT_RTM_ENGINE();
+}